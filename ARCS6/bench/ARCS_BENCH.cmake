@@ -0,0 +1,5 @@
+# 行列演算マイクロベンチマークのソースファイル
+set(
+        ARCS_MATBENCH_file
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixBenchmark.cc
+)
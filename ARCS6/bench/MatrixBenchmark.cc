@@ -0,0 +1,310 @@
+//! @file MatrixBenchmark.cc
+//! @brief 行列演算のマイクロベンチマーク
+//!
+//! Matrix.hh の主要な演算の消費時間を行列サイズ 2～64 で測定して，
+//! 最小値/中央値/99パーセンタイル [ns] と GFLOP/s を表示し，CSV と JSON に書き出す。
+//! ARCSのリビジョン間で結果を比較すれば，行列演算の性能の劣化を検出できる。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・ビルド: robot/general/BaseCtrl で「make matbench」，または cmake でビルドすると ARCS_matbench が生成される。
+// ・使い方: ARCS_matbench [-s 標本数] [-t 1項目あたりの最大測定時間[s]] [-f 演算名] [-l ラベル] [-c CSVファイル名] [-j JSONファイル名]
+//   -f を指定すると，その演算だけを測定する(例: -f inv)。-l のラベル(リビジョン名など)は CSV/JSON にそのまま書き出される。
+// ・時間は std::chrono::steady_clock で測定する。1標本が短すぎると時計の分解能と読み出し時間が効くので，
+//   1標本が MIN_SAMPLE_NS 以上になるように繰り返し回数を自動で決めて，1回あたりの時間に換算する。
+//   測定の前にはウォームアップとして同じ処理を空回しする。
+// ・GFLOP/s は中央値と下記の公称演算量から計算するので，実装の実際の演算数とは一致しないことがある。
+//   リビジョン間の比較には使えるが，計算機の絶対的な性能の指標ではない。
+//   mul: 2n^3, tp: 0 (データの移動のみ), LU: 2n^3/3, solve: 2n^3/3 + 2n^2, inv: 2n^3,
+//   expm(13次パデ近似): 32n^3, Cholesky: n^3/3, QR(Qも生成): 8n^3/3, SVD: 22n^3, eigen(固有値のみ): 10n^3
+// ・入力は固定の種の乱数で作るので，毎回同じ行列で測定される。
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <utility>
+#include <complex>
+
+// 追加のARCSライブラリをここに記述
+#include "Matrix.hh"
+
+using namespace ARCS;
+
+namespace {
+constexpr double MIN_SAMPLE_NS = 2000;	//!< 1標本の最小時間 [ns]
+constexpr double WARMUP_NS = 10e6;		//!< ウォームアップ時間 [ns]
+
+//! @brief 最適化で計算が消されないように，変数が読み書きされたことにする関数
+//! @param[in,out]	x	変数
+template <typename T>
+inline void DoNotOptimize(T& x){
+	asm volatile("" : "+m"(x) : : "memory");
+}
+
+//! @brief 測定結果
+struct BenchResult {
+	std::string Kernel;	//!< 演算名
+	size_t N;			//!< 行列サイズ
+	size_t Reps;		//!< 1標本あたりの繰り返し回数
+	size_t Samples;		//!< 標本数
+	double Min;			//!< 最小値 [ns]
+	double Median;		//!< 中央値 [ns]
+	double P99;			//!< 99パーセンタイル [ns]
+	double GFLOPS;		//!< 中央値から計算した GFLOP/s (公称演算量が0のときは負)
+};
+
+//! @brief 行列演算のマイクロベンチマーククラス
+class MatrixBenchmark {
+	public:
+		//! @brief コンストラクタ
+		//! @param[in]	samples	標本数
+		//! @param[in]	budget	1項目あたりの最大測定時間 [s]
+		//! @param[in]	filter	測定する演算名 (空なら全部)
+		MatrixBenchmark(const size_t samples, const double budget, const std::string& filter)
+			: Samples(samples), Budget(budget*1e9), Filter(filter), Results(), Rand(1)
+		{
+			
+		}
+		
+		//! @brief すべての行列サイズで測定する関数
+		template <size_t... Ns>
+		void Run(std::index_sequence<Ns...>){
+			(RunSize<Ns>(), ...);
+		}
+		
+		//! @brief 結果を表示する関数
+		void Print(void) const{
+			printf("%-9s %4s %9s %7s %12s %12s %12s %9s\n", "kernel", "n", "reps", "samples", "min[ns]", "median[ns]", "p99[ns]", "GFLOP/s");
+			for(const auto& r : Results){
+				printf("%-9s %4zu %9zu %7zu %12.1f %12.1f %12.1f ", r.Kernel.c_str(), r.N, r.Reps, r.Samples, r.Min, r.Median, r.P99);
+				if(0 <= r.GFLOPS){
+					printf("%9.3f\n", r.GFLOPS);
+				}else{
+					printf("%9s\n", "-");
+				}
+			}
+		}
+		
+		//! @brief 結果をCSVファイルに書き出す関数
+		//! @param[in]	filename	ファイル名
+		//! @param[in]	label		ラベル
+		//! @return	true = 成功
+		bool WriteCSV(const std::string& filename, const std::string& label) const{
+			FILE* fp = fopen(filename.c_str(), "w");
+			if(fp == nullptr) return false;
+			fprintf(fp, "label,kernel,n,reps,samples,min_ns,median_ns,p99_ns,gflops\n");
+			for(const auto& r : Results){
+				fprintf(fp, "%s,%s,%zu,%zu,%zu,%.3f,%.3f,%.3f,", label.c_str(), r.Kernel.c_str(), r.N, r.Reps, r.Samples, r.Min, r.Median, r.P99);
+				if(0 <= r.GFLOPS) fprintf(fp, "%.6f", r.GFLOPS);	// 公称演算量が0のときは空欄
+				fprintf(fp, "\n");
+			}
+			fclose(fp);
+			return true;
+		}
+		
+		//! @brief 結果をJSONファイルに書き出す関数
+		//! @param[in]	filename	ファイル名
+		//! @param[in]	label		ラベル
+		//! @return	true = 成功
+		bool WriteJSON(const std::string& filename, const std::string& label) const{
+			FILE* fp = fopen(filename.c_str(), "w");
+			if(fp == nullptr) return false;
+			char date[32];
+			const time_t now = time(nullptr);
+			strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+			fprintf(fp, "{\n");
+			fprintf(fp, "  \"label\": \"%s\",\n", EscapeJSON(label).c_str());
+			fprintf(fp, "  \"date\": \"%s\",\n", date);
+			fprintf(fp, "  \"compiler\": \"%s\",\n", EscapeJSON(__VERSION__).c_str());
+			fprintf(fp, "  \"simd\": %s,\n", MatrixSIMD::isEnabled<double>() ? "true" : "false");
+			fprintf(fp, "  \"results\": [\n");
+			for(size_t i = 0; i < Results.size(); ++i){
+				const auto& r = Results[i];
+				fprintf(fp, "    {\"kernel\": \"%s\", \"n\": %zu, \"reps\": %zu, \"samples\": %zu, ", EscapeJSON(r.Kernel).c_str(), r.N, r.Reps, r.Samples);
+				fprintf(fp, "\"min_ns\": %.3f, \"median_ns\": %.3f, \"p99_ns\": %.3f, \"gflops\": ", r.Min, r.Median, r.P99);
+				if(0 <= r.GFLOPS){
+					fprintf(fp, "%.6f}", r.GFLOPS);
+				}else{
+					fprintf(fp, "null}");	// 公称演算量が0のとき
+				}
+				fprintf(fp, "%s\n", i + 1 < Results.size() ? "," : "");
+			}
+			fprintf(fp, "  ]\n}\n");
+			fclose(fp);
+			return true;
+		}
+	
+	private:
+		MatrixBenchmark(MatrixBenchmark&& r) = delete;							//!< ムーブコンストラクタ使用禁止
+		MatrixBenchmark(const MatrixBenchmark&) = delete;						//!< コピーコンストラクタ使用禁止
+		const MatrixBenchmark& operator=(const MatrixBenchmark&) = delete;	//!< 代入演算子使用禁止
+		
+		size_t Samples;						//!< 標本数
+		double Budget;						//!< 1項目あたりの最大測定時間 [ns]
+		std::string Filter;					//!< 測定する演算名
+		std::vector<BenchResult> Results;	//!< 測定結果
+		std::mt19937 Rand;					//!< 入力行列用の乱数
+		
+		//! @brief 一様乱数の行列を返す関数
+		template <size_t N, size_t M>
+		Matrix<N,M> Random(void){
+			std::uniform_real_distribution<double> dist(-1, 1);
+			Matrix<N,M> U;
+			for(size_t n = 1; n <= N; ++n){
+				for(size_t m = 1; m <= M; ++m) U.SetElement(n, m, dist(Rand));
+			}
+			return U;
+		}
+		
+		//! @brief JSONの文字列として書けるように，引用符と逆斜線と制御文字をエスケープする関数
+		//! @param[in]	str	文字列
+		//! @return	エスケープした文字列
+		static std::string EscapeJSON(const std::string& str){
+			std::string ret;
+			for(const char c : str){
+				switch(c){
+					case '"':  ret += "\\\""; break;
+					case '\\': ret += "\\\\"; break;
+					case '\n': ret += "\\n";  break;
+					case '\r': ret += "\\r";  break;
+					case '\t': ret += "\\t";  break;
+					default:
+						if((unsigned char)c < 0x20){
+							char buf[8];
+							snprintf(buf, sizeof(buf), "\\u%04x", (unsigned int)(unsigned char)c);	// その他の制御文字は \uXXXX で書く
+							ret += buf;
+						}else{
+							ret += c;
+						}
+						break;
+				}
+			}
+			return ret;
+		}
+		
+		//! @brief 1つの行列サイズですべての演算を測定する関数
+		template <size_t N>
+		void RunSize(void){
+			constexpr double n = N;
+			Matrix<N,N> A = Random<N,N>();
+			Matrix<N,N> B = Random<N,N>();
+			Matrix<1,N> b = Random<1,N>();
+			Matrix<N,N> S = tp(A)*A + n*Matrix<N,N>::eye();	// 対称正定値行列
+			Matrix<N,N> E = (0.75/infnorm(A))*A;				// ノルムを1未満にした行列 (expmのスケーリングの回数を固定する)
+			Matrix<N,N> Y, Y2, Y3;
+			Matrix<1,N> x;
+			Matrix<1,N,int> v;
+			Matrix<1,N,std::complex<double>> l;
+			
+			Measure("mul", N, 2*n*n*n, [&]{ Y = A*B; return &Y; }, A, B);
+			Measure("tp", N, 0, [&]{ Y = tp(A); return &Y; }, A);
+			Measure("LU", N, 2*n*n*n/3, [&]{ LU(S, Y, Y2, v); return &Y2; }, S);
+			Measure("solve", N, 2*n*n*n/3 + 2*n*n, [&]{ solve(S, b, x); return &x; }, S, b);
+			Measure("inv", N, 2*n*n*n, [&]{ Y = inv(S); return &Y; }, S);
+			Measure("expm", N, 32*n*n*n, [&]{ Y = expm(E, 13); return &Y; }, E);
+			Measure("Cholesky", N, n*n*n/3, [&]{ Cholesky(S, Y); return &Y; }, S);
+			Measure("QR", N, 8*n*n*n/3, [&]{ QR(A, Y, Y2); return &Y2; }, A);
+			Measure("SVD", N, 22*n*n*n, [&]{ SVD(A, Y, Y2, Y3); return &Y2; }, A);
+			Measure("eigen", N, 10*n*n*n, [&]{ l = eigen(A); return &l; }, A);
+		}
+		
+		//! @brief 1つの演算の消費時間を測定する関数
+		//! @param[in]	kernel	演算名
+		//! @param[in]	N		行列サイズ
+		//! @param[in]	flops	公称演算量
+		//! @param[in]	func	測定する処理 (出力先へのポインタを返すこと)
+		//! @param[in]	inputs	入力 (毎回書き換えられたことにして，計算がループの外に出されないようにする)
+		template <typename F, typename... Ts>
+		void Measure(const char* kernel, const size_t N, const double flops, F&& func, Ts&... inputs){
+			using clock = std::chrono::steady_clock;
+			if(!Filter.empty() && Filter != kernel) return;
+			auto Once = [&]{
+				(DoNotOptimize(inputs), ...);
+				auto p = func();
+				DoNotOptimize(*p);
+			};
+			auto Elapsed = [&](const size_t reps){
+				const auto start = clock::now();
+				for(size_t i = 0; i < reps; ++i) Once();
+				return std::chrono::duration<double, std::nano>(clock::now() - start).count();
+			};
+			
+			// ウォームアップ
+			for(double warm = 0; warm < WARMUP_NS;) warm += Elapsed(1);
+			
+			// 1標本が MIN_SAMPLE_NS 以上になる繰り返し回数の決定
+			size_t reps = 1;
+			double t = Elapsed(reps);
+			while(t < MIN_SAMPLE_NS){
+				reps *= 2;
+				t = Elapsed(reps);
+			}
+			
+			// 測定 (測定時間が上限を超えそうなら標本数を減らす)
+			const size_t samples = std::max<size_t>(5, std::min<size_t>(Samples, Budget/t));
+			std::vector<double> ns(samples);
+			for(auto& s : ns) s = Elapsed(reps)/reps;
+			std::sort(ns.begin(), ns.end());
+			const size_t i99 = std::min(samples - 1, (size_t)std::ceil(0.99*samples) - 1);	// 最近順位法
+			
+			const double median = (samples % 2 == 1) ? ns[samples/2] : 0.5*(ns[samples/2 - 1] + ns[samples/2]);
+			const double gflops = (0 < flops) ? flops/median : -1;	// flop/ns = GFLOP/s
+			Results.push_back({kernel, N, reps, samples, ns.front(), median, ns[i99], gflops});
+			fprintf(stderr, "%-9s n = %2zu : %12.1f [ns]\n", kernel, N, median);	// 進捗表示
+		}
+};
+}
+
+//! @brief エントリポイント
+//! @param[in]	argc	引数の数
+//! @param[in]	argv	引数
+//! @return 終了ステータス
+int main(int argc, char** argv){
+	size_t samples = 200;
+	double budget = 0.2;
+	std::string filter, label, csvname = "MatrixBenchmark.csv", jsonname = "MatrixBenchmark.json";
+	for(int i = 1; i < argc; ++i){
+		const std::string opt = argv[i];
+		if(i + 1 < argc && opt == "-s"){
+			samples = std::max(1, atoi(argv[++i]));
+		}else if(i + 1 < argc && opt == "-t"){
+			budget = atof(argv[++i]);
+		}else if(i + 1 < argc && opt == "-f"){
+			filter = argv[++i];
+		}else if(i + 1 < argc && opt == "-l"){
+			label = argv[++i];
+		}else if(i + 1 < argc && opt == "-c"){
+			csvname = argv[++i];
+		}else if(i + 1 < argc && opt == "-j"){
+			jsonname = argv[++i];
+		}else{
+			printf("Usage: %s [-s samples] [-t seconds] [-f kernel] [-l label] [-c csvfile] [-j jsonfile]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	
+	printf("ARCS MATRIX BENCHMARK (SIMD: %s)\n", MatrixSIMD::isEnabled<double>() ? "ON" : "OFF");
+	MatrixBenchmark Bench(samples, budget, filter);
+	Bench.Run(std::index_sequence<2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64>());
+	Bench.Print();
+	if(!Bench.WriteCSV(csvname, label)) fprintf(stderr, "Cannot write %s\n", csvname.c_str());
+	if(!Bench.WriteJSON(jsonname, label)) fprintf(stderr, "Cannot write %s\n", jsonname.c_str());
+	
+	return EXIT_SUCCESS;	// 正常終了
+}
+
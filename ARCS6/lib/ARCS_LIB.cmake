@@ -34,6 +34,10 @@ set(
         ${CMAKE_CURRENT_LIST_DIR}/Discret.hh
         ${CMAKE_CURRENT_LIST_DIR}/DisturbanceObsrv.cc
         ${CMAKE_CURRENT_LIST_DIR}/DisturbanceObsrv.hh
+        ${CMAKE_CURRENT_LIST_DIR}/DualNumber.cc
+        ${CMAKE_CURRENT_LIST_DIR}/DualNumber.hh
+        ${CMAKE_CURRENT_LIST_DIR}/DynMatrix.cc
+        ${CMAKE_CURRENT_LIST_DIR}/DynMatrix.hh
         ${CMAKE_CURRENT_LIST_DIR}/FeedforwardNeuralNet3.cc
         ${CMAKE_CURRENT_LIST_DIR}/FeedforwardNeuralNet3.hh
         ${CMAKE_CURRENT_LIST_DIR}/FixedAverage.cc
@@ -66,6 +70,8 @@ set(
         ${CMAKE_CURRENT_LIST_DIR}/IrisClassDatasets.hh
         ${CMAKE_CURRENT_LIST_DIR}/IrisDatasets.cc
         ${CMAKE_CURRENT_LIST_DIR}/IrisDatasets.hh
+        ${CMAKE_CURRENT_LIST_DIR}/LatencyHistogram.cc
+        ${CMAKE_CURRENT_LIST_DIR}/LatencyHistogram.hh
         ${CMAKE_CURRENT_LIST_DIR}/Limiter.cc
         ${CMAKE_CURRENT_LIST_DIR}/Limiter.hh
         ${CMAKE_CURRENT_LIST_DIR}/LinuxCommander.cc
@@ -76,8 +82,26 @@ set(
         ${CMAKE_CURRENT_LIST_DIR}/LowPassFilter.hh
         ${CMAKE_CURRENT_LIST_DIR}/LowPassFilter2.cc
         ${CMAKE_CURRENT_LIST_DIR}/LowPassFilter2.hh
+        ${CMAKE_CURRENT_LIST_DIR}/Mailbox.cc
+        ${CMAKE_CURRENT_LIST_DIR}/Mailbox.hh
         ${CMAKE_CURRENT_LIST_DIR}/Matrix.cc
         ${CMAKE_CURRENT_LIST_DIR}/Matrix.hh
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixBatch.cc
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixBatch.hh
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixDecomposition.cc
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixDecomposition.hh
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixExpr.cc
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixExpr.hh
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixSIMD.cc
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixSIMD.hh
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixStructured.cc
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixStructured.hh
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixThreadPool.cc
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixThreadPool.hh
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixUnroll.cc
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixUnroll.hh
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixView.cc
+        ${CMAKE_CURRENT_LIST_DIR}/MatrixView.hh
         ${CMAKE_CURRENT_LIST_DIR}/MotorFrameTransform.cc
         ${CMAKE_CURRENT_LIST_DIR}/MotorFrameTransform.hh
         ${CMAKE_CURRENT_LIST_DIR}/MotorParamDef.hh
@@ -87,6 +111,8 @@ set(
         ${CMAKE_CURRENT_LIST_DIR}/MotorSimulators.hh
         ${CMAKE_CURRENT_LIST_DIR}/MovingAverage.cc
         ${CMAKE_CURRENT_LIST_DIR}/MovingAverage.hh
+        ${CMAKE_CURRENT_LIST_DIR}/MultiRateScheduler.cc
+        ${CMAKE_CURRENT_LIST_DIR}/MultiRateScheduler.hh
         ${CMAKE_CURRENT_LIST_DIR}/NeuralNetParamDef.hh
         ${CMAKE_CURRENT_LIST_DIR}/NotchFilter.cc
         ${CMAKE_CURRENT_LIST_DIR}/NotchFilter.hh
@@ -126,6 +152,8 @@ set(
         ${CMAKE_CURRENT_LIST_DIR}/RPi2GPIO.hh
         ${CMAKE_CURRENT_LIST_DIR}/SA2-RasPi2.cc
         ${CMAKE_CURRENT_LIST_DIR}/SA2-RasPi2.hh
+        ${CMAKE_CURRENT_LIST_DIR}/SeqLock.cc
+        ${CMAKE_CURRENT_LIST_DIR}/SeqLock.hh
         ${CMAKE_CURRENT_LIST_DIR}/SFthread.cc
         ${CMAKE_CURRENT_LIST_DIR}/SFthread.hh
         ${CMAKE_CURRENT_LIST_DIR}/Shuffle.cc
@@ -140,6 +168,8 @@ set(
         ${CMAKE_CURRENT_LIST_DIR}/SingleLayerPerceptron.hh
         ${CMAKE_CURRENT_LIST_DIR}/SpeedCalculator.cc
         ${CMAKE_CURRENT_LIST_DIR}/SpeedCalculator.hh
+        ${CMAKE_CURRENT_LIST_DIR}/SPSCQueue.cc
+        ${CMAKE_CURRENT_LIST_DIR}/SPSCQueue.hh
         ${CMAKE_CURRENT_LIST_DIR}/SquareWave.cc
         ${CMAKE_CURRENT_LIST_DIR}/SquareWave.hh
         ${CMAKE_CURRENT_LIST_DIR}/StairsWave.cc
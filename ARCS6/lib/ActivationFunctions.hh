@@ -3,10 +3,10 @@
 //!
 //! ニューラルネット用の活性化関数
 //!
-//! @date 2020/05/10
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -15,6 +15,7 @@
 #define ACTIVATIONFUNCTIONS
 
 #include <cassert>
+#include <cmath>
 #include "Matrix.hh"
 
 // ARCS組込み用マクロ
@@ -44,10 +45,12 @@ enum class ActvFunc {
 class ActivationFunctions {
 	public:
 		//! @brief ステップ活性化関数
+		//! @tparam	TT	データ型
 		//! @param[in]	u	入力データ
 		//! @return	出力
-		static double Step(double u){
-			double ret;
+		template <typename TT>
+		static TT Step(TT u){
+			TT ret;
 			if(0 <= u){
 				ret = 1;
 			}else{
@@ -57,31 +60,40 @@ class ActivationFunctions {
 		}
 		
 		//! @brief 恒等活性化関数
+		//! @tparam	TT	データ型
 		//! @param[in]	u	入力データ
 		//! @return	出力
-		static double Identity(double u){
+		template <typename TT>
+		static TT Identity(TT u){
 			return u;
 		}
 		
 		//! @brief シグモイド関数活性化関数
+		//! @tparam	TT	データ型
 		//! @param[in]	u	入力データ
 		//! @return	出力
-		static double Sigmoid(double u){
+		template <typename TT>
+		static TT Sigmoid(TT u){
+			using std::exp;	// 二重数(DualNumber.hh)のときはその型用のexpを使う
 			return 1.0/(1.0 + exp(-u));
 		}
 		
 		//! @brief シグモイド関数活性化関数の微分
+		//! @tparam	TT	データ型
 		//! @param[in]	u	入力データ
 		//! @return	出力
-		static double DerivativeSigmoid(double u){
+		template <typename TT>
+		static TT DerivativeSigmoid(TT u){
 			return (1.0 - Sigmoid(u))*Sigmoid(u);
 		}
 		
 		//! @brief ReLU活性化関数
+		//! @tparam	TT	データ型
 		//! @param[in]	u	入力データ
 		//! @return	出力
-		static double ReLU(double u){
-			double ret;
+		template <typename TT>
+		static TT ReLU(TT u){
+			TT ret;
 			if(0 <= u){
 				ret = u;
 			}else{
@@ -91,19 +103,22 @@ class ActivationFunctions {
 		}
 		
 		//! @brief ReLU活性化関数の微分
+		//! @tparam	TT	データ型
 		//! @param[in]	u	入力データ
 		//! @return	出力
-		static double DerivativeReLU(double u){
+		template <typename TT>
+		static TT DerivativeReLU(TT u){
 			return Step(u);
 		}
 		
 		//! @brief Softmax関数
 		//! @tparam	M	縦ベクトルの長さ
+		//! @tparam	TT	データ型
 		//! @param[in]	u	入力縦ベクトル
 		//! @return	出力
-		template <size_t M>
-		static Matrix<1,M> Softmax(const Matrix<1,M>& u){
-			const Matrix<1,1> SigExp = sumcolumn(expe(u));	// 要素ごとにexpを通して縦方向に加算
+		template <size_t M, typename TT>
+		static Matrix<1,M,TT> Softmax(const Matrix<1,M,TT>& u){
+			const Matrix<1,1,TT> SigExp = sumcolumn(expe(u));	// 要素ごとにexpを通して縦方向に加算
 			return expe(u)/(SigExp.GetElement(1,1));		// 要素ごとに加算結果で除算して全体に対しての割合を返す
 		}
 		
@@ -113,8 +128,9 @@ class ActivationFunctions {
 		//! @tparam T	活性化関数の種類
 		//! @tparam	N	行列の幅
 		//! @tparam M	行列の高さ
-		template <ActvFunc T, size_t N, size_t M>
-		static void f(const Matrix<N,M>& U, Matrix<N,M>& Y){
+		//! @tparam	TT	データ型
+		template <ActvFunc T, size_t N, size_t M, typename TT>
+		static void f(const Matrix<N,M,TT>& U, Matrix<N,M,TT>& Y){
 			// 活性化関数の種類の設定に従って呼ぶ関数をコンパイル時に変える
 			if constexpr(T == ActvFunc::STEP){
 				// ステップ活性化関数の場合
@@ -160,15 +176,16 @@ class ActivationFunctions {
 				}
 			}
 		}
-
+		
 		//! @brief 活性化関数の微分
 		//! @param[in]	U	入力行列
 		//! @param[out]	Y	出力行列
 		//! @tparam T	活性化関数の種類
 		//! @tparam	N	行列の幅
 		//! @tparam M	行列の高さ
-		template <ActvFunc T, size_t N, size_t M>
-		static void fp(const Matrix<N,M>& U, Matrix<N,M>& Y){
+		//! @tparam	TT	データ型
+		template <ActvFunc T, size_t N, size_t M, typename TT>
+		static void fp(const Matrix<N,M,TT>& U, Matrix<N,M,TT>& Y){
 			// 行列の要素ごとに活性化関数を掛ける
 			for(size_t n = 1; n <= N; ++n){
 				for(size_t m = 1; m <= M; ++m){
@@ -196,7 +213,7 @@ class ActivationFunctions {
 				}
 			}
 		}
-		
+	
 	private:
 		ActivationFunctions() = delete;							//!< コンストラクタ使用禁止
 		ActivationFunctions(ActivationFunctions&& r) = delete;	//!< ムーブコンストラクタ使用禁止
@@ -3,10 +3,10 @@
 //!
 //! ニューラルネットワークデータセット用のバッチ処理を行うクラス
 //!
-//! @date 2020/05/12
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -42,15 +42,34 @@ class BatchProcessor {
 		//! @return	切り出したミニバッチデータ行列
 		template <size_t N, size_t D, size_t M>
 		static Matrix<M,N> GetMiniBatchData(const Matrix<N,D>& U, const size_t i){
-			Matrix<N,M> Buff;
-			size_t k = 1;
-			for(size_t j = (i - 1)*M; j < (i - 1)*M + M; j++){
-				setrow(Buff, getrow(U, j+1), k);	// ミニバッチサイズごとに切り出す
-				++k;
-			}
-			return tp(Buff);
+			return GetMiniBatchView<N,D,M>(U, i);	// ビューから直接1回だけコピー
 		}
 		
+		//! @brief i番目のミニバッチデータのビューを取得する関数(コピーなし版)
+		//! 返り値は元のデータセット行列を参照するビューなので，データセット行列より長生きさせないこと。
+		//! @tparam	N	データセットのチャネル数(データセット行列の幅)
+		//! @tparam	D	データセットのデータ数(データセット行列の高さ)
+		//! @tparam M	ミニバッチ数(ミニバッチ行列の幅)
+		//! @param[in]	i	ミニバッチ番号
+		//! @return	ミニバッチデータ行列 Matrix<M,N> として評価されるビュー
+		template <size_t N, size_t D, size_t M>
+		static constexpr auto GetMiniBatchView(const Matrix<N,D>& U, const size_t i){
+			arcs_assert(0 < i && i*M <= D);			// データセットの範囲内かチェック
+			return tp(subview<N,M>(U, 1, (i - 1)*M + 1));	// ミニバッチサイズごとの行を切り出して転置したビュー
+		}
+		
+		//! @brief i番目のミニバッチデータのビューを取得する関数(書き込み可能版)
+		//! ビューへ代入すると元のデータセット行列のミニバッチ部分が書き換わる。
+		template <size_t N, size_t D, size_t M>
+		static constexpr auto GetMiniBatchView(Matrix<N,D>& U, const size_t i){
+			arcs_assert(0 < i && i*M <= D);			// データセットの範囲内かチェック
+			return tp(subview<N,M>(U, 1, (i - 1)*M + 1));	// ミニバッチサイズごとの行を切り出して転置したビュー
+		}
+		
+		//! @brief 一時的なデータセット行列からのビュー生成禁止
+		template <size_t N, size_t D, size_t M>
+		static void GetMiniBatchView(Matrix<N,D>&& U, const size_t i) = delete;
+	
 	private:
 		BatchProcessor() = delete;										//!< コンストラクタ使用禁止
 		BatchProcessor(BatchProcessor&& r) = delete;					//!< ムーブコンストラクタ使用禁止
@@ -3,16 +3,21 @@
 //!
 //! CPUのコア，ポリシーなどを設定するクラス
 //!
-//! @date 2019/07/25
-//! @author Yuki YOKOKURA
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2019 Yuki YOKOKURA
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
 
 #include "CPUSettings.hh"
 #include <cassert>
+#include <cstdint>
+#include <cerrno>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
 
 // ARCS組込み用マクロ
 #ifdef ARCS_IN
@@ -27,8 +32,27 @@
 	#define EventLogVar(a)
 #endif
 
+// SCHED_DEADLINE の定義 (古いglibcのヘッダには無いのでカーネルの値を使う)
+#ifndef SCHED_DEADLINE
+	#define SCHED_DEADLINE 6
+#endif
+
 using namespace ARCS;
 
+namespace {
+	//! @brief sched_setattr システムコールに渡すスケジューリング属性 (カーネルの struct sched_attr と同じ並び)
+	struct SchedAttr {
+		uint32_t size;				//!< 構造体の大きさ
+		uint32_t sched_policy;		//!< ポリシー
+		uint64_t sched_flags;		//!< フラグ
+		int32_t  sched_nice;		//!< nice値 (SCHED_OTHER用)
+		uint32_t sched_priority;	//!< 優先度 (SCHED_FIFO, SCHED_RR用)
+		uint64_t sched_runtime;		//!< [ns] 実行時間 (SCHED_DEADLINE用)
+		uint64_t sched_deadline;	//!< [ns] 相対期限 (SCHED_DEADLINE用)
+		uint64_t sched_period;		//!< [ns] 周期 (SCHED_DEADLINE用)
+	};
+}
+
 //! @brief スレッドを動作させるCPUコアとポリシーを設定する関数
 //! @param[in]	FuncName	スレッド関数ID
 //! @param[in]	CPUnum		CPUコア番号(0スタート)
@@ -53,3 +77,38 @@ void CPUSettings::SetCPUandPolicy(const pthread_t FuncName, const unsigned int C
 	EventLogVar(FuncName_param.sched_priority);
 }
 
+//! @brief 呼び出したスレッドのポリシーを SCHED_DEADLINE に設定する関数
+//! 周期 Period ごとに実行時間 Runtime がカーネルにより保証され，使い切るとその周期の間は実行されなくなる。
+//! SCHED_DEADLINE のスレッドは特定のCPUコアに固定できないので，全てのCPUコアで動作できるようにしてから設定する。
+//! root権限が無い場合や，CPUコアの帯域が足りずにカーネルに受け入れられなかった場合は false を返す。(CPUコアの割り当てとポリシーは元に戻らないので注意)
+//! @param[in]	Runtime		[ns] 1周期あたりの実行時間
+//! @param[in]	Deadline	[ns] 周期の開始時刻からの相対期限 (Runtime ≦ Deadline ≦ Period)
+//! @param[in]	Period		[ns] 周期
+//! @return	true = 設定成功，false = 設定失敗
+bool CPUSettings::SetDeadlinePolicy(const unsigned long Runtime, const unsigned long Deadline, const unsigned long Period){
+	arcs_assert(Runtime <= Deadline && Deadline <= Period);	// 範囲チェック
+	
+	// 全てのオンラインCPUコアで動作できるようにする
+	cpu_set_t cpuset;	// CPU設定用変数
+	CPU_ZERO(&cpuset);
+	const long CPUs = sysconf(_SC_NPROCESSORS_ONLN);
+	for(long i = 0; i < CPUs; ++i) CPU_SET(i, &cpuset);
+	pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+	
+	// sched_setattr システムコールで SCHED_DEADLINE に設定する (glibc にラッパ関数が無いので直接呼ぶ)
+	SchedAttr Attr = {0};
+	Attr.size = sizeof(SchedAttr);
+	Attr.sched_policy = SCHED_DEADLINE;
+	Attr.sched_runtime = Runtime;
+	Attr.sched_deadline = Deadline;
+	Attr.sched_period = Period;
+	const bool ret = syscall(SYS_sched_setattr, 0, &Attr, 0) == 0;
+	[[maybe_unused]] const int Error = ret ? 0 : errno;	// 失敗したときのエラー番号 (EPERM = 権限が無い，EBUSY = 帯域不足)
+	
+	// イベントログ
+	EventLogVar(Runtime);
+	EventLogVar(Deadline);
+	EventLogVar(Period);
+	EventLogVar(Error);
+	return ret;
+}
@@ -3,10 +3,10 @@
 //!
 //! CPUのコア，ポリシーなどを設定するクラス
 //!
-//! @date 2019/07/25
-//! @author Yuki YOKOKURA
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2019 Yuki YOKOKURA
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -21,6 +21,7 @@ namespace ARCS {	// ARCS名前空間
 	class CPUSettings {
 		public:
 			static void SetCPUandPolicy(const pthread_t FuncName, const unsigned int CPUnum, const int Policy);	//!< スレッドを動作させるCPUコアとポリシーを設定する関数
+			static bool SetDeadlinePolicy(const unsigned long Runtime, const unsigned long Deadline, const unsigned long Period);	//!< 呼び出したスレッドのポリシーを SCHED_DEADLINE に設定する関数
 			
 		private:
 			CPUSettings() = delete;						//!< コンストラクタ使用禁止
@@ -5,10 +5,10 @@
 //! データ自体は保持していないので，外部のCSVデータを必要とする
 //! 注意：CSVデータの改行コードは「LF」とし、「CRLF」は不可
 //!
-//! @date 2020/05/25
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -110,7 +110,7 @@ class CurrencyDatasets {
 		//! @param[out]	Y	為替データ
 		void GetCurrectBatchData(const size_t i, Matrix<M,N>& Y){
 			arcs_assert(i <= FinalMinbatNum);	// ミニバッチ番号の範囲チェック
-			Y = BatchProcessor::GetMiniBatchData<N,D,M>(MeasuredData, i);	// データセットを切り出してミニバッチにする
+			Y = BatchProcessor::GetMiniBatchView<N,D,M>(MeasuredData, i);	// データセットから直接ミニバッチへコピーする
 		}
 		*/
 		
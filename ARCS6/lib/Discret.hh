@@ -1,12 +1,20 @@
 //! @file Discret.hh
 //! @brief 離散化クラス(テンプレート版)
-//! @date 2020/05/02
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the BSD License.
 // For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・パデ近似の次数だけを指定する関数(と次数を指定しない関数)では，拡大行列 [A B; 0 0]*Ts の指数行列を1回だけ計算して，
+//   その左上を離散系A行列，右上を離散系B行列とする厳密な零次ホールド離散化を使う。
+//   定積分の分割数も指定する関数では，従来通りシンプソン法による定積分でB行列を計算する。
+// ・すべての関数は定数式として評価できるので，定数の連続系行列から constexpr で受けるとコンパイル時に離散化される。
+//   例： constexpr auto ABd = Discret::GetDiscSystem(Ac, Bc, Ts); constexpr Matrix<N,N> Ad = ABd.first;
+//   (C++17ではconstexprの構造化束縛はできないので，ペアで受けてから取り出す)
 
 #ifndef DISCRET
 #define DISCRET
@@ -28,9 +36,23 @@ class Discret {
 		template <size_t NB, size_t MB>
 		static constexpr std::pair<Matrix<MB,MB>, Matrix<NB,MB>>
 		GetDiscSystem(const Matrix<MB,MB>& Ac, const Matrix<NB,MB>& Bc, const double Ts){
-			constexpr size_t Npade = 13;					// パデ近似の次数
-			constexpr unsigned long Nint = 10000;			// 定積分の分割数
-			return GetDiscSystem(Ac, Bc, Ts, Npade, Nint);	// 離散化してタプルで返す
+			constexpr size_t Npade = 13;				// パデ近似の次数
+			return GetDiscSystem(Ac, Bc, Ts, Npade);	// 離散化してペアで返す
+		}
+		
+		//! @brief 連続系状態方程式のA，B行列を離散化する関数 (構造化束縛版，パデ近似の次数を自分で指定する場合)
+		//! @param[in]	Ac	連続系のA行列
+		//! @param[in]	Bc	連続系のB行列
+		//! @param[in]	Ts	サンプリング時間
+		//! @param[in]	Npade	パデ近似の次数
+		//! @return	Ad,Bd	離散系のA行列，離散系のB行列
+		template <size_t NB, size_t MB>
+		static constexpr std::pair<Matrix<MB,MB>, Matrix<NB,MB>>
+		GetDiscSystem(const Matrix<MB,MB>& Ac, const Matrix<NB,MB>& Bc, const double Ts, const size_t Npade){
+			Matrix<MB,MB> Ad;
+			Matrix<NB,MB> Bd;
+			GetDiscSystem(Ac, Bc, Ad, Bd, Ts, Npade);	// 離散化
+			return {Ad, Bd};	// ペアで返す
 		}
 		
 		//! @brief 連続系状態方程式のA，B行列を離散化する関数 (構造化束縛版，パデ近似の次数と定積分分割数を自分で指定する場合)
@@ -62,12 +84,44 @@ class Discret {
 		static constexpr void GetDiscSystem(
 			const Matrix<MB,MB>& Ac, const Matrix<NB,MB>& Bc, Matrix<MB,MB>& Ad, Matrix<NB,MB>& Bd, const double Ts
 		){
-			constexpr size_t Npade = 13;					// パデ近似の次数
-			constexpr unsigned long Nint = 10000;			// 定積分の分割数
-			GetDiscSystem(Ac, Bc, Ad, Bd, Ts, Npade, Nint);	// 離散化
+			constexpr size_t Npade = 13;				// パデ近似の次数
+			GetDiscSystem(Ac, Bc, Ad, Bd, Ts, Npade);	// 離散化
+		}
+		
+		//! @brief 連続系状態方程式のA，B行列を離散化する関数 (パデ近似の次数を自分で指定する場合)
+		//! 拡大行列 [Ac Bc; 0 0]*Ts の指数行列を計算すると，その左上が e^(Ac*Ts)，右上が ∫[0,Ts] e^(Ac*t) dt Bc になる。
+		//! @param[in]	Ac	連続系のA行列
+		//! @param[in]	Bc	連続系のB行列
+		//! @param[out]	Ad	離散系のA行列
+		//! @param[out]	Bd	離散系のB行列
+		//! @param[in]	Ts	サンプリング時間
+		//! @param[in]	Npade	パデ近似の次数
+		template <size_t NB, size_t MB>
+		static constexpr void GetDiscSystem(
+			const Matrix<MB,MB>& Ac, const Matrix<NB,MB>& Bc, Matrix<MB,MB>& Ad, Matrix<NB,MB>& Bd,
+			const double Ts, const size_t Npade
+		){
+			// 拡大行列の生成 (下の行はゼロのまま)
+			Matrix<MB+NB,MB+NB> Ma;
+			for(size_t i = 0; i < MB; ++i){
+				for(size_t j = 0; j < MB; ++j) Ma.Data[i][j] = Ac.Data[i][j]*Ts;
+			}
+			for(size_t i = 0; i < NB; ++i){
+				for(size_t j = 0; j < MB; ++j) Ma.Data[MB+i][j] = Bc.Data[i][j]*Ts;
+			}
+			
+			// 拡大行列の指数行列から離散系のA行列とB行列を取り出す
+			const Matrix<MB+NB,MB+NB> Ea = expm(Ma, Npade);
+			for(size_t i = 0; i < MB; ++i){
+				for(size_t j = 0; j < MB; ++j) Ad.Data[i][j] = Ea.Data[i][j];
+			}
+			for(size_t i = 0; i < NB; ++i){
+				for(size_t j = 0; j < MB; ++j) Bd.Data[i][j] = Ea.Data[MB+i][j];
+			}
 		}
 		
 		//! @brief 連続系状態方程式のA，B行列を離散化する関数 (パデ近似の次数と定積分分割数を自分で指定する場合)
+		//! B行列はシンプソン法による定積分で計算する。
 		//! @param[in]	Ac	連続系のA行列
 		//! @param[in]	Bc	連続系のB行列
 		//! @param[out]	Ad	離散系のA行列
@@ -99,9 +153,11 @@ class Discret {
 		//! @param[in]	Ts	サンプリング時間
 		template <size_t NB, size_t MB>
 		static constexpr Matrix<NB,MB> GetDiscMatB(const Matrix<MB,MB>& Ac, const Matrix<NB,MB>& Bc, const double Ts){
-			constexpr size_t Npade = 3;						// パデ近似の次数
-			constexpr unsigned long Nint = 100;				// 定積分の分割数
-			return integral_expm(Ac, Ts, Nint, Npade)*Bc;	// 離散系B行列を返す
+			constexpr size_t Npade = 13;	// パデ近似の次数
+			Matrix<MB,MB> Ad;
+			Matrix<NB,MB> Bd;
+			GetDiscSystem(Ac, Bc, Ad, Bd, Ts, Npade);	// 拡大行列の指数行列で離散化
+			return Bd;	// 離散系B行列を返す
 		}
 		
 		//! @brief 連続系状態方程式のA行列を離散化して返す関数 (パデ近似の次数を自分で指定する場合)
@@ -114,6 +170,7 @@ class Discret {
 		}
 		
 		//! @brief 連続系状態方程式のB行列を離散化する関数 (パデ近似の次数と定積分分割数を自分で指定する場合)
+		//! シンプソン法による定積分で計算する。
 		//! @param[in]	Ac	連続系のA行列
 		//! @param[in]	Bc	連続系のB行列
 		//! @param[in]	Ts	サンプリング時間
@@ -2,12 +2,12 @@
 //! @brief 外乱オブザーバクラス(ベクトル対応版)
 //! 
 //! q軸電流とモータ側速度/位置からモータ側外乱トルクを推定します。
-//! 縦ベクトル変数の入出力も可能です。
+//! 縦ベクトル変数の入出力も可能です。ベクトル版は全軸を多軸一括行列(MatrixBatch)でまとめて計算します。
 //! 
-//! @date 2020/04/02
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -17,6 +17,7 @@
 
 #include <tuple>
 #include "Matrix.hh"
+#include "MatrixBatch.hh"
 #include "Discret.hh"
 #include "ARCSeventlog.hh"
 
@@ -43,7 +44,7 @@ namespace ARCS {	// ARCS名前空間
 				  Ktn(TrqConst), Jmn(Inertia), l1(-Bandwidth), l2(-Bandwidth), l3(-Bandwidth),
 				  Ac(), Bc(), Ad(), Bd(), c(), u(), x(), x_next(), y(),
 				  Ktnv(), Jmnv(), l1v(), l2v(), l3v(),
-				  Acv(), Bcv(), Adv(), Bdv(), cv(), uv(), xv(), xv_next(), yv()
+				  Adv(), Bdv(), cv(), uv(), xv(), yv()
 			{
 				// オブザーバの構成によって状態方程式を変える
 				switch(T){
@@ -106,26 +107,30 @@ namespace ARCS {	// ARCS名前空間
 				  Ktn(), Jmn(), l1(), l2(), l3(),
 				  Ac(), Bc(), Ad(), Bd(), c(), u(), x(), x_next(), y(),
 				  Ktnv(TrqConst), Jmnv(Inertia), l1v(-Bandwidth), l2v(-Bandwidth), l3v(-Bandwidth),
-				  Acv(), Bcv(), Adv(), Bdv(), cv(), uv(), xv(), xv_next(), yv()
+				  Adv(), Bdv(), cv(), uv(), xv(), yv()
 			{
 				// ベクトルの長さだけ回す
 				for(size_t i = 1; i <= N; ++i){
+					Matrix<GetNA(),GetNA()> Aci;	// i軸目の連続系 A行列
+					Matrix<GetNB(),GetMB()> Bci;	// i軸目の連続系 B行列
+					Matrix<GetCX(),1> ci;			// i軸目の C行列
+					
 					// オブザーバの構成によって状態方程式を変える
 					switch(T){
 						// 同一次元0次オブザーバの場合
 						case DObType::FULL_0TH:
 							// 連続系A行列の設定
-							Acv[i-1].Set(
+							Aci.Set(
 								l1v[i] + l2v[i]      ,  -1.0/Jmnv[i],
 								Jmnv[i]*l1v[i]*l2v[i],       0
 							);
 							// 連続系B行列の設定
-							Bcv[i-1].Set(
+							Bci.Set(
 								Ktnv[i]/Jmnv[i],      - l1v[i] - l2v[i],
 											0, -Jmnv[i]*l1v[i]*l2v[i]
 							);
 							// C行列の設定
-							cv[i-1].Set(
+							ci.Set(
 								0, 1
 							);
 							break;
@@ -133,19 +138,19 @@ namespace ARCS {	// ARCS名前空間
 						// 同一次元1次オブザーバの場合
 						case DObType::FULL_1ST:
 							// 連続系のA行列
-							Acv[i-1].Set(
+							Aci.Set(
 								l1v[i] + l2v[i] + l3v[i]                               , -1.0/Jmnv[i],  0,
 								Jmnv[i]*(l1v[i]*l2v[i] + l2v[i]*l3v[i] + l3v[i]*l1v[i]), 0           ,  1,
 								-Jmnv[i]*l1v[i]*l2v[i]*l3v[i]                          , 0           ,  0
 							);
 							// 連続系のB行列
-							Bcv[i-1].Set(
+							Bci.Set(
 								Ktnv[i]/Jmnv[i], -( l1v[i] + l2v[i] + l3v[i] ),
 								0              , -Jmnv[i]*( l1v[i]*l2v[i] + l2v[i]*l3v[i] + l3v[i]*l1v[i] ),
 								0              , Jmnv[i]*l1v[i]*l2v[i]*l3v[i]
 							);
 							// C行列
-							cv[i-1].Set(
+							ci.Set(
 								0,  1,  0
 							);
 							break;
@@ -156,8 +161,13 @@ namespace ARCS {	// ARCS名前空間
 							break;
 					}
 					
-					// 離散化
-					std::tie(Adv[i-1], Bdv[i-1]) = Discret::GetDiscSystem(Acv[i-1], Bcv[i-1], Ts);
+					// 離散化して i軸目に格納
+					Matrix<GetNA(),GetNA()> Adi;
+					Matrix<GetNB(),GetMB()> Bdi;
+					std::tie(Adi, Bdi) = Discret::GetDiscSystem(Aci, Bci, Ts);
+					Adv.SetMatrix(i-1, Adi);
+					Bdv.SetMatrix(i-1, Bdi);
+					cv.SetMatrix(i-1, ci);
 				}
 				PassedLog();
 			}
@@ -169,7 +179,7 @@ namespace ARCS {	// ARCS名前空間
 				  Ac(right.Ac), Bc(right.Bc), Ad(right.Ad), Bd(right.Bd), c(right.c),
 				  u(right.u), x(right.x), x_next(right.x_next), y(right.y),
 				  Ktnv(), Jmnv(), l1v(), l2v(), l3v(),
-				  Acv(), Bcv(), Adv(), Bdv(), cv(), uv(), xv(), xv_next(), yv()
+				  Adv(), Bdv(), cv(), uv(), xv(), yv()
 			{
 				
 			}
@@ -189,8 +199,9 @@ namespace ARCS {	// ARCS名前空間
 					MotorSpeed
 				);
 				// 離散系状態方程式の計算
-				x_next = Ad*x + Bd*u;
-				y = c*x;
+				mul_into(x_next, Ad, x);
+				muladd_into(x_next, Bd, u);
+				mul_into(y, c, x);
 				// 状態ベクトルの更新
 				x = x_next;
 				// 出力ベクトルから抽出して返す
@@ -201,22 +212,14 @@ namespace ARCS {	// ARCS名前空間
 			//! @param [in] Current 電流 [A]
 			//! @param [in] MotorSpeed モータ側速度 [rad/s]
 			Matrix<1,N> GetDistTorque(Matrix<1,N> Current, Matrix<1,N> MotorSpeed){
+				// 全軸の入力ベクトルの設定
+				uv.SetLanes(1, 1, Current);
+				uv.SetLanes(1, 2, MotorSpeed);
+				// 全軸の離散系状態方程式をまとめて計算
+				statespace_step(xv, yv, Adv, Bdv, cv, uv);
+				// 出力ベクトルから抽出
 				Matrix<1,N> ret;
-				// ベクトルの長さだけ回す
-				for(size_t i = 0; i < N; ++i){
-					// 入力ベクトルの設定
-					uv[i].Set(
-						Current[i+1],
-						MotorSpeed[i+1]
-					);
-					// 離散系状態方程式の計算
-					xv_next[i] = Adv[i]*xv[i] + Bdv[i]*uv[i];
-					yv[i] = cv[i]*xv[i];
-					// 状態ベクトルの更新
-					xv[i] = xv_next[i];
-					// 出力ベクトルから抽出
-					ret[i+1] = yv[i][1];
-				}
+				yv.GetLanes(1, 1, ret);
 				return ret;
 			}
 			
@@ -228,14 +231,10 @@ namespace ARCS {	// ARCS名前空間
 					x_next.FillAllZero();	// 次の時刻の状態ベクトルもクリア
 				}else{
 					// ベクトル版のとき
-					// ベクトルの長さだけ回す
-					for(size_t i = 0; i < N; ++i){
-						xv[i].FillAllZero();		// 状態ベクトルをクリア
-						xv_next[i].FillAllZero();	// 次の時刻の状態ベクトルもクリア
-					}
+					xv.FillAllZero();	// 全軸の状態ベクトルをクリア
 				}
 			}
-			
+		
 		private:
 			DisturbanceObsrv(const DisturbanceObsrv&) = delete;					//!< コピーコンストラクタ使用禁止
 			const DisturbanceObsrv& operator=(const DisturbanceObsrv&) = delete;//!< 代入演算子使用禁止
@@ -301,15 +300,12 @@ namespace ARCS {	// ARCS名前空間
 			Matrix<1,N> l1v;	//!< [rad/s] オブザーバの極1
 			Matrix<1,N> l2v;	//!< [rad/s] オブザーバの極2
 			Matrix<1,N> l3v;	//!< [rad/s] オブザーバの極3
-			std::array<Matrix<GetNA(),GetNA()>, N> Acv;	//!<  連続系 A行列
-			std::array<Matrix<GetNB(),GetMB()>, N> Bcv;	//!<  連続系 B行列
-			std::array<Matrix<GetNA(),GetNA()>, N> Adv;	//!<  離散系 A行列
-			std::array<Matrix<GetNB(),GetMB()>, N> Bdv;	//!<  離散系 B行列
-			std::array<Matrix<GetCX(),1>, N> cv;		//!<  C行列
-			std::array<Matrix<1,2>, N> uv;				//!<  入力ベクトル
-			std::array<Matrix<1,GetCX()>, N> xv;		//!<  状態ベクトル
-			std::array<Matrix<1,GetCX()>, N> xv_next;	//!<  次の時刻の状態ベクトル
-			std::array<Matrix<1,1>, N> yv;				//!<  出力ベクトル
+			MatrixBatch<N,GetNA(),GetNA()> Adv;	//!<  全軸の離散系 A行列
+			MatrixBatch<N,GetNB(),GetMB()> Bdv;	//!<  全軸の離散系 B行列
+			MatrixBatch<N,GetCX(),1> cv;		//!<  全軸の C行列
+			MatrixBatch<N,1,2> uv;				//!<  全軸の入力ベクトル
+			MatrixBatch<N,1,GetCX()> xv;		//!<  全軸の状態ベクトル
+			MatrixBatch<N,1,1> yv;				//!<  全軸の出力ベクトル
 	};
 }
 
@@ -0,0 +1,13 @@
+//! @file DualNumber.cc
+//! @brief 二重数クラス(前進モード自動微分)
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+
+#include "DualNumber.hh"
+
+// テンプレートのため，実体もヘッダ側に実装。
@@ -0,0 +1,336 @@
+//! @file DualNumber.hh
+//! @brief 二重数クラス(前進モード自動微分)
+//!
+//! 値とK個の独立変数に関する偏微分係数を一緒に持ち運ぶ数の型。
+//! Matrix のデータ型 TT として使うと，非線形モデルのヤコビ行列が1回の評価で得られる。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・DualNumber<K> は値 Val と偏微分係数のベクトル Grad (長さK) を持ち，四則演算と初等関数で連鎖律に従って Grad も更新する。
+//   Grad の更新は長さKの単純なループなので，コンパイラの自動ベクトル化でSIMD命令になる。
+// ・N状態のモデル f(x) のヤコビ行列は，差分近似だと f を N+1 回評価する必要があるが，
+//   x の各要素を独立変数 DualNumber<N> として f を1回評価すれば，全ての偏微分係数が同時に得られる。
+//   差分近似のような刻み幅の選び方による誤差もない。
+// ・sin, cos, tan, exp, log, sqrt, tanh, abs, pow, atan2 に対応。
+//   実数と同じ書き方で呼べるように，テンプレート関数の中では「using std::sin; sin(x)」のように名前空間を付けずに呼ぶこと。
+// ・比較演算子は値 Val のみを比較するので，場合分けやピボット選択を含む計算もそのまま通る。
+// ・Matrix の行列積，加減算，要素ごとの関数(expe, tanhe など)，MatrixDecomposition の分解と求解で使用可能。
+// ・AutoDiff::Jacobian で，関数の値とヤコビ行列を一度に計算できる。
+
+#ifndef DUALNUMBER
+#define DUALNUMBER
+
+#include <cassert>
+#include <cmath>
+#include <array>
+#include <limits>
+#include "Matrix.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 二重数クラス(前進モード自動微分)
+//! @tparam	K	独立変数の数(偏微分係数の数)
+//! @tparam	TT	データ型(デフォルトはdouble型)
+template <size_t K, typename TT = double>
+class DualNumber {
+	public:
+		using value_type = TT;	//!< データ型
+		
+		//! @brief コンストラクタ(零)
+		constexpr DualNumber()
+			: Val(0), Grad()
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(定数，偏微分係数はすべて零)
+		//! @param[in]	x	値
+		constexpr DualNumber(const TT x)
+			: Val(x), Grad()
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(独立変数)
+		//! @param[in]	x	値
+		//! @param[in]	k	何番目の独立変数か(1始まり)
+		constexpr DualNumber(const TT x, const size_t k)
+			: Val(x), Grad()
+		{
+			arcs_assert(0 < k && k <= K);	// 範囲チェック
+			Grad[k - 1] = 1;
+		}
+		
+		//! @brief 連鎖律 y = f(x), dy = f'(x)*dx を計算する関数
+		//! @param[in]	x	引数
+		//! @param[in]	f	関数の値 f(x.Val)
+		//! @param[in]	df	導関数の値 f'(x.Val)
+		//! @return	結果
+		static constexpr DualNumber Chain(const DualNumber& x, const TT f, const TT df){
+			DualNumber y(f);
+			for(size_t k = 0; k < K; ++k) y.Grad[k] = df*x.Grad[k];
+			return y;
+		}
+		
+		//! @brief 単項プラス演算子
+		constexpr DualNumber operator+(void) const{
+			return (*this);
+		}
+		
+		//! @brief 単項マイナス演算子
+		constexpr DualNumber operator-(void) const{
+			return Chain(*this, -Val, -1);
+		}
+		
+		//! @brief 加算代入演算子
+		constexpr DualNumber& operator+=(const DualNumber& right){
+			Val += right.Val;
+			for(size_t k = 0; k < K; ++k) Grad[k] += right.Grad[k];
+			return (*this);
+		}
+		
+		//! @brief 減算代入演算子
+		constexpr DualNumber& operator-=(const DualNumber& right){
+			Val -= right.Val;
+			for(size_t k = 0; k < K; ++k) Grad[k] -= right.Grad[k];
+			return (*this);
+		}
+		
+		//! @brief 乗算代入演算子
+		constexpr DualNumber& operator*=(const DualNumber& right){
+			for(size_t k = 0; k < K; ++k) Grad[k] = right.Val*Grad[k] + Val*right.Grad[k];
+			Val *= right.Val;
+			return (*this);
+		}
+		
+		//! @brief 除算代入演算子
+		constexpr DualNumber& operator/=(const DualNumber& right){
+			Val /= right.Val;
+			const TT r = 1/right.Val;
+			for(size_t k = 0; k < K; ++k) Grad[k] = (Grad[k] - Val*right.Grad[k])*r;
+			return (*this);
+		}
+		
+		//! @brief 加算代入演算子(実数)
+		constexpr DualNumber& operator+=(const TT right){
+			Val += right;
+			return (*this);
+		}
+		
+		//! @brief 減算代入演算子(実数)
+		constexpr DualNumber& operator-=(const TT right){
+			Val -= right;
+			return (*this);
+		}
+		
+		//! @brief 乗算代入演算子(実数)
+		constexpr DualNumber& operator*=(const TT right){
+			Val *= right;
+			for(size_t k = 0; k < K; ++k) Grad[k] *= right;
+			return (*this);
+		}
+		
+		//! @brief 除算代入演算子(実数)
+		constexpr DualNumber& operator/=(const TT right){
+			return (*this) *= 1/right;
+		}
+		
+		//! @brief 加算演算子
+		friend constexpr DualNumber operator+(DualNumber left, const DualNumber& right){ return left += right; }
+		friend constexpr DualNumber operator+(DualNumber left, const TT right){ return left += right; }
+		friend constexpr DualNumber operator+(const TT left, DualNumber right){ return right += left; }
+		
+		//! @brief 減算演算子
+		friend constexpr DualNumber operator-(DualNumber left, const DualNumber& right){ return left -= right; }
+		friend constexpr DualNumber operator-(DualNumber left, const TT right){ return left -= right; }
+		friend constexpr DualNumber operator-(const TT left, const DualNumber& right){ return (-right) += left; }
+		
+		//! @brief 乗算演算子
+		friend constexpr DualNumber operator*(DualNumber left, const DualNumber& right){ return left *= right; }
+		friend constexpr DualNumber operator*(DualNumber left, const TT right){ return left *= right; }
+		friend constexpr DualNumber operator*(const TT left, DualNumber right){ return right *= left; }
+		
+		//! @brief 除算演算子
+		friend constexpr DualNumber operator/(DualNumber left, const DualNumber& right){ return left /= right; }
+		friend constexpr DualNumber operator/(DualNumber left, const TT right){ return left /= right; }
+		friend constexpr DualNumber operator/(const TT left, const DualNumber& right){
+			const TT y = left/right.Val;
+			return Chain(right, y, -y/right.Val);	// d(a/x) = -a/x^2 dx
+		}
+		
+		//! @brief 比較演算子(値のみを比較)
+		friend constexpr bool operator==(const DualNumber& left, const DualNumber& right){ return left.Val == right.Val; }
+		friend constexpr bool operator!=(const DualNumber& left, const DualNumber& right){ return left.Val != right.Val; }
+		friend constexpr bool operator< (const DualNumber& left, const DualNumber& right){ return left.Val <  right.Val; }
+		friend constexpr bool operator> (const DualNumber& left, const DualNumber& right){ return left.Val >  right.Val; }
+		friend constexpr bool operator<=(const DualNumber& left, const DualNumber& right){ return left.Val <= right.Val; }
+		friend constexpr bool operator>=(const DualNumber& left, const DualNumber& right){ return left.Val >= right.Val; }
+		friend constexpr bool operator==(const DualNumber& left, const TT right){ return left.Val == right; }
+		friend constexpr bool operator!=(const DualNumber& left, const TT right){ return left.Val != right; }
+		friend constexpr bool operator< (const DualNumber& left, const TT right){ return left.Val <  right; }
+		friend constexpr bool operator> (const DualNumber& left, const TT right){ return left.Val >  right; }
+		friend constexpr bool operator<=(const DualNumber& left, const TT right){ return left.Val <= right; }
+		friend constexpr bool operator>=(const DualNumber& left, const TT right){ return left.Val >= right; }
+		friend constexpr bool operator==(const TT left, const DualNumber& right){ return left == right.Val; }
+		friend constexpr bool operator!=(const TT left, const DualNumber& right){ return left != right.Val; }
+		friend constexpr bool operator< (const TT left, const DualNumber& right){ return left <  right.Val; }
+		friend constexpr bool operator> (const TT left, const DualNumber& right){ return left >  right.Val; }
+		friend constexpr bool operator<=(const TT left, const DualNumber& right){ return left <= right.Val; }
+		friend constexpr bool operator>=(const TT left, const DualNumber& right){ return left >= right.Val; }
+		
+		TT Val;					//!< 値
+		std::array<TT, K> Grad;	//!< 各独立変数に関する偏微分係数
+};
+
+//! @brief 正弦関数
+template <size_t K, typename TT>
+inline DualNumber<K,TT> sin(const DualNumber<K,TT>& x){
+	return DualNumber<K,TT>::Chain(x, std::sin(x.Val), std::cos(x.Val));
+}
+
+//! @brief 余弦関数
+template <size_t K, typename TT>
+inline DualNumber<K,TT> cos(const DualNumber<K,TT>& x){
+	return DualNumber<K,TT>::Chain(x, std::cos(x.Val), -std::sin(x.Val));
+}
+
+//! @brief 正接関数
+template <size_t K, typename TT>
+inline DualNumber<K,TT> tan(const DualNumber<K,TT>& x){
+	const TT y = std::tan(x.Val);
+	return DualNumber<K,TT>::Chain(x, y, 1 + y*y);
+}
+
+//! @brief 指数関数
+template <size_t K, typename TT>
+inline DualNumber<K,TT> exp(const DualNumber<K,TT>& x){
+	const TT y = std::exp(x.Val);
+	return DualNumber<K,TT>::Chain(x, y, y);
+}
+
+//! @brief 自然対数
+template <size_t K, typename TT>
+inline DualNumber<K,TT> log(const DualNumber<K,TT>& x){
+	return DualNumber<K,TT>::Chain(x, std::log(x.Val), 1/x.Val);
+}
+
+//! @brief 平方根 (x = 0 では偏微分係数は無限大になる)
+template <size_t K, typename TT>
+inline DualNumber<K,TT> sqrt(const DualNumber<K,TT>& x){
+	const TT y = std::sqrt(x.Val);
+	return DualNumber<K,TT>::Chain(x, y, 1/(2*y));
+}
+
+//! @brief 双曲線正接関数
+template <size_t K, typename TT>
+inline DualNumber<K,TT> tanh(const DualNumber<K,TT>& x){
+	const TT y = std::tanh(x.Val);
+	return DualNumber<K,TT>::Chain(x, y, 1 - y*y);
+}
+
+//! @brief 絶対値 (x = 0 では右側微分係数)
+template <size_t K, typename TT>
+constexpr DualNumber<K,TT> abs(const DualNumber<K,TT>& x){
+	return x.Val < 0 ? -x : x;
+}
+
+//! @brief べき乗 x^a (指数は実数)
+template <size_t K, typename TT>
+inline DualNumber<K,TT> pow(const DualNumber<K,TT>& x, const TT a){
+	const TT y = std::pow(x.Val, a - 1);
+	return DualNumber<K,TT>::Chain(x, y*x.Val, a*y);
+}
+
+//! @brief 逆正接関数 atan2(y, x)
+template <size_t K, typename TT>
+inline DualNumber<K,TT> atan2(const DualNumber<K,TT>& y, const DualNumber<K,TT>& x){
+	const TT r2 = x.Val*x.Val + y.Val*y.Val;
+	DualNumber<K,TT> z(std::atan2(y.Val, x.Val));
+	for(size_t k = 0; k < K; ++k) z.Grad[k] = (x.Val*y.Grad[k] - y.Val*x.Grad[k])/r2;
+	return z;
+}
+
+//! @brief 自動微分の補助関数群
+class AutoDiff {
+	public:
+		//! @brief 縦ベクトルの各要素を独立変数にした二重数の縦ベクトルを返す関数
+		//! @tparam	N	独立変数の数
+		//! @param[in]	x	独立変数の値
+		//! @return	二重数の縦ベクトル (k番目の要素の偏微分係数はk番目だけが1)
+		template <size_t N, typename TT>
+		static constexpr Matrix<1,N,DualNumber<N,TT>> Variables(const Matrix<1,N,TT>& x){
+			Matrix<1,N,DualNumber<N,TT>> ret;
+			for(size_t k = 0; k < N; ++k) ret.Data[0][k] = DualNumber<N,TT>(x.Data[0][k], k + 1);
+			return ret;
+		}
+		
+		//! @brief 二重数の行列から値の行列を取り出す関数
+		//! @param[in]	Y	二重数の行列
+		//! @return	値の行列
+		template <size_t NN, size_t MM, size_t K, typename TT>
+		static constexpr Matrix<NN,MM,TT> GetValue(const Matrix<NN,MM,DualNumber<K,TT>>& Y){
+			Matrix<NN,MM,TT> ret;
+			for(size_t i = 0; i < NN; ++i){
+				for(size_t j = 0; j < MM; ++j) ret.Data[i][j] = Y.Data[i][j].Val;
+			}
+			return ret;
+		}
+		
+		//! @brief 二重数の縦ベクトルからヤコビ行列を取り出す関数
+		//! @tparam	M	縦ベクトルの長さ(関数の出力の数)
+		//! @tparam	K	独立変数の数
+		//! @param[in]	y	二重数の縦ベクトル
+		//! @return	ヤコビ行列 (m行k列目が dy_m/dx_k)
+		template <size_t M, size_t K, typename TT>
+		static constexpr Matrix<K,M,TT> GetJacobian(const Matrix<1,M,DualNumber<K,TT>>& y){
+			Matrix<K,M,TT> J;
+			for(size_t k = 0; k < K; ++k){
+				for(size_t m = 0; m < M; ++m) J.Data[k][m] = y.Data[0][m].Grad[k];
+			}
+			return J;
+		}
+		
+		//! @brief 関数の値とヤコビ行列を計算する関数
+		//! @tparam	N	入力の数
+		//! @tparam	M	出力の数
+		//! @param[in]	func	関数 (Matrix<1,N,DualNumber<N,TT>> を受け取って Matrix<1,M,DualNumber<N,TT>> を返すこと)
+		//! @param[in]	x	入力
+		//! @param[out]	y	出力 y = func(x)
+		//! @param[out]	J	ヤコビ行列 J = df/dx
+		template <size_t N, size_t M, typename TT, typename F>
+		static void Jacobian(F&& func, const Matrix<1,N,TT>& x, Matrix<1,M,TT>& y, Matrix<N,M,TT>& J){
+			const Matrix<1,M,DualNumber<N,TT>> yd = func(Variables(x));	// 1回の評価ですべての偏微分係数を得る
+			y = GetValue(yd);
+			J = GetJacobian(yd);
+		}
+	
+	private:
+		AutoDiff() = delete;								//!< コンストラクタ使用禁止
+		AutoDiff(AutoDiff&& r) = delete;					//!< ムーブコンストラクタ使用禁止
+		AutoDiff(const AutoDiff&) = delete;					//!< コピーコンストラクタ使用禁止
+		const AutoDiff& operator=(const AutoDiff&) = delete;//!< 代入演算子使用禁止
+		~AutoDiff() = delete;								//!< デストラクタ使用禁止
+};
+}
+
+//! @brief 二重数の数値的な性質 (実数部のデータ型の性質をそのまま使う)
+template <size_t K, typename TT>
+class std::numeric_limits<ARCS::DualNumber<K,TT>> : public std::numeric_limits<TT> {};
+
+#endif
+
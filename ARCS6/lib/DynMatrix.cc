@@ -0,0 +1,17 @@
+//! @file DynMatrix.cc
+//! @brief 動的サイズ行列/ベクトル計算クラス(ヒープ版)
+//!
+//! 行列のサイズを実行時に決めてヒープ上に確保する，Matrixクラスの動的サイズ版。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+
+#include "DynMatrix.hh"
+
+// テンプレートのため，実体もヘッダ側に実装。
+
@@ -0,0 +1,870 @@
+//! @file DynMatrix.hh
+//! @brief 動的サイズ行列/ベクトル計算クラス(ヒープ版)
+//!
+//! 行列のサイズを実行時に決めてヒープ上に確保する，Matrixクラスの動的サイズ版。
+//! オフライン計算でのシステム同定やデータセット処理のような，数百～数千次元の大きな行列向け。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・データはMatrixと同じく列ごとに連続した並び(列優先)で，キャッシュラインの64バイト境界に揃えたヒープ領域に格納される。
+// ・サイズは実行時に決まるので，サイズの不一致はコンパイル時ではなく arcs_assert で検出される。
+// ・行列積はキャッシュブロッキングとレジスタタイリングをしたSIMD版(MatrixSIMD.hh)で計算される。
+// ・Matrixとの相互変換は，DynMatrix(const Matrix&)，ToMatrix<N,M>()，CopyTo(Matrix&) で行う。
+// ・LU分解，連立方程式の求解，逆行列，行列式，QR分解はMatrixと同じ名前・同じ意味の関数で計算できる。
+//   ただし solve と inv はLU分解を1回だけ行ってから複数の右辺をまとめて解くので，Matrix版よりも高速。
+// ・LU分解，前進/後退代入，QR分解はブロック版で，右側の列の更新をまとめて行列積で計算する。
+// ・行列積とブロック版の更新処理は MatrixThreadPool で列ごとに分けて並列に計算される(スレッド数は MatrixThreadPool::SetNumThreads で設定，初期値は1)。
+//   各要素の計算順序は列の分け方に依らないので，スレッド数を変えても結果はビット単位で同じ。
+// ・生成/代入/演算子のたびにヒープ確保が発生するので，実時間制御の周期処理の中では使用しないこと。
+
+#ifndef DYNMATRIX
+#define DYNMATRIX
+
+#include <string>
+#include <cmath>
+#include <cassert>
+#include <cstdio>
+#include <new>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include "Matrix.hh"
+#include "MatrixSIMD.hh"
+#include "MatrixThreadPool.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 動的サイズ行列/ベクトル計算クラス(ヒープ版)
+//! @tparam TT	データ型(デフォルトはdouble型)
+template <typename TT = double>
+class DynMatrix {
+	static_assert(std::is_floating_point_v<TT>, "DynMatrix: TT must be a floating point type");
+	
+	public:
+		//! @brief LU分解の際の並べ替えが偶数回/奇数回発生したことを返すための定義
+		enum LUperm {
+			ODD,	//!< 奇数
+			EVEN	//!< 偶数
+		};
+		
+		//! @brief コンストラクタ(空の行列)
+		DynMatrix()
+			: N(0), M(0), Data(Allocate(0))
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(零行列)
+		//! @param[in]	Width	行列の幅(列の数, 横)
+		//! @param[in]	Height	行列の高さ(行の数, 縦)
+		DynMatrix(const size_t Width, const size_t Height)
+			: N(Width), M(Height), Data(Allocate(Width*Height))
+		{
+			FillAllZero();
+		}
+		
+		//! @brief コピーコンストラクタ
+		//! @param[in]	right	右辺値
+		DynMatrix(const DynMatrix& right)
+			: N(right.N), M(right.M), Data(Allocate(right.N*right.M))
+		{
+			std::copy(right.Data.get(), right.Data.get() + N*M, Data.get());
+		}
+		
+		//! @brief ムーブコンストラクタ
+		//! @param[in]	right	右辺値
+		DynMatrix(DynMatrix&& right) noexcept
+			: N(right.N), M(right.M), Data(std::move(right.Data))
+		{
+			right.N = 0;
+			right.M = 0;
+		}
+		
+		//! @brief 固定サイズ行列からの変換コンストラクタ
+		//! @param[in]	right	固定サイズ行列
+		template <size_t NN, size_t MM>
+		explicit DynMatrix(const Matrix<NN,MM,TT>& right)
+			: N(NN), M(MM), Data(Allocate(NN*MM))
+		{
+			for(size_t i = 0; i < N; ++i) std::copy(right.Data[i].begin(), right.Data[i].end(), Column(i));
+		}
+		
+		//! @brief デストラクタ
+		~DynMatrix(){
+			
+		}
+		
+		//! @brief 代入演算子
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		DynMatrix& operator=(const DynMatrix& right){
+			if(this != &right){
+				Reallocate(right.N, right.M);
+				std::copy(right.Data.get(), right.Data.get() + N*M, Data.get());
+			}
+			return (*this);
+		}
+		
+		//! @brief ムーブ代入演算子
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		DynMatrix& operator=(DynMatrix&& right) noexcept{
+			if(this != &right){
+				N = right.N;
+				M = right.M;
+				Data = std::move(right.Data);
+				right.N = 0;
+				right.M = 0;
+			}
+			return (*this);
+		}
+		
+		//! @brief 固定サイズ行列からの代入演算子
+		//! @param[in]	right	固定サイズ行列
+		//! @return 結果
+		template <size_t NN, size_t MM>
+		DynMatrix& operator=(const Matrix<NN,MM,TT>& right){
+			Reallocate(NN, MM);
+			for(size_t i = 0; i < N; ++i) std::copy(right.Data[i].begin(), right.Data[i].end(), Column(i));
+			return (*this);
+		}
+		
+		//! @brief 固定サイズ行列に変換して返す関数
+		//! @tparam	NN	行列の幅
+		//! @tparam	MM	行列の高さ
+		//! @return	固定サイズ行列
+		template <size_t NN, size_t MM>
+		Matrix<NN,MM,TT> ToMatrix(void) const{
+			Matrix<NN,MM,TT> Y;
+			CopyTo(Y);
+			return Y;
+		}
+		
+		//! @brief 固定サイズ行列に書き出す関数
+		//! @param[out]	Y	固定サイズ行列
+		template <size_t NN, size_t MM>
+		void CopyTo(Matrix<NN,MM,TT>& Y) const{
+			arcs_assert(N == NN && M == MM);	// サイズチェック
+			for(size_t i = 0; i < N; ++i) std::copy(Column(i), Column(i) + M, Y.Data[i].begin());
+		}
+		
+		//! @brief 行列の幅(列の数, 横)を返す関数
+		//! @return	幅
+		size_t GetWidth(void) const{
+			return N;
+		}
+		
+		//! @brief 行列の高さ(行の数, 縦)を返す関数
+		//! @return	高さ
+		size_t GetHeight(void) const{
+			return M;
+		}
+		
+		//! @brief 行列のサイズを変更して零で埋める関数
+		//! @param[in]	Width	行列の幅(列の数, 横)
+		//! @param[in]	Height	行列の高さ(行の数, 縦)
+		void Resize(const size_t Width, const size_t Height){
+			Reallocate(Width, Height);
+			FillAllZero();
+		}
+		
+		//! @brief 指定した要素番号に値を設定する関数
+		//! @param[in]	n	n列目
+		//! @param[in]	m	m行目
+		//! @param[in]	val	設定する値
+		void SetElement(size_t n, size_t m, TT val){
+			arcs_assert(1 <= n && n <= N && 1 <= m && m <= M);	// サイズチェック
+			Data[(n - 1)*M + (m - 1)] = val;
+		}
+		
+		//! @brief 指定した要素番号の値を返す関数
+		//! @param[in]	n	n列目
+		//! @param[in]	m	m行目
+		//! @return	要素の値
+		TT GetElement(size_t n, size_t m) const{
+			arcs_assert(1 <= n && n <= N && 1 <= m && m <= M);	// サイズチェック
+			return Data[(n - 1)*M + (m - 1)];
+		}
+		
+		//! @brief 要素を参照する関数(「0」始まり，サイズチェックなし，Matrix の Data[n][m] に相当)
+		//! @param[in]	n	n列目(「0」始まり)
+		//! @param[in]	m	m行目(「0」始まり)
+		//! @return	要素への参照
+		TT& operator()(size_t n, size_t m){
+			return Data[n*M + m];
+		}
+		
+		//! @brief 要素を参照する関数(「0」始まり，サイズチェックなし，Matrix の Data[n][m] に相当)
+		//! @param[in]	n	n列目(「0」始まり)
+		//! @param[in]	m	m行目(「0」始まり)
+		//! @return	要素の値
+		TT operator()(size_t n, size_t m) const{
+			return Data[n*M + m];
+		}
+		
+		//! @brief 縦ベクトル添字演算子(GetElement(1,m)と同じ意味。ただしサイズチェックは行わない。)
+		//! @param[in]	m	要素番号(「1」始まり)
+		//! @return	要素への参照
+		TT& operator[](size_t m){
+			arcs_assert(m != 0);	// 「0」始まり防止チェック
+			return Data[m - 1];
+		}
+		
+		//! @brief 縦ベクトル添字演算子(GetElement(1,m)と同じ意味。ただしサイズチェックは行わない。)
+		//! @param[in]	m	要素番号(「1」始まり)
+		//! @return	要素の値
+		TT operator[](size_t m) const{
+			arcs_assert(m != 0);	// 「0」始まり防止チェック
+			return Data[m - 1];
+		}
+		
+		//! @brief n列目(「0」始まり)の先頭へのポインタを返す関数
+		//! @param[in]	n	n列目(「0」始まり)
+		//! @return	先頭へのポインタ(列の中の要素は連続している)
+		TT* Column(size_t n){
+			return Data.get() + n*M;
+		}
+		
+		//! @brief n列目(「0」始まり)の先頭へのポインタを返す関数
+		//! @param[in]	n	n列目(「0」始まり)
+		//! @return	先頭へのポインタ(列の中の要素は連続している)
+		const TT* Column(size_t n) const{
+			return Data.get() + n*M;
+		}
+		
+		//! @brief すべての要素を指定した値で埋める関数
+		//! @param[in] u 埋める値
+		void FillAll(TT u){
+			std::fill(Data.get(), Data.get() + N*M, u);
+		}
+		
+		//! @brief すべての要素を零で埋める関数
+		void FillAllZero(void){
+			FillAll(0);
+		}
+		
+		//! @brief 零行列を返す関数
+		//! @param[in]	Width	行列の幅
+		//! @param[in]	Height	行列の高さ
+		//! @return 零行列
+		static DynMatrix zeros(const size_t Width, const size_t Height){
+			return DynMatrix(Width, Height);
+		}
+		
+		//! @brief 1行列を返す関数
+		//! @param[in]	Width	行列の幅
+		//! @param[in]	Height	行列の高さ
+		//! @return 1行列
+		static DynMatrix ones(const size_t Width, const size_t Height){
+			DynMatrix Y(Width, Height);
+			Y.FillAll(1);
+			return Y;
+		}
+		
+		//! @brief 単位行列を返す関数
+		//! @param[in]	Size	行列のサイズ
+		//! @return 単位行列
+		static DynMatrix eye(const size_t Size){
+			DynMatrix Y(Size, Size);
+			for(size_t i = 0; i < Size; ++i) Y(i,i) = 1;
+			return Y;
+		}
+		
+		//! @brief 行列加算演算子 (行列＝行列＋行列の場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		DynMatrix operator+(const DynMatrix& right) const{
+			DynMatrix Y(*this);
+			Y += right;
+			return Y;
+		}
+		
+		//! @brief 行列減算演算子 (行列＝行列－行列の場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		DynMatrix operator-(const DynMatrix& right) const{
+			DynMatrix Y(*this);
+			Y -= right;
+			return Y;
+		}
+		
+		//! @brief 単項マイナス演算子
+		//! @return 結果
+		DynMatrix operator-(void) const{
+			DynMatrix Y(*this);
+			Y *= (TT)(-1);
+			return Y;
+		}
+		
+		//! @brief 行列乗算演算子 (行列＝行列＊行列の場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		DynMatrix operator*(const DynMatrix& right) const{
+			DynMatrix Y;
+			Y.Reallocate(right.N, M);
+			mul_into(Y, *this, right);
+			return Y;
+		}
+		
+		//! @brief 行列乗算演算子 (行列＝行列＊スカラーの場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		DynMatrix operator*(const TT& right) const{
+			DynMatrix Y(*this);
+			Y *= right;
+			return Y;
+		}
+		
+		//! @brief 行列除算演算子 (行列＝行列／スカラーの場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		DynMatrix operator/(const TT& right) const{
+			DynMatrix Y(*this);
+			for(size_t i = 0; i < N*M; ++i) Y.Data[i] /= right;
+			return Y;
+		}
+		
+		//! @brief 行列乗算演算子 (行列＝スカラー＊行列の場合)
+		//! @param[in] left		左側のスカラー値
+		//! @param[in] right	右側の行列
+		//! @return 結果
+		friend DynMatrix operator*(const TT& left, const DynMatrix& right){
+			return right*left;
+		}
+		
+		//! @brief 行列加算代入演算子 (行列＝行列＋行列の場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		DynMatrix& operator+=(const DynMatrix& right){
+			arcs_assert(N == right.N && M == right.M);	// サイズチェック
+			axpy(*this, (TT)1, right);
+			return (*this);
+		}
+		
+		//! @brief 行列減算代入演算子 (行列＝行列－行列の場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		DynMatrix& operator-=(const DynMatrix& right){
+			arcs_assert(N == right.N && M == right.M);	// サイズチェック
+			axpy(*this, (TT)(-1), right);
+			return (*this);
+		}
+		
+		//! @brief 行列乗算代入演算子 (行列＝行列＊スカラーの場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		DynMatrix& operator*=(const TT& right){
+			for(size_t i = 0; i < N*M; ++i) Data[i] *= right;
+			return (*this);
+		}
+		
+		//! @brief 行列のサイズの表示 (この関数はマクロを介して呼ばれることを想定している)
+		//! @param[in]	u		表示する行列
+		//! @param[in]	varname	変数名
+		friend void PrintMatSize_Macro(const DynMatrix& u, const std::string& varname){
+			printf("%s = [ %zu x %zu ]\n", varname.c_str(), u.N, u.M);
+		}
+		
+		//! @brief 行列の要素を表示 (書式指定あり版，この関数はマクロを介して呼ばれることを想定している)
+		//! @param[in]	u		表示する行列
+		//! @param[in]	format	表示形式 (%1.3e とか %5.3f とか printfと同じ)
+		//! @param[in]	varname	変数名
+		friend void PrintMatrix_Macro(const DynMatrix& u, const std::string& format, const std::string& varname){
+			printf("%s = \n", varname.c_str());
+			for(size_t j = 0; j < u.M; ++j){
+				printf("[ ");
+				for(size_t i = 0; i < u.N; ++i){
+					printf(format.c_str(), (double)u(i,j));
+					printf(" ");
+				}
+				printf("]\n");
+			}
+			printf("\n");
+		}
+		
+		//! @brief 行列の要素を表示 (書式指定なし版，この関数はマクロを介して呼ばれることを想定している)
+		//! @param[in]	u		表示する行列
+		//! @param[in]	varname	変数名
+		friend void PrintMat_Macro(const DynMatrix& u, const std::string& varname){
+			PrintMatrix_Macro(u, "% g", varname);
+		}
+		
+		//! @brief 転置行列を返す関数
+		//! @param[in]	U	入力行列
+		//! @return	結果
+		friend DynMatrix tp(const DynMatrix& U){
+			DynMatrix Y;
+			Y.Reallocate(U.M, U.N);
+			// 出力の列を連続に書き込み，入力は小さなブロックごとに読んでキャッシュラインを使い切る
+			constexpr size_t BS = 16;	// ブロックの大きさ
+			for(size_t j0 = 0; j0 < U.M; j0 += BS){
+				for(size_t i0 = 0; i0 < U.N; i0 += BS){
+					for(size_t j = j0; j < std::min(j0 + BS, U.M); ++j){
+						for(size_t i = i0; i < std::min(i0 + BS, U.N); ++i) Y(j,i) = U(i,j);
+					}
+				}
+			}
+			return Y;
+		}
+		
+		//! @brief 行列積を出力先に直接書き込む関数 Y = alpha*A*B
+		//! YはAともBとも異なる行列で，あらかじめ B の幅 × A の高さ に確保されていること
+		//! @param[out]	Y	出力行列
+		//! @param[in]	A	左側の行列
+		//! @param[in]	B	右側の行列
+		//! @param[in]	alpha	スカラー係数
+		friend void mul_into(DynMatrix& Y, const DynMatrix& A, const DynMatrix& B, const TT alpha = 1){
+			arcs_assert(A.N == B.M && Y.N == B.N && Y.M == A.M);	// サイズチェック
+			arcs_assert(&Y != &A && &Y != &B);						// 出力先と入力が同じでないかチェック
+			MatMul<false>(Y, A, B, alpha, (TT)0);
+		}
+		
+		//! @brief 行列積を出力先に累積加算する関数 Y = A*B + beta*Y
+		//! @param[in,out]	Y	入出力行列
+		//! @param[in]	A	左側の行列
+		//! @param[in]	B	右側の行列
+		//! @param[in]	beta	出力行列のスカラー係数
+		friend void muladd_into(DynMatrix& Y, const DynMatrix& A, const DynMatrix& B, const TT beta = 1){
+			arcs_assert(A.N == B.M && Y.N == B.N && Y.M == A.M);	// サイズチェック
+			arcs_assert(&Y != &A && &Y != &B);						// 出力先と入力が同じでないかチェック
+			MatMul<true>(Y, A, B, (TT)1, beta);
+		}
+		
+		//! @brief スカラー倍した行列を出力先に累積加算する関数 Y = Y + a*X
+		//! @param[in,out]	Y	入出力行列
+		//! @param[in]	a	スカラー係数
+		//! @param[in]	X	入力行列
+		friend void axpy(DynMatrix& Y, const TT a, const DynMatrix& X){
+			arcs_assert(Y.N == X.N && Y.M == X.M);	// サイズチェック
+			Axpy(Y.Data.get(), a, X.Data.get(), Y.N*Y.M);
+		}
+		
+		//! @brief LU分解 (Matrix版と同じく部分ピボット選択付きで，Lの対角要素は1)
+		//! @param[in]	A	入力行列(正方行列)
+		//! @param[out]	L	下三角行列
+		//! @param[out]	U	上三角行列
+		//! @param[out]	v	並べ替え記憶列ベクトル(「1」始まりの行番号)
+		//! @return	並べ替えが偶数回/奇数回
+		friend LUperm LU(const DynMatrix& A, DynMatrix& L, DynMatrix& U, std::vector<int>& v){
+			arcs_assert(A.N == A.M);	// 正方行列かチェック
+			const size_t n = A.N;
+			DynMatrix X(A);
+			std::vector<size_t> piv;
+			const size_t perm_count = LUfactor(X, piv);
+			
+			// 並べ替え記憶列ベクトルに行の交換を反映
+			v.resize(n);
+			for(size_t i = 0; i < n; ++i) v[i] = i + 1;
+			for(size_t k = 0; k < n; ++k) std::swap(v[k], v[piv[k]]);
+			
+			// 下三角行列と上三角行列に分離する
+			L.Resize(n, n);
+			U.Resize(n, n);
+			for(size_t j = 0; j < n; ++j){
+				L(j,j) = 1;	// 下三角行列の対角要素はすべて1
+				std::copy(X.Column(j) + j + 1, X.Column(j) + n, L.Column(j) + j + 1);	// 下三角のみコピー
+				std::copy(X.Column(j), X.Column(j) + j + 1, U.Column(j));				// 上三角のみコピー
+			}
+			return perm_count % 2 == 0 ? EVEN : ODD;
+		}
+		
+		//! @brief Ax = b の形の線形連立1次方程式をxについて解く関数 (bは複数列でもよい)
+		//! LU分解を1回だけ行って，bの各列について前進代入と後退代入をする
+		//! @param[in]	A	係数行列(正方行列)
+		//! @param[in]	b	右辺の行列/縦ベクトル
+		//! @param[out]	x	解の行列/縦ベクトル
+		friend void solve(const DynMatrix& A, const DynMatrix& b, DynMatrix& x){
+			arcs_assert(A.N == A.M && b.M == A.M);	// サイズチェック
+			DynMatrix X(A);
+			std::vector<size_t> piv;
+			LUfactor(X, piv);
+			x = b;
+			LUsolve(X, piv, x);
+		}
+		
+		//! @brief Ax = b の形の線形連立1次方程式をxについて解く関数 (戻り値で返す版)
+		//! @param[in]	A	係数行列(正方行列)
+		//! @param[in]	b	右辺の行列/縦ベクトル
+		//! @return	解の行列/縦ベクトル
+		friend DynMatrix solve(const DynMatrix& A, const DynMatrix& b){
+			DynMatrix x;
+			solve(A, b, x);
+			return x;
+		}
+		
+		//! @brief 行列式の値を返す関数
+		//! @param[in]	A	入力行列(正方行列)
+		//! @return	結果
+		friend TT det(const DynMatrix& A){
+			arcs_assert(A.N == A.M);	// 正方行列かチェック
+			DynMatrix X(A);
+			std::vector<size_t> piv;
+			const size_t perm_count = LUfactor(X, piv);
+			// |A| = |L||U| でしかもLの対角要素は1なので，Uの対角要素の総積に並べ替え回数の符号を掛ける
+			TT y = perm_count % 2 == 0 ? 1 : -1;
+			for(size_t i = 0; i < A.N; ++i) y *= X(i,i);
+			return y;
+		}
+		
+		//! @brief 逆行列を返す関数
+		//! LU分解を1回だけ行って，単位行列の各列について前進代入と後退代入をする
+		//! @param[in]	A	入力行列(正方行列)
+		//! @return	結果
+		friend DynMatrix inv(const DynMatrix& A){
+			arcs_assert(A.N == A.M);	// 正方行列かチェック
+			DynMatrix X(A);
+			std::vector<size_t> piv;
+			LUfactor(X, piv);
+			DynMatrix Ainv = DynMatrix::eye(A.N);
+			LUsolve(X, piv, Ainv);
+			return Ainv;
+		}
+		
+		//! @brief QR分解 (Matrix版と同じくハウスホルダー変換を使い，A = QR)
+		//! QR_BLOCK 列ごとのブロック版。ブロックの中は1列ずつ反射して，ブロック内の反射をまとめた H = I - V*T*V^T を
+		//! 右側の列とQに行列積で作用させる。反射行列Hは陽に作らない。右側の列の更新は列ごとに分けて並列に計算する
+		//! @param[in]	A	入力行列 (N列×M行)
+		//! @param[out]	Q	直交行列 (M列×M行)
+		//! @param[out]	R	上三角行列 (N列×M行)
+		friend void QR(const DynMatrix& A, DynMatrix& Q, DynMatrix& R){
+			const size_t K = std::min(A.N, A.M);
+			R = A;
+			DynMatrix V(K, A.M);		// 反射ベクトル
+			std::vector<TT> tau(K, 0);	// 反射の係数 H = I - tau*v*v^T
+			DynMatrix T;				// ブロック内の反射をまとめた上三角行列
+			for(size_t k0 = 0; k0 < K; k0 += QR_BLOCK){
+				const size_t k1 = std::min(k0 + QR_BLOCK, K);
+				for(size_t k = k0; k < k1; ++k){
+					// k列目のk行目以降を反射して零にするベクトル v = a + sgn(a1)*|a|*e を作る
+					const TT* a = R.Column(k);
+					TT* v = V.Column(k);
+					TT norm2 = 0;
+					for(size_t i = k; i < A.M; ++i) norm2 += a[i]*a[i];
+					std::copy(a + k, a + A.M, v + k);
+					v[k] += sgn(a[k])*std::sqrt(norm2);
+					TT vTv = 0;
+					for(size_t i = k; i < A.M; ++i) vTv += v[i]*v[i];
+					if(vTv == 0) continue;	// 零ベクトルのときは反射しない
+					tau[k] = 2/vTv;
+					// ブロック内の列に R = H*R = R - tau*v*(v^T*R)
+					for(size_t j = k; j < k1; ++j) Reflect(R.Column(j), v, k, A.M, tau[k]);
+				}
+				// ブロックより右側の列に (H_k0*…*H_k1)^T = I - V*T^T*V^T を作用させる
+				BuildBlockReflector(V, tau, k0, k1, T);
+				ApplyBlockReflector<true>(R, k1, A.N, V, T, k0, k1);
+			}
+			// Q = H1*H2*…*HK をブロックごとに右側から順に単位行列に作用させて組み立てる
+			Q = DynMatrix::eye(A.M);
+			for(size_t k0 = (K + QR_BLOCK - 1)/QR_BLOCK*QR_BLOCK; 0 < k0;){
+				k0 -= QR_BLOCK;
+				const size_t k1 = std::min(k0 + QR_BLOCK, K);
+				BuildBlockReflector(V, tau, k0, k1, T);
+				ApplyBlockReflector<false>(Q, k0, A.M, V, T, k0, k1);
+			}
+		}
+	
+	private:
+		static constexpr size_t ALIGN = 64;			//!< データ格納用領域のアライメント [bytes]
+		static constexpr TT epsilon = (TT)1e-12;	//!< 零とみなす閾値(Matrix版と同じ)
+		static constexpr size_t LU_BLOCK = 64;		//!< ブロック版LU分解と前進/後退代入のブロックの列数
+		static constexpr size_t QR_BLOCK = 32;		//!< ブロック版QR分解のブロックの列数
+		static constexpr size_t PAR_GRAIN = 32;		//!< 並列計算で各スレッドに割り振る列数の単位
+		
+		//! @brief アライメント付きヒープ領域の解放
+		struct AlignedDelete {
+			void operator()(TT* p) const{
+				::operator delete[](p, std::align_val_t(ALIGN));
+			}
+		};
+		
+		size_t N;	//!< 行列の幅(列の数, 横)
+		size_t M;	//!< 行列の高さ(行の数, 縦)
+		std::unique_ptr<TT[], AlignedDelete> Data;	//!< データ格納用領域 要素の順番は Data[n列目*M + m行目] (列優先)
+		
+		//! @brief アライメント付きのヒープ領域を確保する関数(初期化はしない)
+		//! @param[in]	L	要素数
+		//! @return	確保した領域
+		static std::unique_ptr<TT[], AlignedDelete> Allocate(const size_t L){
+			return std::unique_ptr<TT[], AlignedDelete>(static_cast<TT*>(::operator new[](sizeof(TT)*L, std::align_val_t(ALIGN))));
+		}
+		
+		//! @brief 要素数が変わるときだけ領域を確保し直す関数(初期化はしない)
+		//! @param[in]	Width	行列の幅
+		//! @param[in]	Height	行列の高さ
+		void Reallocate(const size_t Width, const size_t Height){
+			if(Width*Height != N*M) Data = Allocate(Width*Height);
+			N = Width;
+			M = Height;
+		}
+		
+		//! @brief 符号関数(Matrix版と同じく0のときは1)
+		//! @param[in]	u	入力
+		//! @return	符号結果
+		static TT sgn(const TT u){
+			return (TT)0 <= u ? (TT)1 : (TT)(-1);
+		}
+		
+		//! @brief スカラー倍の加算 y = y + a*x
+		//! @param[in,out]	y	入出力配列
+		//! @param[in]	a	スカラー係数
+		//! @param[in]	x	入力配列
+		//! @param[in]	L	要素数
+		static void Axpy(TT* y, const TT a, const TT* x, const size_t L){
+			if constexpr(MatrixSIMD::isEnabled<TT>()){
+				MatrixSIMD::Axpy(y, a, x, L);	// SIMD版
+			}else{
+				for(size_t i = 0; i < L; ++i) y[i] += a*x[i];
+			}
+		}
+		
+		//! @brief 列ベクトルのk行目以降にハウスホルダー反射を作用させる関数 x = x - tau*v*(v^T*x)
+		//! @param[in,out]	x	列ベクトルの先頭
+		//! @param[in]	v	反射ベクトルの先頭
+		//! @param[in]	k	開始行
+		//! @param[in]	L	行数
+		//! @param[in]	tau	反射の係数 2/(v^T*v)
+		static void Reflect(TT* x, const TT* v, const size_t k, const size_t L, const TT tau){
+			TT vTx = 0;
+			for(size_t i = k; i < L; ++i) vTx += v[i]*x[i];
+			Axpy(x + k, -tau*vTx, v + k, L - k);
+		}
+		
+		//! @brief k0～k1-1列目の反射をまとめた H_k0*…*H_k1 = I - V*T*V^T の上三角行列Tを作る関数
+		//! @param[in]	V	反射ベクトル (k列目のk行目より上は零)
+		//! @param[in]	tau	反射の係数
+		//! @param[in]	k0	開始列
+		//! @param[in]	k1	終了列(この列は含まない)
+		//! @param[out]	T	上三角行列
+		static void BuildBlockReflector(const DynMatrix& V, const std::vector<TT>& tau, const size_t k0, const size_t k1, DynMatrix& T){
+			const size_t kb = k1 - k0;
+			T.Resize(kb, kb);
+			std::vector<TT> w(kb);
+			for(size_t i = 0; i < kb; ++i){
+				// T の i列目 = -tau_i * T(0～i-1, 0～i-1) * V(k0～k0+i-1列目)^T * v_i
+				const TT* vi = V.Column(k0 + i);
+				for(size_t j = 0; j < i; ++j){
+					const TT* vj = V.Column(k0 + j);
+					TT t = 0;
+					for(size_t r = k0 + i; r < V.M; ++r) t += vj[r]*vi[r];
+					w[j] = t;
+				}
+				for(size_t r = 0; r < i; ++r){
+					TT t = 0;
+					for(size_t j = r; j < i; ++j) t += T(j,r)*w[j];
+					T(i,r) = -tau[k0 + i]*t;
+				}
+				T(i,i) = tau[k0 + i];
+			}
+		}
+		
+		//! @brief 行列Cのc0～c1-1列目のk0行目以降に I - V*op(T)*V^T を作用させる関数 (列ごとに分けて並列に計算)
+		//! @tparam	TRANS	true = op(T) は T^T，false = op(T) は T
+		//! @param[in,out]	C	入出力行列
+		//! @param[in]	c0	開始列
+		//! @param[in]	c1	終了列(この列は含まない)
+		//! @param[in]	V	反射ベクトル
+		//! @param[in]	T	BuildBlockReflector で作った上三角行列
+		//! @param[in]	k0	反射ベクトルの開始列
+		//! @param[in]	k1	反射ベクトルの終了列(この列は含まない)
+		template <bool TRANS>
+		static void ApplyBlockReflector(DynMatrix& C, const size_t c0, const size_t c1, const DynMatrix& V, const DynMatrix& T, const size_t k0, const size_t k1){
+			const size_t kb = k1 - k0;
+			const size_t L = C.M - k0;	// 作用させる行数
+			// 反射ベクトルを転置しておく (W = V^T*C を普通の行列積で計算するため)
+			DynMatrix Vt(L, kb);
+			for(size_t j = 0; j < kb; ++j){
+				for(size_t r = 0; r < L; ++r) Vt(r,j) = V(k0 + j, k0 + r);
+			}
+			MatrixThreadPool::ParallelFor(c0, c1, PAR_GRAIN, [&](size_t j0, size_t j1){
+				const size_t nc = j1 - j0;
+				std::vector<TT> W(kb*nc), Z(kb);
+				GemmKernel<false>(W.data(), kb, Vt.Column(0), kb, C.Column(j0) + k0, C.M, L, kb, nc, (TT)1, (TT)0);	// W = V^T*C
+				for(size_t c = 0; c < nc; ++c){
+					// W = op(T)*W (上三角なので列ごとに計算)
+					TT* w = W.data() + c*kb;
+					for(size_t r = 0; r < kb; ++r){
+						TT t = 0;
+						if constexpr(TRANS){
+							for(size_t j = 0; j <= r; ++j) t += T(r,j)*w[j];
+						}else{
+							for(size_t j = r; j < kb; ++j) t += T(j,r)*w[j];
+						}
+						Z[r] = t;
+					}
+					std::copy(Z.begin(), Z.end(), w);
+				}
+				GemmKernel<true>(C.Column(j0) + k0, C.M, V.Column(k0) + k0, V.M, W.data(), kb, kb, L, nc, (TT)(-1), (TT)1);	// C = C - V*W
+			});
+		}
+		
+		//! @brief 部分行列の行列積 Y = s*A*B (ACC = false), Y = s*A*B + beta*Y (ACC = true)
+		//! 各要素の積和の順序は出力の列の分け方に依らないので，列ごとに分けて並列に計算しても結果は変わらない
+		//! @param[in,out]	Y	出力行列の先頭 (K列×M行)
+		//! @param[in]	ldy	Yの列の先頭どうしの間隔
+		//! @param[in]	A	左側の行列の先頭 (N列×M行)
+		//! @param[in]	lda	Aの列の先頭どうしの間隔
+		//! @param[in]	B	右側の行列の先頭 (K列×N行)
+		//! @param[in]	ldb	Bの列の先頭どうしの間隔
+		//! @param[in]	N	Aの列数 = Bの行数
+		//! @param[in]	M	Aの行数
+		//! @param[in]	K	Bの列数
+		//! @param[in]	s	行列積のスカラー係数
+		//! @param[in]	beta	出力行列のスカラー係数 (ACC = true のときのみ)
+		template <bool ACC>
+		static void GemmKernel(TT* Y, const size_t ldy, const TT* A, const size_t lda, const TT* B, const size_t ldb, const size_t N, const size_t M, const size_t K, const TT s, const TT beta){
+			if(M == 0 || K == 0) return;
+			if constexpr(MatrixSIMD::isEnabled<TT>()){
+				// SIMD版 (キャッシュブロッキング＋レジスタタイリング)
+				MatrixSIMD::MatMulDynamic<ACC>(Y, ldy, A, lda, B, ldb, N, M, K, s, beta);
+			}else{
+				// 普通のループ版 (出力の1列ごとにAの列をスカラー倍して累積加算する)
+				for(size_t k = 0; k < K; ++k){
+					TT* y = Y + k*ldy;
+					for(size_t j = 0; j < M; ++j) y[j] = ACC ? beta*y[j] : 0;
+					for(size_t i = 0; i < N; ++i) Axpy(y, s*B[k*ldb + i], A + i*lda, M);
+				}
+			}
+		}
+		
+		//! @brief 行列積 Y = s*A*B (ACC = false), Y = s*A*B + beta*Y (ACC = true)
+		//! 出力の列ごとに分けて並列に計算する
+		template <bool ACC>
+		static void MatMul(DynMatrix& Y, const DynMatrix& A, const DynMatrix& B, const TT s, const TT beta){
+			MatrixThreadPool::ParallelFor(0, B.N, PAR_GRAIN, [&](size_t k0, size_t k1){
+				GemmKernel<ACC>(Y.Column(k0), Y.M, A.Column(0), A.M, B.Column(k0), B.M, A.N, A.M, k1 - k0, s, beta);
+			});
+		}
+		
+		//! @brief 部分ピボット選択付きLU分解をその場で計算する関数
+		//! LU_BLOCK 列ごとのブロック版。ブロックの中は1列ずつ分解して，右側の列の更新はまとめて行列積で計算する。
+		//! 右側の列の更新は列ごとに分けて並列に計算するので，スレッド数に依らず結果は同じ
+		//! @param[in,out]	X	入力行列 → 対角より下にL(対角要素1は省略)，対角と上にU
+		//! @param[out]	piv	k行目と交換した行番号(「0」始まり)
+		//! @return	行の交換回数
+		static size_t LUfactor(DynMatrix& X, std::vector<size_t>& piv){
+			const size_t n = X.N;
+			size_t perm_count = 0;
+			piv.resize(n);
+			std::vector<bool> skip(n, false);	// 対角要素が零で分解を飛ばした列
+			for(size_t k0 = 0; k0 < n; k0 += LU_BLOCK){
+				const size_t k1 = std::min(k0 + LU_BLOCK, n);
+				// ブロック内の列のLU分解 (行の交換はブロック内の列だけに行う)
+				for(size_t k = k0; k < k1; ++k){
+					// k列目の中で絶対値が最大の行を探す
+					TT* xk = X.Column(k);
+					size_t p = k;
+					TT max_buff = std::abs(xk[k]);
+					for(size_t i = k + 1; i < n; ++i){
+						if(max_buff < std::abs(xk[i])){
+							p = i;
+							max_buff = std::abs(xk[i]);
+						}
+					}
+					piv[k] = p;
+					if(p != k){
+						for(size_t j = k0; j < k1; ++j) std::swap(X(j,k), X(j,p));
+						++perm_count;
+					}
+					if(max_buff < epsilon){
+						// 対角要素が零なら，k列目においてはLU分解が終わっているので以下はスキップ
+						skip[k] = true;
+						continue;
+					}
+					for(size_t i = k + 1; i < n; ++i) xk[i] /= xk[k];	// 対角要素で除算
+					for(size_t j = k + 1; j < k1; ++j){
+						TT* xj = X.Column(j);
+						if(xj[k] != 0) Axpy(xj + k + 1, -xj[k], xk + k + 1, n - k - 1);
+					}
+				}
+				// ブロックより左側の列に行の交換を反映
+				MatrixThreadPool::ParallelFor(0, k0, PAR_GRAIN, [&](size_t j0, size_t j1){
+					for(size_t j = j0; j < j1; ++j){
+						for(size_t k = k0; k < k1; ++k) std::swap(X(j,k), X(j,piv[k]));
+					}
+				});
+				// ブロックより右側の列に行の交換を反映して更新
+				MatrixThreadPool::ParallelFor(k1, n, PAR_GRAIN, [&](size_t j0, size_t j1){
+					for(size_t j = j0; j < j1; ++j){
+						TT* xj = X.Column(j);
+						for(size_t k = k0; k < k1; ++k) std::swap(xj[k], xj[piv[k]]);
+						// ブロック内の行は L11 の前進代入 U12 = L11^(-1)*A12
+						for(size_t k = k0; k < k1; ++k){
+							if(skip[k] == false && xj[k] != 0) Axpy(xj + k + 1, -xj[k], X.Column(k) + k + 1, k1 - k - 1);
+						}
+					}
+					// ブロックより下の行は行列積 A22 = A22 - L21*U12 (分解を飛ばした列は除く)
+					for(size_t r0 = k0; r0 < k1;){
+						if(skip[r0] == true){
+							++r0;
+							continue;
+						}
+						size_t r1 = r0 + 1;
+						while(r1 < k1 && skip[r1] == false) ++r1;
+						GemmKernel<true>(X.Column(j0) + k1, n, X.Column(r0) + k1, n, X.Column(j0) + r0, n, r1 - r0, n - k1, j1 - j0, (TT)(-1), (TT)1);
+						r0 = r1;
+					}
+				});
+			}
+			return perm_count;
+		}
+		
+		//! @brief LU分解済みの行列で AX = B を解く関数 (BはXで上書きされる)
+		//! 前進代入と後退代入も LU_BLOCK 行ごとのブロック版で，ブロックの外側との積和は行列積で計算する。
+		//! 右辺の列ごとに分けて並列に計算する
+		//! @param[in]	LUX	LUfactor でその場LU分解した行列
+		//! @param[in]	piv	LUfactor の行の交換
+		//! @param[in,out]	B	右辺の行列 → 解の行列
+		static void LUsolve(const DynMatrix& LUX, const std::vector<size_t>& piv, DynMatrix& B){
+			const size_t n = LUX.N;
+			MatrixThreadPool::ParallelFor(0, B.N, PAR_GRAIN, [&](size_t c0, size_t c1){
+				for(size_t r = c0; r < c1; ++r){
+					TT* x = B.Column(r);
+					for(size_t k = 0; k < n; ++k) std::swap(x[k], x[piv[k]]);	// 右辺も並べ替える
+				}
+				// Ld = b の前進代入 (Lの対角要素は1)
+				for(size_t k0 = 0; k0 < n; k0 += LU_BLOCK){
+					const size_t k1 = std::min(k0 + LU_BLOCK, n);
+					for(size_t r = c0; r < c1; ++r){
+						TT* x = B.Column(r);
+						for(size_t k = k0; k < k1; ++k){
+							if(x[k] != 0) Axpy(x + k + 1, -x[k], LUX.Column(k) + k + 1, k1 - k - 1);
+						}
+					}
+					GemmKernel<true>(B.Column(c0) + k1, n, LUX.Column(k0) + k1, n, B.Column(c0) + k0, n, k1 - k0, n - k1, c1 - c0, (TT)(-1), (TT)1);
+				}
+				// Ux = d の後退代入
+				for(size_t k1 = n; 0 < k1;){
+					const size_t k0 = k1 - std::min(k1, LU_BLOCK);
+					for(size_t r = c0; r < c1; ++r){
+						TT* x = B.Column(r);
+						for(size_t k = k1; k0 < k--;){
+							x[k] /= LUX(k,k);
+							if(x[k] != 0) Axpy(x + k0, -x[k], LUX.Column(k) + k0, k - k0);
+						}
+					}
+					GemmKernel<true>(B.Column(c0), n, LUX.Column(k0), n, B.Column(c0) + k0, n, k1 - k0, k0, c1 - c0, (TT)(-1), (TT)1);
+					k1 = k0;
+				}
+			});
+		}
+};
+}
+
+#endif
+
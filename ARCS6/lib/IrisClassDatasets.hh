@@ -4,10 +4,10 @@
 //! 機械学習の試験用ための，アヤメの「ガク，花びらの計測値」と「アヤメの種類の分類」のデータセットを集めたクラス
 //! Softmax関数用の分類確率ベクトル版
 //!
-//! @date 2020/05/17
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -90,7 +90,7 @@ class IrisClassDatasets {
 		//! @param[out]	Y	計測データ
 		void GetMeasuredBatchData(const size_t i, Matrix<M,N>& Y){
 			arcs_assert(i <= FinalMinbatNum);	// ミニバッチ番号の範囲チェック
-			Y = BatchProcessor::GetMiniBatchData<N,D,M>(MeasuredData, i);	// データセットを切り出してミニバッチにする
+			Y = BatchProcessor::GetMiniBatchView<N,D,M>(MeasuredData, i);	// データセットから直接ミニバッチへコピーする
 		}
 		
 		//! @brief i番目のミニバッチ分類データを取得する関数
@@ -98,7 +98,7 @@ class IrisClassDatasets {
 		//! @param[out]	y	訓練データ
 		void GetClassBatchData(const size_t i, Matrix<M,C>& y){
 			arcs_assert(i <= FinalMinbatNum);	// ミニバッチ番号の範囲チェック
-			y = BatchProcessor::GetMiniBatchData<C,D,M>(ClassData, i);		// データセットを切り出してミニバッチにする
+			y = BatchProcessor::GetMiniBatchView<C,D,M>(ClassData, i);		// データセットから直接ミニバッチへコピーする
 		}
 		
 		//! @brief データセットをシャッフルする関数
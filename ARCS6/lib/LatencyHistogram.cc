@@ -0,0 +1,132 @@
+//! @file LatencyHistogram.cc
+//! @brief 遅延時間ヒストグラムクラス
+//!
+//! 制御周期や消費時間などの時間の分布を固定長の対数バケット(HDRヒストグラム形式)に数え上げて，パーセンタイルを計算する。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "LatencyHistogram.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+	#include "ARCSeventlog.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+	#define PassedLog()
+	#define EventLog(a)
+	#define EventLogVar(a)
+#endif
+
+using namespace ARCS;
+
+//! @brief コンストラクタ
+LatencyHistogram::LatencyHistogram()
+	: Counts(), Total(0), MaxValue(0), MinValue(std::numeric_limits<uint64_t>::max())
+{
+	for(auto& c : Counts) c.store(0, std::memory_order_relaxed);
+}
+
+//! @brief コピーコンストラクタ
+//! @param[in]	r	コピー元
+LatencyHistogram::LatencyHistogram(const LatencyHistogram& r)
+	: Counts(),
+	  Total(r.Total.load(std::memory_order_relaxed)),
+	  MaxValue(r.MaxValue.load(std::memory_order_relaxed)),
+	  MinValue(r.MinValue.load(std::memory_order_relaxed))
+{
+	for(size_t i = 0; i < BUCKETS; ++i) Counts[i].store(r.Counts[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+//! @brief デストラクタ
+LatencyHistogram::~LatencyHistogram(){
+	
+}
+
+//! @brief 記録をすべて消去する関数 (記録側のスレッドが止まっているときに呼ぶこと)
+void LatencyHistogram::Reset(void){
+	for(auto& c : Counts) c.store(0, std::memory_order_relaxed);
+	Total.store(0, std::memory_order_relaxed);
+	MaxValue.store(0, std::memory_order_relaxed);
+	MinValue.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+}
+
+//! @brief 記録した値の個数を返す関数
+//! @return	個数
+uint64_t LatencyHistogram::GetCount(void) const {
+	return Total.load(std::memory_order_relaxed);
+}
+
+//! @brief 記録した値の最大値を返す関数
+//! @return	[ns] 最大値 (記録が無いときは零)
+uint64_t LatencyHistogram::GetMax(void) const {
+	return MaxValue.load(std::memory_order_relaxed);
+}
+
+//! @brief 記録した値の最小値を返す関数
+//! @return	[ns] 最小値 (記録が無いときは零)
+uint64_t LatencyHistogram::GetMin(void) const {
+	if(GetCount() == 0) return 0;
+	return MinValue.load(std::memory_order_relaxed);
+}
+
+//! @brief 記録した値のパーセンタイルを返す関数
+//! 小さい方から数えて Percent [%] 番目の値が入っているバケットの上限値を返す (ただし最大値は超えない)。
+//! @param[in]	Percent	[%] パーセンタイル (例えば 99.9)
+//! @return	[ns] パーセンタイル値 (記録が無いときは零)
+uint64_t LatencyHistogram::GetPercentile(const double Percent) const {
+	arcs_assert(0 <= Percent && Percent <= 100);	// 範囲チェック
+	
+	// 記録中に読み出しても辻褄が合うように，合計もバケットから数え直す
+	uint64_t Sum = 0;
+	for(const auto& c : Counts) Sum += c.load(std::memory_order_relaxed);
+	if(Sum == 0) return 0;
+	
+	// 目標の順位に達するバケットを探す
+	const uint64_t Rank = std::max<uint64_t>(1, std::ceil(Percent/100.0*Sum));
+	uint64_t Cumulative = 0;
+	for(size_t i = 0; i < BUCKETS; ++i){
+		Cumulative += Counts[i].load(std::memory_order_relaxed);
+		if(Rank <= Cumulative) return std::min(GetUpperBound(i), GetMax());
+	}
+	return GetMax();
+}
+
+//! @brief バケットに数えられた個数を返す関数
+//! @param[in]	Index	バケットの番号
+//! @return	個数
+uint64_t LatencyHistogram::GetBucketCount(const size_t Index) const {
+	arcs_assert(Index < BUCKETS);	// 範囲チェック
+	return Counts[Index].load(std::memory_order_relaxed);
+}
+
+//! @brief バケットの下限値を返す関数
+//! @param[in]	Index	バケットの番号
+//! @return	[ns] 下限値
+uint64_t LatencyHistogram::GetLowerBound(const size_t Index){
+	if(Index < SUB_COUNT) return Index;
+	const unsigned int Shift = Index/HALF_COUNT - 1;	// 2の何乗の区間か
+	return (Index - Shift*HALF_COUNT) << Shift;
+}
+
+//! @brief バケットの上限値を返す関数
+//! @param[in]	Index	バケットの番号
+//! @return	[ns] 上限値
+uint64_t LatencyHistogram::GetUpperBound(const size_t Index){
+	if(Index < SUB_COUNT) return Index;
+	const unsigned int Shift = Index/HALF_COUNT - 1;	// 2の何乗の区間か
+	return ((Index - Shift*HALF_COUNT + 1) << Shift) - 1;
+}
+
@@ -0,0 +1,87 @@
+//! @file LatencyHistogram.hh
+//! @brief 遅延時間ヒストグラムクラス
+//!
+//! 制御周期や消費時間などの時間の分布を固定長の対数バケット(HDRヒストグラム形式)に数え上げて，パーセンタイルを計算する。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・値は [ns] 単位の整数で記録する。2^SUB_BITS [ns] 未満は 1 [ns] 刻みで，それ以上は2倍ごとの区間を 2^(SUB_BITS-1) 個に
+//   等分したバケットに数えるので，バケット幅による相対誤差は 1/2^(SUB_BITS-1) 以下 (SUB_BITS = 7 のとき 1.6% 以下) となる。
+// ・2^MAX_BITS [ns] 以上の値は最後のバケットに数える。最大値と最小値はバケットとは別に正確な値を保持する。
+// ・記録はメモリ確保もロックも無い O(1) の処理なので，リアルタイムスレッドから呼んで良い。
+// ・記録は1つのスレッドからのみ行うこと。読み出しは記録中に他のスレッドから行っても良い。
+//   (各バケットは原子変数なので値が壊れることはないが，バケット間で数周期分のずれはあり得る)
+
+#ifndef LATENCYHISTOGRAM
+#define LATENCYHISTOGRAM
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <string>
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 遅延時間ヒストグラムクラス
+class LatencyHistogram {
+	public:
+		static constexpr unsigned int SUB_BITS = 7;		//!< バケット分割数のビット数 (精度を決める)
+		static constexpr unsigned int MAX_BITS = 34;	//!< 記録できる最大値のビット数 (2^34 [ns] = 約17 [s])
+		static constexpr size_t BUCKETS = (MAX_BITS - SUB_BITS + 2)*(1UL << (SUB_BITS - 1));	//!< バケットの数
+		
+		LatencyHistogram();										//!< コンストラクタ
+		LatencyHistogram(const LatencyHistogram& r);			//!< コピーコンストラクタ
+		~LatencyHistogram();									//!< デストラクタ
+		
+		//! @brief 値を記録する関数 (記録側のスレッドのみ呼ぶこと)
+		//! @param[in]	Value	[ns] 記録する値
+		void Record(const uint64_t Value){
+			std::atomic<uint64_t>& Bucket = Counts[GetIndex(Value)];
+			Bucket.store(Bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			Total.store(Total.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			if(MaxValue.load(std::memory_order_relaxed) < Value) MaxValue.store(Value, std::memory_order_relaxed);
+			if(Value < MinValue.load(std::memory_order_relaxed)) MinValue.store(Value, std::memory_order_relaxed);
+		}
+		
+		void Reset(void);										//!< 記録をすべて消去する関数
+		uint64_t GetCount(void) const;							//!< 記録した値の個数を返す関数
+		uint64_t GetMax(void) const;							//!< 記録した値の最大値を返す関数
+		uint64_t GetMin(void) const;							//!< 記録した値の最小値を返す関数
+		uint64_t GetPercentile(const double Percent) const;		//!< 記録した値のパーセンタイルを返す関数
+		uint64_t GetBucketCount(const size_t Index) const;		//!< バケットに数えられた個数を返す関数
+		static uint64_t GetLowerBound(const size_t Index);		//!< バケットの下限値を返す関数
+		static uint64_t GetUpperBound(const size_t Index);		//!< バケットの上限値を返す関数
+		
+		//! @brief 値からバケットの番号を計算する関数
+		//! @param[in]	Value	[ns] 値
+		//! @return	バケットの番号
+		static size_t GetIndex(const uint64_t Value){
+			if(Value < SUB_COUNT) return Value;										// 小さい値は 1 [ns] 刻み
+			if(MAX_VALUE <= Value) return BUCKETS - 1;								// 範囲外の値は最後のバケット
+			const unsigned int Shift = 63 - __builtin_clzll(Value) - SUB_BITS + 1;	// 2の何乗の区間にあるか
+			return Shift*HALF_COUNT + (Value >> Shift);								// 区間内の何番目のバケットか
+		}
+	
+	private:
+		const LatencyHistogram& operator=(const LatencyHistogram&) = delete;	//!< 代入演算子使用禁止
+		
+		static constexpr uint64_t SUB_COUNT = 1UL << SUB_BITS;			//!< 1 [ns] 刻みで数える値の上限
+		static constexpr uint64_t HALF_COUNT = 1UL << (SUB_BITS - 1);	//!< 2倍ごとの区間の分割数
+		static constexpr uint64_t MAX_VALUE = 1UL << MAX_BITS;			//!< [ns] 記録できる最大値
+		
+		std::array<std::atomic<uint64_t>, BUCKETS> Counts;	//!< バケットごとの個数
+		std::atomic<uint64_t> Total;						//!< 記録した値の個数
+		std::atomic<uint64_t> MaxValue;						//!< [ns] 記録した値の最大値
+		std::atomic<uint64_t> MinValue;						//!< [ns] 記録した値の最小値
+};
+}
+
+#endif
+
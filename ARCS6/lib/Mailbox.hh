@@ -0,0 +1,107 @@
+//! @file Mailbox.hh
+//! @brief 最新値メールボックスクラス(テンプレート版)
+//!
+//! 1つの書き込み側スレッドから読み出し側スレッドへ，常に最新の値だけを通し番号付きでロック無しに受け渡す。
+//! 例えば，速い制御スレッドの状態を遅いスレッドへ公開したり，遅いスレッドの目標値を速い制御スレッドへ渡したりするのに使う。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・中身はシーケンスロック(SeqLock)なので，書き込み側は待たず，読み出し側は書き換え途中の値を読むことがない。
+// ・書き込むたびに通し番号が1つ増える。読み出し側は前回の通し番号と比べて，新しい値が届いたかどうかや，
+//   読み飛ばした値の数を知ることができる。(通し番号 0 はまだ一度も書き込まれていないことを表す)
+// ・値を取りこぼさずにすべて受け渡したい場合は SPSCQueue を使うこと。
+
+#ifndef MAILBOX
+#define MAILBOX
+
+#include "SeqLock.hh"
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 最新値メールボックスクラス
+//! @tparam	T	受け渡す値の型 (trivially copyable であること)
+template <typename T>
+class Mailbox {
+	public:
+		//! @brief コンストラクタ
+		Mailbox()
+			: Number(0), Letter()
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(初期値指定版，通し番号は 0 のまま)
+		//! @param[in]	InitValue	初期値
+		explicit Mailbox(const T& InitValue)
+			: Number(0), Letter(Record{InitValue, 0})
+		{
+			
+		}
+		
+		//! @brief デストラクタ
+		~Mailbox(){
+			
+		}
+		
+		//! @brief 値を書き込む関数 (書き込み側のスレッドのみ呼ぶこと)
+		//! @param[in]	Value	値
+		void Post(const T& Value){
+			Letter.Write(Record{Value, ++Number});
+		}
+		
+		//! @brief 最新の値を読み出す関数
+		//! @param[out]	Value	最新の値
+		//! @return	最新の値の通し番号 (0 のときはまだ書き込まれていない)
+		unsigned long Receive(T& Value) const {
+			const Record r = Letter.Read();
+			Value = r.Value;
+			return r.Number;
+		}
+		
+		//! @brief 最新の値を読み出す関数
+		//! @return	最新の値
+		T Receive(void) const {
+			return Letter.Read().Value;
+		}
+		
+		//! @brief 前回読み出したときから新しい値が届いていれば読み出す関数
+		//! @param[out]		Value		最新の値 (新しい値が無いときは変更しない)
+		//! @param[in,out]	LastNumber	前回読み出した値の通し番号 (読み出したら更新される)
+		//! @return	true = 新しい値を読み出した，false = 新しい値は無かった
+		bool ReceiveIfNew(T& Value, unsigned long& LastNumber) const {
+			const Record r = Letter.Read();
+			if(r.Number == LastNumber) return false;
+			Value = r.Value;
+			LastNumber = r.Number;
+			return true;
+		}
+		
+		//! @brief 最新の値の通し番号を返す関数
+		//! @return	通し番号 (書き込まれた回数)
+		unsigned long GetNumber(void) const {
+			return Letter.Read().Number;
+		}
+	
+	private:
+		Mailbox(const Mailbox&) = delete;					//!< コピーコンストラクタ使用禁止
+		const Mailbox& operator=(const Mailbox&) = delete;	//!< 代入演算子使用禁止
+		
+		//! @brief 通し番号付きの値
+		struct Record {
+			T Value;				//!< 値
+			unsigned long Number;	//!< 通し番号
+		};
+		
+		unsigned long Number;	//!< 通し番号 (書き込み側のみ使用)
+		SeqLock<Record> Letter;	//!< 通し番号付きの値の格納用
+};
+}
+
+#endif
+
@@ -1,9 +1,9 @@
 //! @file Matrix.hh
 //! @brief 行列/ベクトル計算クラス(テンプレート版)
-//! @date 2021/04/01
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2021 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the BSD License.
 // For details, see the License.txt file.
@@ -12,6 +12,24 @@
 // ・各々の関数における計算結果はMATLAB/Maximaと比較して合っていることを確認している。
 // ・ただし，LU分解やコレスキー分解などの一見した表現が定まらない関数では，当然，MATLABとは異なる結果を出力するように見える。
 // ・動的メモリ版に比べてかなり高速の行列演算が可能。
+// ・double型とfloat型の行列積，転置，要素ごとの演算は，AVX2/FMAが使える場合にSIMD版(MatrixSIMD.hh)で計算される。
+//   ARCS_MATRIX_NOSIMD を定義するとSIMD版は無効になる。定数式評価のときは常に普通のループで計算される。
+// ・lazy(Ad)*x + lazy(Bd)*u のように lazy() で明示した行列積と加減算は式テンプレート(MatrixExpr.hh)で遅延評価され，
+//   代入時に中間の行列を作らずに計算される。lazy() を使わない演算はこれまで通りその場で行列を返す。
+// ・データは列ごとに連続した Data[N列(横)][M行(縦)] の並び(列優先)で格納される。要素を順に走査するときは列を外側，行を内側のループにすること。
+//   また，32バイト以上の行列はAVXレジスタ幅の32バイト境界に，64バイト以上の行列はキャッシュラインの64バイト境界に配置される。
+// ・制御周期ごとに呼ぶ処理では mul_into, muladd_into, axpy, tpmul_into, multp_into, gemv_t のように
+//   出力先の行列を引数で渡す関数を使うと，戻り値の行列も零初期化も転置行列も作らずに計算される。
+// ・固有値はヘッセンベルグ化＋シフト付きQR法(実数行列はフランシスのダブルシフト)，特異値分解は片側ヤコビ法で計算される。
+//   どちらも計算量は O(n^3) で，反復回数は行列の大きさにほとんど依存しない。
+// ・逐次最小二乗法のように毎周期ランク1の変化しかない場合は，cholupdate/choldowndate (コレスキー因子) や
+//   shermanmorrison/woodbury (逆行列) で O(n^2) で更新すると，inv で毎回 O(n^3) の計算をし直さずに済む。
+// ・行列の一部を使うだけなら，getsubmatrix や getrow などでコピーする代わりに subview や rowview などのビュー(MatrixView.hh)を使うと，
+//   元の行列の要素を直接参照するのでコピーが発生しない。
+// ・要素ごとの関数(expe, loge, abse, sqrte, tanhe)は std:: を付けずに呼んでいるので，
+//   二重数(DualNumber.hh)などの独自のデータ型でも，その型用の関数が実引数依存の名前探索で呼ばれる。
+// ・4×4以下の行列積と転置はループを完全に展開した版(MatrixUnroll.hh)で計算され (SIMD版の方が速い大きさを除く)，
+//   4×4以下の det, inv, solve はLU分解を使わずに余因子による閉形式で計算される。
 
 #ifndef MATRIX
 #define MATRIX
@@ -21,6 +39,11 @@
 #include <cassert>
 #include <array>
 #include <complex>
+#include <limits>
+#include "MatrixSIMD.hh"
+#include "MatrixExpr.hh"
+#include "MatrixView.hh"
+#include "MatrixUnroll.hh"
 
 // ARCS組込み用マクロ
 #ifdef ARCS_IN
@@ -101,6 +124,15 @@ class Matrix {
 			
 		}
 		
+		//! @brief コンストラクタ(式テンプレート版)
+		//! @param[in]	right	行列の式
+		template <class EE>
+		constexpr Matrix(const MatrixExpr<EE,Matrix>& right)
+			: Nindex(0), Mindex(0), Data()
+		{
+			right.Derived().AssignTo(*this);	// 中間の行列を作らずに直接計算
+		}
+		
 		/* constexprコンストラクタのための「trivial destructor」
 		//! @brief デストラクタ
 		~Matrix(){
@@ -120,6 +152,21 @@ class Matrix {
 			return (*this);
 		}
 		
+		//! @brief 行列代入演算子 (式テンプレートの場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		template <class EE>
+		constexpr auto& operator=(const MatrixExpr<EE,Matrix>& right){
+			if(right.Derived().IsAliasOf(this)){
+				// 代入先が式の中に現れる場合は一時行列を経由
+				const Matrix ret(right);
+				Data = ret.Data;
+			}else{
+				right.Derived().AssignTo(*this);	// 中間の行列を作らずに直接計算
+			}
+			return (*this);
+		}
+		
 		//! @brief 単項プラス演算子
 		//! @return 結果
 		constexpr auto operator+(void) const{
@@ -134,6 +181,13 @@ class Matrix {
 		//! @return 結果
 		constexpr auto operator-(void) const{
 			Matrix ret;
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::Neg(ret.Data[0].data(), Data[0].data(), N*M);
+					return ret;
+				}
+			}
 			for(size_t i = 0; i < N; ++i){
 				for(size_t j = 0; j < M; ++j) ret.Data[i][j] = -Data[i][j];
 			}
@@ -147,6 +201,13 @@ class Matrix {
 			static_assert(N == right.N, "Matrix Size Error");	// 行列のサイズチェック
 			static_assert(M == right.M, "Matrix Size Error");	// 行列のサイズチェック
 			Matrix ret;
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::Add(ret.Data[0].data(), Data[0].data(), right.Data[0].data(), N*M);
+					return ret;
+				}
+			}
 			for(size_t i = 0; i < N; ++i){
 				for(size_t j = 0; j < M; ++j) ret.Data[i][j] = Data[i][j] + right.Data[i][j];
 			}
@@ -158,6 +219,13 @@ class Matrix {
 		//! @return 結果
 		constexpr auto operator+(const TT& right) const{
 			Matrix ret;
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::AddScalar(ret.Data[0].data(), Data[0].data(), right, N*M);
+					return ret;
+				}
+			}
 			for(size_t i = 0; i < N; ++i){
 				for(size_t j = 0; j < M; ++j) ret.Data[i][j] = Data[i][j] + right;
 			}
@@ -171,6 +239,13 @@ class Matrix {
 			static_assert(N == right.N, "Matrix Size Error");	// 行列のサイズチェック
 			static_assert(M == right.M, "Matrix Size Error");	// 行列のサイズチェック
 			Matrix ret;
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::Sub(ret.Data[0].data(), Data[0].data(), right.Data[0].data(), N*M);
+					return ret;
+				}
+			}
 			for(size_t i = 0; i < N; ++i){
 				for(size_t j = 0; j < M; ++j) ret.Data[i][j] = Data[i][j] - right.Data[i][j];
 			}
@@ -182,16 +257,24 @@ class Matrix {
 		//! @return 結果
 		constexpr auto operator-(const TT& right) const{
 			Matrix ret;
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::SubScalar(ret.Data[0].data(), Data[0].data(), right, N*M);
+					return ret;
+				}
+			}
 			for(size_t i = 0; i < N; ++i){
 				for(size_t j = 0; j < M; ++j) ret.Data[i][j] = Data[i][j] - right;
 			}
 			return ret;
 		}
 		
-		//! @brief 行列乗算演算子 (行列同士の乗算の場合)
+		//! @brief 行列乗算演算子 (データ型の異なる行列同士の乗算の場合)
+		//! データ型が同じ場合は式テンプレート(MatrixExpr.hh)の方の演算子が使われる
 		//! @param[in] right 演算子の右側
 		//! @return 結果
-		template <size_t Nright, size_t Mright, typename Tright>
+		template <size_t Nright, size_t Mright, typename Tright, std::enable_if_t<!std::is_same_v<TT,Tright>, std::nullptr_t> = nullptr>
 		constexpr auto operator*(const Matrix<Nright,Mright,Tright>& right) const{
 			static_assert(N == right.M, "Matrix Size Error");	// 行列のサイズチェック
 			Matrix<right.N,M,TT> ret;
@@ -208,6 +291,13 @@ class Matrix {
 		//! @return 結果
 		constexpr auto operator*(const TT& right) const{
 			Matrix ret;
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::MulScalar(ret.Data[0].data(), Data[0].data(), right, N*M);
+					return ret;
+				}
+			}
 			for(size_t i = 0; i < N; ++i){
 				for(size_t j = 0; j < M; ++j) ret.Data[i][j] = Data[i][j]*right;
 			}
@@ -219,6 +309,13 @@ class Matrix {
 		//! @return 結果
 		constexpr auto operator/(const TT& right) const{
 			Matrix ret;
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::DivScalar(ret.Data[0].data(), Data[0].data(), right, N*M);
+					return ret;
+				}
+			}
 			for(size_t i = 0; i < N; ++i){
 				for(size_t j = 0; j < M; ++j) ret.Data[i][j] = Data[i][j]/right;
 			}
@@ -231,16 +328,44 @@ class Matrix {
 		constexpr auto& operator+=(const Matrix& right){
 			static_assert(this->N == right.N, "Matrix Size Error");	// 行列のサイズチェック
 			static_assert(this->M == right.M, "Matrix Size Error");	// 行列のサイズチェック
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::Add(Data[0].data(), Data[0].data(), right.Data[0].data(), N*M);
+					return (*this);
+				}
+			}
 			for(size_t i = 0; i < N; ++i){
 				for(size_t j = 0; j < M; ++j) this->Data[i][j] = this->Data[i][j] + right.Data[i][j];
 			}
 			return (*this);
 		}
 		
+		//! @brief 行列加算代入演算子 (行列＝行列＋式の場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		template <class EE>
+		constexpr auto& operator+=(const MatrixExpr<EE,Matrix>& right){
+			if(right.Derived().IsAliasOf(this)){
+				// 加算先が式の中に現れる場合は一時行列を経由
+				const Matrix ret(right);
+				return operator+=(ret);
+			}
+			right.Derived().AddTo(*this, (TT)1);	// 中間の行列を作らずに直接累積加算
+			return (*this);
+		}
+		
 		//! @brief 行列加算代入演算子 (行列＝行列＋スカラーの場合)
 		//! @param[in] right 演算子の右側
 		//! @return 結果
 		constexpr auto& operator+=(const TT& right){
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::AddScalar(Data[0].data(), Data[0].data(), right, N*M);
+					return (*this);
+				}
+			}
 			for(size_t i = 0; i < N; ++i){
 				for(size_t j = 0; j < M; ++j) this->Data[i][j] = this->Data[i][j] + right;
 			}
@@ -253,16 +378,44 @@ class Matrix {
 		constexpr auto& operator-=(const Matrix& right){
 			static_assert(this->N == right.N, "Matrix Size Error");	// 行列のサイズチェック
 			static_assert(this->M == right.M, "Matrix Size Error");	// 行列のサイズチェック
-			for(size_t j = 0; j < M; ++j){
-				for(size_t i = 0; i < N; ++i) this->Data[i][j] = this->Data[i][j] - right.Data[i][j];
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::Sub(Data[0].data(), Data[0].data(), right.Data[0].data(), N*M);
+					return (*this);
+				}
+			}
+			for(size_t i = 0; i < N; ++i){
+				for(size_t j = 0; j < M; ++j) this->Data[i][j] = this->Data[i][j] - right.Data[i][j];
 			}
 			return (*this);
 		}
 		
+		//! @brief 行列減算代入演算子 (行列＝行列－式の場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		template <class EE>
+		constexpr auto& operator-=(const MatrixExpr<EE,Matrix>& right){
+			if(right.Derived().IsAliasOf(this)){
+				// 減算先が式の中に現れる場合は一時行列を経由
+				const Matrix ret(right);
+				return operator-=(ret);
+			}
+			right.Derived().AddTo(*this, (TT)(-1));	// 中間の行列を作らずに直接累積減算
+			return (*this);
+		}
+		
 		//! @brief 行列減算代入演算子 (行列＝行列－スカラーの場合)
 		//! @param[in] right 演算子の右側
 		//! @return 結果
 		constexpr auto& operator-=(const TT& right){
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::SubScalar(Data[0].data(), Data[0].data(), right, N*M);
+					return (*this);
+				}
+			}
 			for(size_t i = 0; i < N; ++i){
 				for(size_t j = 0; j < M; ++j) this->Data[i][j] = this->Data[i][j] - right;
 			}
@@ -289,6 +442,13 @@ class Matrix {
 			static_assert(N == right.N, "Matrix Size Error");	// 行列のサイズチェック
 			static_assert(M == right.M, "Matrix Size Error");	// 行列のサイズチェック
 			Matrix ret;
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::Mul(ret.Data[0].data(), Data[0].data(), right.Data[0].data(), N*M);
+					return ret;
+				}
+			}
 			for(size_t i = 0; i < N; ++i){
 				for(size_t j = 0; j < M; ++j) ret.Data[i][j] = Data[i][j]*right.Data[i][j];
 			}
@@ -302,6 +462,13 @@ class Matrix {
 			static_assert(N == right.N, "Matrix Size Error");	// 行列のサイズチェック
 			static_assert(M == right.M, "Matrix Size Error");	// 行列のサイズチェック
 			Matrix ret;
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::Div(ret.Data[0].data(), Data[0].data(), right.Data[0].data(), N*M);
+					return ret;
+				}
+			}
 			for(size_t i = 0; i < N; ++i){
 				for(size_t j = 0; j < M; ++j) ret.Data[i][j] = Data[i][j]/right.Data[i][j];
 			}
@@ -329,6 +496,13 @@ class Matrix {
 		//! @param[in] right	右側の行列
 		constexpr friend Matrix operator+(const TT& left, const Matrix& right){
 			Matrix ret;
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::AddScalar(ret.Data[0].data(), right.Data[0].data(), left, N*M);
+					return ret;
+				}
+			}
 			for(size_t i = 0; i < right.N; ++i){
 				for(size_t j = 0; j < right.M; ++j) ret.Data[i][j] = left + right.Data[i][j];
 			}
@@ -340,6 +514,13 @@ class Matrix {
 		//! @param[in] right	右側の行列
 		constexpr friend Matrix operator-(const TT& left, const Matrix& right){
 			Matrix<NN,MM,TT> ret;
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::ScalarSub(ret.Data[0].data(), right.Data[0].data(), left, N*M);
+					return ret;
+				}
+			}
 			for(size_t i = 0; i < right.N; ++i){
 				for(size_t j = 0; j < right.M; ++j) ret.Data[i][j] = left - right.Data[i][j];
 			}
@@ -351,6 +532,13 @@ class Matrix {
 		//! @param[in] right	右側の行列
 		constexpr friend Matrix operator*(const TT& left, const Matrix& right){
 			Matrix<NN,MM,TT> ret;
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::MulScalar(ret.Data[0].data(), right.Data[0].data(), left, N*M);
+					return ret;
+				}
+			}
 			for(size_t i = 0; i < right.N; ++i){
 				for(size_t j = 0; j < right.M; ++j) ret.Data[i][j] = right.Data[i][j]*left;
 			}
@@ -485,9 +673,10 @@ class Matrix {
 		}
 		
 		//! @brief MatrixクラスがSIMD命令が有効に設定されているかを返す関数
+		//! (AVX2/FMAが使えるコンパイル設定で，かつ，データ型がdoubleかfloatのときに有効)
 		//! @return SIMD有効 = true, SIMD無効 = false
-		constexpr bool isEnabledSIMD(void){
-			return false;
+		static constexpr bool isEnabledSIMD(void){
+			return MatrixSIMD::isEnabled<TT>();
 		}
 		
 		//! @brief 行列のサイズの表示 (この関数はマクロを介して呼ばれることを想定している)
@@ -603,12 +792,154 @@ class Matrix {
 		//! @return	結果
 		constexpr friend Matrix<MM,NN,TT> tp(const Matrix<NN,MM,TT>& U){
 			Matrix<U.M,U.N,TT> y;
+			if constexpr(MatrixUnroll::isTiny<TT,NN,MM,1>()){
+				MatrixUnroll::Transpose(y.Data, U.Data);	// 小さい行列のときは展開版
+				return y;
+			}
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::Transpose<U.N,U.M>(y.Data[0].data(), U.Data[0].data());
+					return y;
+				}
+			}
 			for(size_t j = 0; j < U.M; ++j){
 				for(size_t i = 0; i < U.N; ++i) y.Data[j][i] = U.Data[i][j];
 			}
 			return y;
 		}
 		
+		//! @brief 行列積を出力先に直接書き込む関数 Y = alpha*A*B
+		//! 戻り値の行列も零初期化も使わずにYへ直接書き込む (YはAともBとも異なる行列であること)
+		//! @tparam	K	Bの列数
+		//! @param[out]	Y	出力行列
+		//! @param[in]	A	左側の行列
+		//! @param[in]	B	右側の行列
+		//! @param[in]	alpha	スカラー係数
+		template <size_t K>
+		constexpr friend void mul_into(Matrix<K,MM,TT>& Y, const Matrix& A, const Matrix<K,NN,TT>& B, const TT alpha = 1){
+			arcs_assert(static_cast<const void*>(&Y) != &A && static_cast<const void*>(&Y) != &B);	// 出力先と入力が同じでないかチェック
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::MatMul<NN,MM,K>(Y.Data[0].data(), A.Data[0].data(), B.Data[0].data(), alpha);
+					return;
+				}
+			}
+			for(size_t k = 0; k < K; ++k){
+				const TT b0 = alpha*B.Data[k][0];
+				for(size_t j = 0; j < MM; ++j) Y.Data[k][j] = A.Data[0][j]*b0;	// 1項目は代入なので零初期化は不要
+				for(size_t i = 1; i < NN; ++i){
+					const TT b = alpha*B.Data[k][i];
+					for(size_t j = 0; j < MM; ++j) Y.Data[k][j] += A.Data[i][j]*b;
+				}
+			}
+		}
+		
+		//! @brief 行列積を出力先に累積加算する関数 Y = A*B + beta*Y
+		//! 行列積は零から計算して最後にYへ加算するので，beta = 1 のときは Y += A*B と同じ丸めになる (YはAともBとも異なる行列であること)
+		//! @tparam	K	Bの列数
+		//! @param[in,out]	Y	入出力行列
+		//! @param[in]	A	左側の行列
+		//! @param[in]	B	右側の行列
+		//! @param[in]	beta	出力行列のスカラー係数
+		template <size_t K>
+		constexpr friend void muladd_into(Matrix<K,MM,TT>& Y, const Matrix& A, const Matrix<K,NN,TT>& B, const TT beta = 1){
+			arcs_assert(static_cast<const void*>(&Y) != &A && static_cast<const void*>(&Y) != &B);	// 出力先と入力が同じでないかチェック
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::MatMulAdd<NN,MM,K>(Y.Data[0].data(), A.Data[0].data(), B.Data[0].data(), (TT)1, beta);
+					return;
+				}
+			}
+			for(size_t k = 0; k < K; ++k){
+				std::array<TT,MM> y = {0};	// 1列分の行列積
+				for(size_t i = 0; i < NN; ++i){
+					for(size_t j = 0; j < MM; ++j) y[j] += A.Data[i][j]*B.Data[k][i];
+				}
+				for(size_t j = 0; j < MM; ++j) Y.Data[k][j] = beta*Y.Data[k][j] + y[j];
+			}
+		}
+		
+		//! @brief スカラー倍した行列を出力先に累積加算する関数 Y = Y + a*X
+		//! @param[in,out]	Y	入出力行列
+		//! @param[in]	a	スカラー係数
+		//! @param[in]	X	入力行列
+		constexpr friend void axpy(Matrix& Y, const TT a, const Matrix& X){
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::Axpy(Y.Data[0].data(), a, X.Data[0].data(), NN*MM);
+					return;
+				}
+			}
+			for(size_t i = 0; i < NN; ++i){
+				for(size_t j = 0; j < MM; ++j) Y.Data[i][j] += a*X.Data[i][j];
+			}
+		}
+		
+		//! @brief 左側を転置した行列積を出力先に直接書き込む関数 Y = alpha*A^T*B
+		//! tp(A)の転置行列は作らずにAの列とBの列の内積として計算する (YはAともBとも異なる行列であること)
+		//! @tparam	K	Bの列数
+		//! @param[out]	Y	出力行列
+		//! @param[in]	A	左側の行列 (転置前)
+		//! @param[in]	B	右側の行列
+		//! @param[in]	alpha	スカラー係数
+		template <size_t K>
+		constexpr friend void tpmul_into(Matrix<K,NN,TT>& Y, const Matrix& A, const Matrix<K,MM,TT>& B, const TT alpha = 1){
+			arcs_assert(static_cast<const void*>(&Y) != &A && static_cast<const void*>(&Y) != &B);	// 出力先と入力が同じでないかチェック
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::TpMatMul<NN,MM,K>(Y.Data[0].data(), A.Data[0].data(), B.Data[0].data(), alpha);
+					return;
+				}
+			}
+			for(size_t k = 0; k < K; ++k){
+				for(size_t i = 0; i < NN; ++i){
+					TT y = 0;
+					for(size_t j = 0; j < MM; ++j) y += A.Data[i][j]*B.Data[k][j];
+					Y.Data[k][i] = alpha*y;
+				}
+			}
+		}
+		
+		//! @brief 転置行列とベクトルの積を出力先に直接書き込む関数 y = A^T*x
+		//! @param[out]	y	出力縦ベクトル
+		//! @param[in]	A	行列 (転置前)
+		//! @param[in]	x	入力縦ベクトル
+		constexpr friend void gemv_t(Matrix<1,NN,TT>& y, const Matrix& A, const Matrix<1,MM,TT>& x){
+			tpmul_into(y, A, x);
+		}
+		
+		//! @brief 右側を転置した行列積を出力先に直接書き込む関数 Y = alpha*A*B^T
+		//! tp(B)の転置行列は作らずにBを行方向に読み出す (YはAともBとも異なる行列であること)
+		//! @tparam	K	Bの行数
+		//! @param[out]	Y	出力行列
+		//! @param[in]	A	左側の行列
+		//! @param[in]	B	右側の行列 (転置前)
+		//! @param[in]	alpha	スカラー係数
+		template <size_t K>
+		constexpr friend void multp_into(Matrix<K,MM,TT>& Y, const Matrix& A, const Matrix<NN,K,TT>& B, const TT alpha = 1){
+			arcs_assert(static_cast<const void*>(&Y) != &A && static_cast<const void*>(&Y) != &B);	// 出力先と入力が同じでないかチェック
+			if constexpr(isEnabledSIMD()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::MatMulTp<NN,MM,K>(Y.Data[0].data(), A.Data[0].data(), B.Data[0].data(), alpha);
+					return;
+				}
+			}
+			for(size_t k = 0; k < K; ++k){
+				const TT b0 = alpha*B.Data[0][k];
+				for(size_t j = 0; j < MM; ++j) Y.Data[k][j] = A.Data[0][j]*b0;	// 1項目は代入なので零初期化は不要
+				for(size_t i = 1; i < NN; ++i){
+					const TT b = alpha*B.Data[i][k];
+					for(size_t j = 0; j < MM; ++j) Y.Data[k][j] += A.Data[i][j]*b;
+				}
+			}
+		}
+		
 		//! @brief 行列のトレースを返す関数
 		//! @param[in]	U	入力行列
 		//! @return	結果
@@ -925,10 +1256,8 @@ class Matrix {
 			static_assert(SM <= MM);		// 小行列の方が高さが小さいかチェック
 			arcs_assert(SN + n - 1 <= NN);	// 右側がハミ出ないかチェック
 			arcs_assert(SM + m - 1 <= MM);	// 下側がハミ出ないかチェック
-			Matrix<1,SM> v;
-			for(size_t i = 1; i <= SN; ++i){
-				getvvector(U, i + n - 1, m, v);
-				setcolumn(Y, v, i);
+			for(size_t i = 0; i < SN; ++i){
+				for(size_t j = 0; j < SM; ++j) Y.Data[i][j] = U.Data[n-1+i][m-1+j];	// 列ごとに直接コピー
 			}
 		}
 		
@@ -1205,6 +1534,119 @@ class Matrix {
 			L = Lp*sqrte(Dp);	// 対角行列の平方根を取って，下三角行列に掛けたものを出力
 		}
 		
+		//! @brief コレスキー因子のランク1更新 L*L^T ← L*L^T + x*x^T (in-place版, O(n^2))
+		//! @param[in,out]	L	下三角行列 (A = L*L^T のコレスキー因子，対角は正)
+		//! @param[in]	x	更新ベクトル
+		constexpr friend void cholupdate(Matrix& L, const Matrix<1,MM,TT>& x){
+			static_assert(L.N == L.M, "Matrix Size Error");	// Lが正方行列かチェック
+			Matrix<1,MM,TT> w = x;
+			for(size_t k = 0; k < NN; ++k){
+				// k列目に平面回転を掛けて w の k番目の要素を消す
+				const TT lkk = L.Data[k][k];
+				const TT r = std::sqrt(lkk*lkk + w.Data[0][k]*w.Data[0][k]);
+				const TT c = r/lkk;
+				const TT s = w.Data[0][k]/lkk;
+				L.Data[k][k] = r;
+				for(size_t i = k + 1; i < MM; ++i){
+					L.Data[k][i] = (L.Data[k][i] + s*w.Data[0][i])/c;
+					w.Data[0][i] = c*w.Data[0][i] - s*L.Data[k][i];
+				}
+			}
+		}
+		
+		//! @brief コレスキー因子のランク1ダウンデート L*L^T ← L*L^T - x*x^T (in-place版, O(n^2))
+		//! @param[in,out]	L	下三角行列 (A = L*L^T のコレスキー因子，対角は正)
+		//! @param[in]	x	ダウンデートベクトル
+		//! @return	true = 成功，false = 結果が正定値にならない(このときLは変更しない)
+		constexpr friend bool choldowndate(Matrix& L, const Matrix<1,MM,TT>& x){
+			static_assert(L.N == L.M, "Matrix Size Error");	// Lが正方行列かチェック
+			
+			// L*p = x を前進代入で解いて，|p| < 1 なら正定値のまま (失敗のときにLを壊さないように先に確認)
+			Matrix<1,MM,TT> w = x;
+			TT p2 = 0;
+			for(size_t k = 0; k < NN; ++k){
+				w.Data[0][k] /= L.Data[k][k];
+				for(size_t i = k + 1; i < MM; ++i) w.Data[0][i] -= L.Data[k][i]*w.Data[0][k];
+				p2 += w.Data[0][k]*w.Data[0][k];
+			}
+			if(1 <= p2) return false;
+			
+			w = x;
+			for(size_t k = 0; k < NN; ++k){
+				// k列目に双曲線回転を掛けて w の k番目の要素を消す
+				const TT lkk = L.Data[k][k];
+				const TT r = std::sqrt((lkk - w.Data[0][k])*(lkk + w.Data[0][k]));
+				const TT c = r/lkk;
+				const TT s = w.Data[0][k]/lkk;
+				L.Data[k][k] = r;
+				for(size_t i = k + 1; i < MM; ++i){
+					L.Data[k][i] = (L.Data[k][i] - s*w.Data[0][i])/c;
+					w.Data[0][i] = c*w.Data[0][i] - s*L.Data[k][i];
+				}
+			}
+			return true;
+		}
+		
+		//! @brief シャーマン・モリソンの公式による逆行列のランク1更新 Ainv ← (A + u*v^T)^(-1) (in-place版, O(n^2))
+		//! @param[in,out]	Ainv	逆行列 A^(-1)
+		//! @param[in]	u	更新ベクトル
+		//! @param[in]	v	更新ベクトル
+		//! @return	true = 成功，false = A + u*v^T が特異(このときAinvは変更しない)
+		constexpr friend bool shermanmorrison(Matrix& Ainv, const Matrix<1,MM,TT>& u, const Matrix<1,MM,TT>& v){
+			static_assert(Ainv.N == Ainv.M, "Matrix Size Error");	// Ainvが正方行列かチェック
+			
+			// a = Ainv*u，b^T = v^T*Ainv
+			Matrix<1,MM,TT> a, b;
+			for(size_t j = 0; j < NN; ++j){
+				const TT uj = u.Data[0][j];
+				TT bj = 0;
+				for(size_t i = 0; i < MM; ++i){
+					a.Data[0][i] += Ainv.Data[j][i]*uj;
+					bj += v.Data[0][i]*Ainv.Data[j][i];
+				}
+				b.Data[0][j] = bj;
+			}
+			
+			// 分母 1 + v^T*Ainv*u
+			TT d = 1;
+			for(size_t i = 0; i < MM; ++i) d += v.Data[0][i]*a.Data[0][i];
+			if(std::abs(d) < epsilon) return false;
+			
+			// Ainv ← Ainv - a*b^T/d
+			for(size_t j = 0; j < NN; ++j){
+				const TT bj = b.Data[0][j]/d;
+				for(size_t i = 0; i < MM; ++i) Ainv.Data[j][i] -= a.Data[0][i]*bj;
+			}
+			return true;
+		}
+		
+		//! @brief ウッドベリーの公式による逆行列のランクK更新 Ainv ← (A + U*C*V)^(-1) (in-place版, O(K*n^2))
+		//! 内部では K×K の行列 I + V*Ainv*U*C だけを逆行列計算するので，K がnより十分小さいときに使うこと。
+		//! @tparam	K	更新のランク
+		//! @param[in,out]	Ainv	逆行列 A^(-1)
+		//! @param[in]	U	更新行列 (n×K)
+		//! @param[in]	C	更新行列 (K×K)
+		//! @param[in]	V	更新行列 (K×n)
+		//! @return	true = 成功，false = A + U*C*V が特異(このときAinvは変更しない)
+		template <size_t K>
+		constexpr friend bool woodbury(Matrix& Ainv, const Matrix<K,MM,TT>& U, const Matrix<K,K,TT>& C, const Matrix<NN,K,TT>& V){
+			static_assert(Ainv.N == Ainv.M, "Matrix Size Error");	// Ainvが正方行列かチェック
+			const Matrix<K,MM,TT> AU = Ainv*U;		// Ainv*U (n×K)
+			const Matrix<NN,K,TT> VA = V*Ainv;		// V*Ainv (K×n)
+			const Matrix<K,K,TT> S = Matrix<K,K,TT>::eye() + VA*U*C;	// I + V*Ainv*U*C
+			if(std::abs(det(S)) < epsilon) return false;
+			const Matrix<NN,K,TT> G = C*inv(S)*VA;	// C*(I + V*Ainv*U*C)^(-1)*V*Ainv (K×n)
+			
+			// Ainv ← Ainv - AU*G
+			for(size_t j = 0; j < NN; ++j){
+				for(size_t k = 0; k < K; ++k){
+					const TT gkj = G.Data[j][k];
+					for(size_t i = 0; i < MM; ++i) Ainv.Data[j][i] -= AU.Data[k][i]*gkj;
+				}
+			}
+			return true;
+		}
+		
 		//! @brief QR分解
 		//! 補足：実数型のときMATLABとはQとRの符号関係が逆の場合があるが正常なQR分解であることは確認済み
 		//! 補足：複素数型のときMATLABとは全く違う値が得られるが，正常なQR分解であることは確認済み
@@ -1265,51 +1707,24 @@ class Matrix {
 		}
 		
 		//! @brief SVD特異値分解(引数で返す版)
+		//! 片側ヤコビ法で計算する。特異値は降順に並び，すべて非負になる。
 		//! 補足：MATLABとはU,S,Vの符号関係が入れ替わっている場合があるが正常なSVDであることは確認済み
 		//! @param[in]	A	入力行列
 		//! @param[out]	U	U行列
 		//! @param[out]	S	S行列
 		//! @param[out]	V	V行列
 		constexpr friend void SVD(const Matrix<NN,MM,TT>& A, Matrix<MM,MM,TT>& U, Matrix<NN,MM,TT>& S, Matrix<NN,NN,TT>& V){
-			constexpr size_t LoopMax = 100*std::max(NN,MM);	// ループ打ち切り最大回数
-			Matrix<NN,MM,TT> Snm;
-			Matrix<MM,NN,TT> Smn;
-			Matrix<MM,MM,TT> Qm;
-			Matrix<NN,NN,TT> Qn;
-			Matrix<MM,NN,TT> e;
-			double E = 0, F = 0;
-			
-			// 初期化
-			U = Matrix<MM,MM,TT>::eye();
-			Snm = A;
-			V = Matrix<NN,NN,TT>::eye();
-			TT Error = 1;
-			
-			// ループ打ち切り最大回数に達するまでループ
-			for(size_t l = 0; l < LoopMax; ++l){
-				if(Error < epsilon) break;	// 誤差がイプシロンを下回ったらループ打ち切り
-				QR(Snm, Qm, Snm);
-				U = U*Qm;
-				QR(tp(Snm), Qn, Smn);
-				V = V*Qn;
-				e = gettriup(Smn, 1);
-				E = euclidnorm(e);
-				F = euclidnorm(diag(Smn));
-				if(-epsilon < F && F < epsilon) F = 1;
-				Error = E/F;
-				Snm = tp(Smn);
+			constexpr size_t K = std::min(NN,MM);	// 特異値の数
+			Matrix<1,K,TT> s;
+			if constexpr(NN <= MM){
+				// 縦長か正方行列の場合
+				JacobiSVD(A, U, s, V);
+			}else{
+				// 横長の場合は転置行列を分解して，UとVを入れ替える
+				JacobiSVD(tp(A), V, s, U);
 			}
-			
-			// 符号修正
-			Matrix<1,std::min(NN,MM),TT> Sd = diag(Smn);
 			S = Matrix<NN,MM,TT>::zeros();
-			for(size_t k = 1; k <= std::min(NN,MM); ++k){
-				TT Sdn = Sd[k];
-				S.SetElement(k,k, std::abs(Sdn));
-				if(Sdn < 0){
-					setcolumn(U, -getcolumn(U, k), k);
-				}
-			}
+			for(size_t k = 0; k < K; ++k) S.Data[k][k] = s.Data[0][k];
 		}
 		
 		//! @brief SVD特異値分解(タプルで返す版)
@@ -1336,6 +1751,9 @@ class Matrix {
 			if constexpr(MM == 1){
 				// スカラーの場合
 				x[1] = b[1]/A.GetElement(1,1);	// スカラーのときはそのまま単純に除算
+			}else if constexpr(MM <= MatrixUnroll::MAX_SIZE){
+				// 小さい行列の場合
+				MatrixUnroll::Solve(A.Data, b.Data[0], x.Data[0]);	// 余因子行列による閉形式
 			}else{
 				// 行列の場合
 				// Ax = b において A をLU分解すると，(LU)x = b になって L(Ux) = b と表現できることを利用する。
@@ -1409,17 +1827,23 @@ class Matrix {
 		//! @return	結果
 		constexpr friend TT det(const Matrix& A){
 			static_assert(A.N == A.M, "Matrix Size Error");	// Aが正方行列かチェック
-			Matrix<A.N,A.N,TT> L, U;
-			Matrix<1,A.N,int> v;
-			int sign;		// 符号
-			if(LU(A, L, U, v) == Matrix::ODD){	// LU分解と符号判定
-				sign = -1;	// 奇数のとき
+			if constexpr(MM <= MatrixUnroll::MAX_SIZE){
+				// 小さい行列の場合
+				return MatrixUnroll::Det(A.Data);	// 余因子展開による閉形式
 			}else{
-				sign =  1;	// 偶数のとき
+				// 大きい行列の場合
+				Matrix<A.N,A.N,TT> L, U;
+				Matrix<1,A.N,int> v;
+				int sign = 1;	// 符号
+				if(LU(A, L, U, v) == Matrix::ODD){	// LU分解と符号判定
+					sign = -1;	// 奇数のとき
+				}else{
+					sign =  1;	// 偶数のとき
+				}
+				// |A| = |L||U| でしかも |L|と|U|は対角要素の総積に等しく，さらにLの対角要素は1なので|L|は省略可。
+				// 最後にLU分解のときの並べ替え回数によって符号反転をする。
+				return (TT)sign*prod(U);
 			}
-			// |A| = |L||U| でしかも |L|と|U|は対角要素の総積に等しく，さらにLの対角要素は1なので|L|は省略可。
-			// 最後にLU分解のときの並べ替え回数によって符号反転をする。
-			return (TT)sign*prod(U);
 		}
 		
 		//! @brief 逆行列を返す関数 (正則チェック無し)
@@ -1427,13 +1851,19 @@ class Matrix {
 		//! @return	結果
 		constexpr friend Matrix inv(const Matrix& A){
 			static_assert(A.N == A.M, "Matrix Size Error");	// Aが正方行列かチェック
-			Matrix I = Matrix<A.N,A.N,TT>::ident();			// 単位行列の生成
-			Matrix<1,A.N,TT> x, b;
 			Matrix<A.N,A.N,TT> Ainv;
-			for(size_t n = 1; n <= A.N; ++n){
-				b = getcolumn(I, n);	// 単位行列のn列目を切り出してbベクトルとする
-				solve(A, b, x);			// Ax = b の連立1次方程式をxについて解く
-				setcolumn(Ainv, x, n);	// xはAの逆行列のn列目となるので、Ainvのn列目にxを書き込む
+			if constexpr(MM <= MatrixUnroll::MAX_SIZE){
+				// 小さい行列の場合
+				MatrixUnroll::Inv(A.Data, Ainv.Data);	// 余因子行列による閉形式
+			}else{
+				// 大きい行列の場合
+				Matrix I = Matrix<A.N,A.N,TT>::ident();	// 単位行列の生成
+				Matrix<1,A.N,TT> x, b;
+				for(size_t n = 1; n <= A.N; ++n){
+					b = getcolumn(I, n);	// 単位行列のn列目を切り出してbベクトルとする
+					solve(A, b, x);			// Ax = b の連立1次方程式をxについて解く
+					setcolumn(Ainv, x, n);	// xはAの逆行列のn列目となるので、Ainvのn列目にxを書き込む
+				}
 			}
 			return Ainv;	// 最終的に得られる逆行列を返す
 		}
@@ -1473,54 +1903,46 @@ class Matrix {
 		}
 		
 		//! @brief 上三角行列の逆行列を返す関数
+		//! 逆行列も上三角行列になるので，各列を対角から上だけ後退代入で計算する (計算量は約 n^3/6)
 		//! @param[in]	U	入力行列(上三角行列)
 		//! @param[out]	Uinv	逆行列
 		constexpr friend void inv_upper_tri(const Matrix& U, Matrix& Uinv){
 			static_assert(U.N == U.M, "Matrix Size Error");			// Uが正方行列かチェック
 			static_assert(Uinv.N == Uinv.M, "Matrix Size Error");	// Uinvが正方行列かチェック
 			static_assert(U.N == Uinv.N, "Matrix Size Error");		// UとUinvが同じサイズかチェック
-			Matrix I = Matrix<U.N,U.N,TT>::ident();			// 単位行列の生成
-			Matrix<1,U.N,TT> x, b;
-			for(size_t n = 1; n <= U.N; ++n){
-				b = getcolumn(I, n);		// 単位行列のn列目を切り出してbベクトルとする
-				solve_upper_tri(U, b, x);	// Ux = b の連立1次方程式をxについて解く
-				setcolumn(Uinv, x, n);		// xはUの逆行列のn列目となるので、Uinvのn列目にxを書き込む
-			}
-			// Uinvが最終的に得られる逆行列
+			inv_upper_tri_kernel(U, NN, Uinv);
 		}
 		
 		//! @brief 上三角行列の逆行列を返す関数(左上小行列のサイズ指定版)
 		//! @param[in]	U	入力行列(上三角行列, kより右と下は全部ゼロ埋めを想定)
 		//! @param[in]	k	左上小行列のサイズ
-		//! @param[out]	Uinv	逆行列
+		//! @param[out]	Uinv	逆行列 (k列目までを書き込む)
 		constexpr friend void inv_upper_tri(const Matrix& U, size_t k, Matrix& Uinv){
 			static_assert(U.N == U.M, "Matrix Size Error");			// Uが正方行列かチェック
 			static_assert(Uinv.N == Uinv.M, "Matrix Size Error");	// Uinvが正方行列かチェック
 			static_assert(U.N == Uinv.N, "Matrix Size Error");		// UとUinvが同じサイズかチェック
-			Matrix I = Matrix<U.N,U.N,TT>::ident();			// 単位行列の生成
-			
-			// 正則にするためにk列より右下の対角成分を「1」にする
-			Matrix<U.N,U.N,TT> U2 = U;
-			for(size_t j = k + 1; j <= U.N; ++j){
-				U2.SetElement(j, j, 1);
-			}
-			
-			// k列までの逆行列を計算
-			Matrix<1,U.N,TT> x, b;
-			for(size_t n = 1; n <= k; ++n){
-				b = getcolumn(I, n);		// 単位行列のn列目を切り出してbベクトルとする
-				solve_upper_tri(U2, b, x);	// Ux = b の連立1次方程式をxについて解く
-				setcolumn(Uinv, x, n);		// xはUの逆行列のn列目となるので、Uinvのn列目にxを書き込む
-			}
-			// Uinvが最終的に得られる逆行列
+			inv_upper_tri_kernel(U, k, Uinv);
 		}
 		
 		//! @brief 左擬似逆行列を返す関数 (Aが縦長行列の場合)
+		//! A = Q*R のQR分解から R1^(-1)*Q1^H を計算する。A^H*A を作らないので，条件数が2乗にならない。
 		//! @param[in]	A	入力行列
 		//! @return	結果
 		constexpr friend Matrix<MM,NN,TT> lpinv(const Matrix& A){
 			static_assert(A.N < A.M, "Matrix Size Error");	// 縦長行列かチェック
-			return inv(tp(A)*A)*tp(A);
+			Matrix<MM,MM,TT> Q;
+			Matrix<NN,MM,TT> R;
+			QR(A, Q, R);
+			Matrix<MM,NN,TT> Y;
+			for(size_t c = 0; c < MM; ++c){
+				// Y の c列目 = R1^(-1)*(Q1^T の c列目) を後退代入で計算
+				for(size_t i = 0; i < NN; ++i) Y.Data[c][i] = conjugate(Q.Data[i][c]);
+				for(size_t j = NN; 0 < j; --j){
+					Y.Data[c][j-1] /= R.Data[j-1][j-1];
+					for(size_t i = 0; i < j - 1; ++i) Y.Data[c][i] -= R.Data[j-1][i]*Y.Data[c][j-1];
+				}
+			}
+			return Y;
 		}
 		
 		//! @brief 左擬似逆行列を返す関数 (Aが縦長行列の場合, 左上小行列のサイズ指定版)
@@ -1534,11 +1956,34 @@ class Matrix {
 		}
 		
 		//! @brief 右擬似逆行列を返す関数 (Aが横長行列の場合)
+		//! A^H = Q*R のQR分解から Q1*R1^(-H) を計算する。A*A^H を作らないので，条件数が2乗にならない。
 		//! @param[in]	A	入力行列
 		//! @return	結果
 		constexpr friend Matrix<MM,NN,TT> rpinv(const Matrix& A){
 			static_assert(A.M < A.N, "Matrix Size Error");	// 横長行列かチェック
-			return tp(A)*inv(A*tp(A));
+			Matrix<MM,NN,TT> At;	// 共役転置
+			for(size_t j = 0; j < NN; ++j){
+				for(size_t i = 0; i < MM; ++i) At.Data[i][j] = conjugate(A.Data[j][i]);
+			}
+			Matrix<NN,NN,TT> Q;
+			Matrix<MM,NN,TT> R;
+			QR(At, Q, R);
+			Matrix<MM,NN,TT> Y;
+			std::array<TT, MM> z = {};
+			for(size_t c = 0; c < MM; ++c){
+				// R1^T*z = e_c を前進代入で解いて，Y の c列目 = Q1*z を計算
+				for(size_t j = 0; j < MM; ++j){
+					TT s = (j == c) ? 1 : 0;
+					for(size_t i = 0; i < j; ++i) s -= conjugate(R.Data[j][i])*z[i];
+					z[j] = s/conjugate(R.Data[j][j]);
+				}
+				for(size_t r = 0; r < NN; ++r){
+					TT s = 0;
+					for(size_t j = 0; j < MM; ++j) s += Q.Data[j][r]*z[j];
+					Y.Data[c][r] = s;
+				}
+			}
+			return Y;
 		}
 		
 		//! @brief 右擬似逆行列を返す関数 (Aが横長行列の場合, 左上小行列のサイズ指定版)
@@ -1557,42 +2002,14 @@ class Matrix {
 		//! @return	結果
 		constexpr friend Matrix expm(const Matrix& U, size_t Order){
 			static_assert(U.N == U.M, "Matrix Size Error");	// 正方行列かチェック
-			int e = 0;
-			TT c = 1;
-			bool flag = false;
-			// ノルムでスケーリング
-			frexp(infnorm(U),&e);
-			Matrix<U.N,U.M,TT> A;
-			if(0 < e){
-				A = pow(0.5,e+1)*U;
-			}else{
-				e = 0;
-				A = 0.5*U;
-			}
-			// 行列のパデ近似の計算
-			Matrix<A.N,A.N,TT> I = ident();// 単位行列の生成
-			Matrix<A.N,A.N,TT> L = I, R = I, X = I, cX;
-			for(size_t i = 1; i <= Order; ++i){
-				c = c*(TT)(Order - i + 1)/(TT)(i*(2*Order - i + 1));	// パデ近似係数の計算
-				X = A*X;		// A^Mの計算
-				cX = c*X;		// cM*A^Mの計算
-				R += cX;		// R = I + c1*A + c2*A*A + c3*A*A*A + ... + cM*A^M
-				if(flag == true){
-					L += cX;	// L = I + c1*A + c2*A*A + c3*A*A*A + ... + cM*A^M の正の係数の場合
-				}else{
-					L -= cX;	// L = I + c1*A + c2*A*A + c3*A*A*A + ... + cM*A^M の負の係数の場合
-				}
-				flag = !flag;	// 正負係数の場合分け用フラグ
-			}
-			// スケールを元に戻す
-			Matrix Y = inv(L)*R;
-			for(size_t i = 0; i < (size_t)e + 1; ++i){
-				Y = Y*Y;
-			}
-			return Y;	// 最終的に得られる行列指数を返す
+			return ident() + expm1(U, Order);	// e^(U) = I + (e^(U) - I)
 		}
 		
 		//! @brief 指数行列の数値定積分[0,T]をする関数
+		//! シンプソン法の分点は等間隔なので，各分点の指数行列は1区間分の指数行列 e^(U*h) のべき乗になる。
+		//! そこで奇数番目と偶数番目の分点の和を G = e^(U*2h) の等比級数として2進法の倍々計算で求める。
+		//! h が小さいと e^(U*h) はほぼ単位行列になって情報が桁落ちするので，単位行列からの差分の形のまま計算する。
+		//! expm の計算は1回，行列積は log2(DIV) に比例する回数で済むので，定数式としても評価できる。
 		//! @param[in]	U	入力行列
 		//! @param[in]	T	積分範囲の終わり
 		//! @param[in]	DIV	分割数
@@ -1601,18 +2018,28 @@ class Matrix {
 		constexpr friend Matrix integral_expm(const Matrix& U, const TT T, const size_t DIV, const size_t P){
 			static_assert(U.N == U.M, "Matrix Size Error");	// 正方行列かチェック
 			const TT h = T/((TT)(2*DIV));	// 時間ステップ
-			TT t = 0;						// 時刻
-			// シンプソン法による定積分の実行
-			Matrix<U.N,U.M,TT> S1, S2;
-			for(size_t i = 1; i <= DIV; ++i){
-				t = h*(TT)(2*i - 1);
-				S1 += expm(U*t, P);
-			}
-			for(size_t i = 1; i <= DIV - 1; ++i){
-				t = h*(TT)(2*i);
-				S2 += expm(U*t, P);
+			const Matrix<U.N,U.M,TT> Fh = expm1(U*h, P);	// e^(U*h) - I
+			const Matrix<U.N,U.M,TT> Fg = Fh*Fh + 2.0*Fh;	// e^(U*2h) - I
+			
+			// 等比級数 I + G + G^2 + ... + G^(k-1) = k*I + Tg と G^k = I + Qg を DIV の上位ビットから倍々で計算
+			Matrix<U.N,U.M,TT> Tg, Qg;
+			TT k = 0;	// 等比級数の項数
+			size_t bit = 1;
+			while(bit <= DIV/2) bit *= 2;
+			for(; 0 < bit; bit /= 2){
+				Tg = 2.0*Tg + k*Qg + Qg*Tg;	// 項数を2倍にする
+				Qg = Qg*Qg + 2.0*Qg;
+				k *= 2;
+				if((DIV & bit) != 0){
+					Tg += Qg;				// 項を1つ追加する
+					Qg = Qg + Fg + Qg*Fg;
+					k += 1;
+				}
 			}
-			return h/3.0*( Matrix<U.N,U.N,TT>::eye() + 4.0*S1 + 2.0*S2 + expm(U*T,P) );	// 最終的な定積分結果を返す
+			
+			// シンプソン法による定積分の実行
+			// h/3*(I + 4*(奇数番目の分点の和) + 2*(偶数番目の分点の和) + e^(U*T)) を単位行列とそれ以外に分けて計算
+			return T*ident() + h/3.0*( (TT)(4*DIV)*Fh + 6.0*Tg + 4.0*Fh*Tg + Qg );	// 最終的な定積分結果を返す
 		}
 		
 		//! @brief 行列要素の指数関数を返す関数
@@ -1620,8 +2047,9 @@ class Matrix {
 		//! @return	結果
 		constexpr friend Matrix expe(const Matrix& U){
 			Matrix Y;
+			using std::exp;
 			for(size_t i = 0; i < U.N; ++i){
-				for(size_t j = 0; j < U.M; ++j) Y.Data[i][j] = std::exp(U.Data[i][j]);
+				for(size_t j = 0; j < U.M; ++j) Y.Data[i][j] = exp(U.Data[i][j]);
 			}
 			return Y;
 		}
@@ -1631,8 +2059,9 @@ class Matrix {
 		//! @return	結果
 		constexpr friend Matrix loge(const Matrix& U){
 			Matrix Y;
+			using std::log;
 			for(size_t i = 0; i < U.N; ++i){
-				for(size_t j = 0; j < U.M; ++j) Y.Data[i][j] = std::log(U.Data[i][j]);
+				for(size_t j = 0; j < U.M; ++j) Y.Data[i][j] = log(U.Data[i][j]);
 			}
 			return Y;
 		}
@@ -1642,8 +2071,9 @@ class Matrix {
 		//! @return	結果
 		constexpr friend Matrix abse(const Matrix& U){
 			Matrix Y;
+			using std::abs;
 			for(size_t i = 0; i < U.N; ++i){
-				for(size_t j = 0; j < U.M; ++j) Y.Data[i][j] = std::abs(U.Data[i][j]);
+				for(size_t j = 0; j < U.M; ++j) Y.Data[i][j] = abs(U.Data[i][j]);
 			}
 			return Y;
 		}
@@ -1653,8 +2083,9 @@ class Matrix {
 		//! @return	結果
 		constexpr friend Matrix sqrte(const Matrix& U){
 			Matrix Y;
+			using std::sqrt;
 			for(size_t i = 0; i < U.N; ++i){
-				for(size_t j = 0; j < U.M; ++j) Y.Data[i][j] = std::sqrt(U.Data[i][j]);
+				for(size_t j = 0; j < U.M; ++j) Y.Data[i][j] = sqrt(U.Data[i][j]);
 			}
 			return Y;
 		}
@@ -1663,8 +2094,9 @@ class Matrix {
 		//! @param[in]	U	入力行列
 		//! @param[out]	Y	結果
 		constexpr friend void sqrte(const Matrix& U, Matrix& Y){
+			using std::sqrt;
 			for(size_t i = 0; i < U.N; ++i){
-				for(size_t j = 0; j < U.M; ++j) Y.Data[i][j] = std::sqrt(U.Data[i][j]);
+				for(size_t j = 0; j < U.M; ++j) Y.Data[i][j] = sqrt(U.Data[i][j]);
 			}
 		}
 		
@@ -1673,8 +2105,9 @@ class Matrix {
 		//! @return	結果
 		constexpr friend Matrix tanhe(const Matrix& U){
 			Matrix Y;
+			using std::tanh;
 			for(size_t i = 0; i < U.N; ++i){
-				for(size_t j = 0; j < U.M; ++j) Y.Data[i][j] = std::tanh(U.Data[i][j]);
+				for(size_t j = 0; j < U.M; ++j) Y.Data[i][j] = tanh(U.Data[i][j]);
 			}
 			return Y;
 		}
@@ -1759,48 +2192,40 @@ class Matrix {
 		}
 		
 		//! @brief 固有値を返す関数
+		//! 上ヘッセンベルグ行列に相似変換してから，実数行列はフランシスのダブルシフトQR法，
+		//! 複素数行列はウィルキンソンシフト付きQR法で，収束した固有値から順に行列を縮小しながら計算する。
 		//! @param[in]	U	入力行列
 		//! @return	結果
 		constexpr friend Matrix<1,NN,std::complex<double>> eigen(const Matrix<NN,MM,TT>& U){
 			static_assert(NN == MM, "Matrix Size Error");	// 正方行列のみ対応
-			constexpr size_t LoopMax = 100*std::max(NN,MM);	// ループ打ち切り最大回数
-			constexpr auto I = Matrix<NN,NN,std::complex<double>>::eye();	// 単位行列
-			Matrix<NN,NN,std::complex<double>> A, Q, R;
-			std::complex<double> a, b, c, d, mu;
+			Matrix<1,NN,std::complex<double>> Lambda;
 			
 			if constexpr(std::is_same_v<TT, std::complex<double>>){
 				// 入力が複素数型の場合
-				A = U;
+				Matrix<NN,NN,std::complex<double>> H = U;
+				Hessenberg(H);
+				ComplexShiftedQR(H, Lambda);
 			}else{
 				// 入力が実数型の場合
-				A.real(U);
-			}
-			
-			// 複素数QR法による固有値計算
-			for(size_t k = 1; k < LoopMax; ++k){
-				// Aの最右下2×2小行列の固有値を求める
-				a = A.GetElement(NN - 1, NN - 1);
-				b = A.GetElement(NN    , NN - 1);
-				c = A.GetElement(NN - 1, NN    );
-				d = A.GetElement(NN    , NN    );
-				mu = ( (a + d) + std::sqrt((a + d)*(a + d) - 4.0*(a*d - b*c)) )/2.0;
-				
-				// QR分解と収束計算
-				QR(A - mu*I, Q, R);
-				A = R*Q + mu*I;
-				
-				if(std::abs(std::abs(tr(Q)) - (double)NN) < epsilon) break;	// 単位行列に漸近したらループ打ち切り
+				Matrix<NN,NN,double> H;
+				for(size_t i = 0; i < NN; ++i){
+					for(size_t j = 0; j < NN; ++j) H.Data[i][j] = static_cast<double>(U.Data[i][j]);
+				}
+				Hessenberg(H);
+				FrancisQR(H, Lambda);
 			}
 			
-			return diag(A);	// Aの対角要素が固有値
+			return Lambda;	// 固有値は収束したときの対角要素の位置の順に並ぶ
 		}
 		
 		//! @brief 最大固有値の固有ベクトルを返す関数
+		//! 絶対値最大の固有値を eigen で求めてから，そのシフトを使った逆反復法で計算する。
+		//! 固有ベクトルは絶対値最大の要素が正の実数になるように正規化される。
 		//! @param[in]	U	入力行列
 		//! @return	結果
 		constexpr friend Matrix<1,NN,std::complex<double>> eigenvec(const Matrix<NN,MM,TT>& U){
 			static_assert(NN == MM, "Matrix Size Error");	// 正方行列のみ対応
-			constexpr size_t LoopMax = 100*std::max(NN,MM);	// ループ打ち切り最大回数
+			constexpr size_t LoopMax = 3;	// 逆反復の回数 (シフトが固有値にほぼ一致するので数回で収束する)
 			Matrix<NN,NN,std::complex<double>> A;
 			
 			if constexpr(std::is_same_v<TT, std::complex<double>>){
@@ -1811,13 +2236,65 @@ class Matrix {
 				A.real(U);
 			}
 			
-			// べき乗法による固有ベクトル計算
+			// 絶対値最大の固有値を求める
+			const Matrix<1,NN,std::complex<double>> Lambda = eigen(U);
+			std::complex<double> mu = Lambda.Data[0][0];
+			for(size_t i = 1; i < NN; ++i){
+				if(std::abs(mu) < std::abs(Lambda.Data[0][i])) mu = Lambda.Data[0][i];
+			}
+			
+			// A - mu*I を部分ピボット選択付きでLU分解する
+			double Amax = 0;
+			for(size_t i = 0; i < NN; ++i){
+				for(size_t j = 0; j < NN; ++j) Amax = std::max(Amax, std::abs(A.Data[i][j]));
+			}
+			const double tiny = std::numeric_limits<double>::epsilon()*(Amax == 0 ? 1.0 : Amax);	// ピボットの最小値
+			for(size_t i = 0; i < NN; ++i) A.Data[i][i] -= mu;
+			std::array<size_t, NN> piv = {};
+			for(size_t k = 0; k < NN; ++k){
+				size_t p = k;
+				for(size_t i = k + 1; i < NN; ++i){
+					if(std::abs(A.Data[k][p]) < std::abs(A.Data[k][i])) p = i;
+				}
+				piv[k] = p;
+				if(p != k){
+					for(size_t j = 0; j < NN; ++j){
+						const std::complex<double> w = A.Data[j][k];
+						A.Data[j][k] = A.Data[j][p];
+						A.Data[j][p] = w;
+					}
+				}
+				if(std::abs(A.Data[k][k]) < tiny) A.Data[k][k] = tiny;	// シフトが固有値なので特異になるが，微小値で置き換えて解く
+				for(size_t i = k + 1; i < NN; ++i) A.Data[k][i] /= A.Data[k][k];
+				for(size_t j = k + 1; j < NN; ++j){
+					const std::complex<double> f = A.Data[j][k];
+					for(size_t i = k + 1; i < NN; ++i) A.Data[j][i] -= A.Data[k][i]*f;
+				}
+			}
+			
+			// 逆反復法による固有ベクトル計算
 			auto x = Matrix<1,NN,std::complex<double>>::ones();
-			auto y = Matrix<1,NN,std::complex<double>>::ones();
-			for(size_t k = 1; k < LoopMax; ++k){
-				y = A*x;
-				x = y/euclidnorm(y);
+			for(size_t l = 0; l < LoopMax; ++l){
+				for(size_t k = 0; k < NN; ++k){
+					const std::complex<double> w = x.Data[0][k];
+					x.Data[0][k] = x.Data[0][piv[k]];
+					x.Data[0][piv[k]] = w;
+					for(size_t i = 0; i < k; ++i) x.Data[0][k] -= A.Data[i][k]*x.Data[0][i];	// 前進代入
+				}
+				for(size_t k = NN; 0 < k; --k){
+					for(size_t i = k; i < NN; ++i) x.Data[0][k-1] -= A.Data[i][k-1]*x.Data[0][i];	// 後退代入
+					x.Data[0][k-1] /= A.Data[k-1][k-1];
+				}
+				x = x/euclidnorm(x);
+			}
+			
+			// 絶対値最大の要素が正の実数になるように位相を揃える
+			size_t imax = 0;
+			for(size_t i = 1; i < NN; ++i){
+				if(std::abs(x.Data[0][imax]) < std::abs(x.Data[0][i])) imax = i;
 			}
+			const std::complex<double> ph = std::conj(x.Data[0][imax])/std::abs(x.Data[0][imax]);
+			for(size_t i = 0; i < NN; ++i) x.Data[0][i] *= ph;
 			
 			return x;
 		}
@@ -1851,10 +2328,480 @@ class Matrix {
 			return ret;
 		}
 		
+		//! @brief 2の何乗でスケーリングすれば良いかを返す関数 (frexp の指数部の定数式版)
+		//! @param[in]	u	入力 (非負)
+		//! @return	u = f*2^e, 0.5 ≦ f < 1 となる e (u = 0 のときは 0)
+		static constexpr int exponent2(TT u){
+			int e = 0;
+			if(u <= (TT)0) return e;
+			while((TT)1 <= u){
+				u /= (TT)2;
+				++e;
+			}
+			while(u < (TT)0.5){
+				u *= (TT)2;
+				--e;
+			}
+			return e;
+		}
+		
+		//! @brief 2のべき乗を返す関数 (pow(2,e) の定数式版，丸め誤差なし)
+		//! @param[in]	e	指数
+		//! @return	2^e
+		static constexpr TT pow2(const int e){
+			TT ret = 1;
+			for(int i = 0; i < e; ++i) ret *= (TT)2;
+			for(int i = 0; e < i; --i) ret /= (TT)2;
+			return ret;
+		}
+		
+		//! @brief 行列指数関数から単位行列を引いた e^(U) - I を返す関数
+		//! パデ近似 e^(U) ≒ L^(-1)*R の L と R の差から計算するので，U が小さくても桁落ちしない。
+		//! @param[in]	U	入力行列
+		//! @param[in]	Order	パデ近似の次数
+		//! @return	結果
+		static constexpr Matrix expm1(const Matrix& U, size_t Order){
+			TT c = 1;
+			bool flag = false;
+			// ノルムでスケーリング (frexp と pow の代わりに定数式で評価できる関数を使う)
+			int e = exponent2(infnorm(U));
+			Matrix<U.N,U.M,TT> A;
+			if(0 < e){
+				A = pow2(-(e + 1))*U;
+			}else{
+				e = 0;
+				A = 0.5*U;
+			}
+			// 行列のパデ近似の計算
+			Matrix<A.N,A.N,TT> I = ident();// 単位行列の生成
+			Matrix<A.N,A.N,TT> L = I, D, X = I, cX;
+			for(size_t i = 1; i <= Order; ++i){
+				c = c*(TT)(Order - i + 1)/(TT)(i*(2*Order - i + 1));	// パデ近似係数の計算
+				X = A*X;		// A^Mの計算
+				cX = c*X;		// cM*A^Mの計算
+				if(flag == true){
+					L += cX;	// L = I - c1*A + c2*A*A - c3*A*A*A + ... の正の係数の場合
+				}else{
+					L -= cX;	// L = I - c1*A + c2*A*A - c3*A*A*A + ... の負の係数の場合
+					D += cX;	// R - L = 2*(c1*A + c3*A*A*A + ...) の奇数次の項
+				}
+				flag = !flag;	// 正負係数の場合分け用フラグ
+			}
+			// L^(-1)*R - I = L^(-1)*(R - L)
+			Matrix Y = inv(L)*(2.0*D);
+			// スケールを元に戻す (I + Y)^2 - I = Y*Y + 2*Y
+			for(size_t i = 0; i < (size_t)e + 1; ++i){
+				Y = Y*Y + 2.0*Y;
+			}
+			return Y;	// 最終的に得られる e^(U) - I を返す
+		}
+		
+		//! @brief 上三角行列の左上k×kの逆行列をUinvのk列目までに書き込む関数
+		//! @param[in]	U	上三角行列
+		//! @param[in]	k	左上小行列のサイズ
+		//! @param[out]	Uinv	逆行列 (UとUinvは異なる行列であること)
+		static constexpr void inv_upper_tri_kernel(const Matrix& U, const size_t k, Matrix& Uinv){
+			for(size_t j = 0; j < k; ++j){
+				// Uinv の j列目 = U^(-1)*e_j を，対角から上だけ列ごとに連続した順の後退代入で計算
+				for(size_t i = 0; i < MM; ++i) Uinv.Data[j][i] = 0;
+				Uinv.Data[j][j] = 1;
+				for(size_t l = j + 1; 0 < l; --l){
+					const TT x = Uinv.Data[j][l-1]/U.Data[l-1][l-1];
+					Uinv.Data[j][l-1] = x;
+					for(size_t i = 0; i < l - 1; ++i) Uinv.Data[j][i] -= U.Data[l-1][i]*x;
+				}
+			}
+		}
+		
+		//! @brief 複素共役を返す関数 (実数型のときはそのまま返す)
+		//! @param[in]	u	入力
+		//! @return	結果
+		template <typename T2>
+		static constexpr T2 conjugate(const T2& u){
+			if constexpr(std::is_same_v<T2, std::complex<double>>){
+				return std::conj(u);
+			}else{
+				return u;
+			}
+		}
+		
+		//! @brief ハウスホルダー変換による相似変換で上ヘッセンベルグ行列にする関数
+		//! @tparam	T2	要素の型 (doubleかstd::complex<double>)
+		//! @param[in,out]	H	入力行列→上ヘッセンベルグ行列 (固有値は変わらない)
+		template <typename T2>
+		static constexpr void Hessenberg(Matrix<NN,NN,T2>& H){
+			std::array<T2, NN> v = {}, w = {};
+			for(size_t k = 0; k + 2 < NN; ++k){
+				// k列目の(k+2)行目以降をゼロにする鏡映ベクトル v を作る (P = I - tau*v*v^H)
+				double xnorm = 0;
+				for(size_t i = k + 1; i < NN; ++i) xnorm += std::abs(H.Data[k][i])*std::abs(H.Data[k][i]);
+				xnorm = std::sqrt(xnorm);
+				if(xnorm == 0) continue;	// 既にゼロのとき
+				const double x0 = std::abs(H.Data[k][k+1]);
+				const T2 ph = x0 == 0 ? T2(1) : H.Data[k][k+1]/x0;	// 先頭要素の位相(符号)
+				for(size_t i = k + 1; i < NN; ++i) v[i] = H.Data[k][i];
+				v[k+1] += ph*xnorm;		// 桁落ちしない向きに鏡映する
+				const double tau = 1.0/(xnorm*(xnorm + x0));
+				
+				// 左から掛ける (k列目の結果は既知なので直接代入)
+				H.Data[k][k+1] = -ph*xnorm;
+				for(size_t i = k + 2; i < NN; ++i) H.Data[k][i] = 0;
+				for(size_t j = k + 1; j < NN; ++j){
+					T2 s = 0;
+					for(size_t i = k + 1; i < NN; ++i) s += conjugate(v[i])*H.Data[j][i];
+					s *= tau;
+					for(size_t i = k + 1; i < NN; ++i) H.Data[j][i] -= s*v[i];
+				}
+				
+				// 右から掛ける (列ごとに連続した順で計算)
+				for(size_t i = 0; i < NN; ++i) w[i] = 0;
+				for(size_t j = k + 1; j < NN; ++j){
+					for(size_t i = 0; i < NN; ++i) w[i] += H.Data[j][i]*v[j];
+				}
+				for(size_t j = k + 1; j < NN; ++j){
+					const T2 s = tau*conjugate(v[j]);
+					for(size_t i = 0; i < NN; ++i) H.Data[j][i] -= w[i]*s;
+				}
+			}
+		}
+		
+		//! @brief フランシスのダブルシフトQR法で実数の上ヘッセンベルグ行列の固有値を求める関数
+		//! 共役複素数の固有値の組は2×2ブロックとして実数演算のまま分離される。
+		//! @param[in,out]	H	上ヘッセンベルグ行列 (計算後は破壊される)
+		//! @param[out]	Lambda	固有値 (対角要素の位置の順)
+		static constexpr void FrancisQR(Matrix<NN,NN,double>& H, Matrix<1,NN,std::complex<double>>& Lambda){
+			constexpr long ITERMAX = 60;	// 固有値1個あたりの反復回数の上限
+			auto a = [&H](const long i, const long j) -> double& { return H.Data[j-1][i-1]; };	// 1始まりの(i行, j列)要素
+			
+			double anorm = 0;	// 下副対角がゼロのときの収束判定用ノルム
+			for(long i = 1; i <= (long)NN; ++i){
+				for(long j = std::max(i - 1, 1L); j <= (long)NN; ++j) anorm += std::abs(a(i,j));
+			}
+			
+			long nn = NN;	// 未収束の範囲の右下端
+			long its = 0;	// 今の固有値の反復回数
+			double t = 0;	// 例外シフトの累積
+			while(1 <= nn){
+				// 下副対角の小さい要素を探して行列を分割する
+				long l = nn;
+				for(; 2 <= l; --l){
+					double s = std::abs(a(l-1,l-1)) + std::abs(a(l,l));
+					if(s == 0) s = anorm;
+					if(std::abs(a(l,l-1)) + s == s){
+						a(l,l-1) = 0;
+						break;
+					}
+				}
+				
+				double x = a(nn,nn);
+				if(l == nn){
+					// 1×1ブロックが分離したとき
+					Lambda.Data[0][nn-1] = x + t;
+					--nn;
+					its = 0;
+					continue;
+				}
+				double y = a(nn-1,nn-1);
+				double w = a(nn,nn-1)*a(nn-1,nn);
+				if(l == nn - 1){
+					// 2×2ブロックが分離したとき
+					const double p = 0.5*(y - x), q = p*p + w;
+					double z = std::sqrt(std::abs(q));
+					x += t;
+					if(0 <= q){
+						// 実数固有値の組
+						z = p + (0 <= p ? z : -z);
+						Lambda.Data[0][nn-2] = x + z;
+						Lambda.Data[0][nn-1] = z != 0 ? x - w/z : x + z;
+					}else{
+						// 共役複素数固有値の組
+						Lambda.Data[0][nn-2] = std::complex<double>(x + p,  z);
+						Lambda.Data[0][nn-1] = std::complex<double>(x + p, -z);
+					}
+					nn -= 2;
+					its = 0;
+					continue;
+				}
+				if(ITERMAX <= its){
+					// 収束しないときは右下の対角要素を固有値とみなして打ち切る
+					Lambda.Data[0][nn-1] = x + t;
+					--nn;
+					its = 0;
+					continue;
+				}
+				
+				// 10回ごとに周期的な停滞を崩すための例外シフトを入れる
+				if(its != 0 && its % 10 == 0){
+					t += x;
+					for(long i = 1; i <= nn; ++i) a(i,i) -= x;
+					const double s = std::abs(a(nn,nn-1)) + std::abs(a(nn-1,nn-2));
+					x = y = 0.75*s;
+					w = -0.4375*s*s;
+				}
+				++its;
+				
+				// 下副対角の連続する2つの要素が小さい位置を探す
+				long m = nn - 2;
+				double p = 0, q = 0, r = 0, z = 0;
+				for(; l <= m; --m){
+					z = a(m,m);
+					r = x - z;
+					double s = y - z;
+					p = (r*s - w)/a(m+1,m) + a(m,m+1);
+					q = a(m+1,m+1) - z - r - s;
+					r = a(m+2,m+1);
+					s = std::abs(p) + std::abs(q) + std::abs(r);
+					p /= s;
+					q /= s;
+					r /= s;
+					if(m == l) break;
+					const double u = std::abs(a(m,m-1))*(std::abs(q) + std::abs(r));
+					const double v = std::abs(p)*(std::abs(a(m-1,m-1)) + std::abs(z) + std::abs(a(m+1,m+1)));
+					if(u + v == v) break;
+				}
+				for(long i = m + 2; i <= nn; ++i){
+					a(i,i-2) = 0;
+					if(i != m + 2) a(i,i-3) = 0;
+				}
+				
+				// ダブルシフトQRステップ (3×3ハウスホルダー変換でバルジを右下へ追い出す)
+				for(long k = m; k <= nn - 1; ++k){
+					if(k != m){
+						p = a(k,k-1);
+						q = a(k+1,k-1);
+						r = k != nn - 1 ? a(k+2,k-1) : 0;
+						x = std::abs(p) + std::abs(q) + std::abs(r);
+						if(x != 0){
+							p /= x;
+							q /= x;
+							r /= x;
+						}
+					}
+					const double s = (0 <= p ? 1.0 : -1.0)*std::sqrt(p*p + q*q + r*r);
+					if(s == 0) continue;
+					if(k == m){
+						if(l != m) a(k,k-1) = -a(k,k-1);
+					}else{
+						a(k,k-1) = -s*x;
+					}
+					p += s;
+					x = p/s;
+					y = q/s;
+					z = r/s;
+					q /= p;
+					r /= p;
+					for(long j = k; j <= nn; ++j){
+						p = a(k,j) + q*a(k+1,j);
+						if(k != nn - 1){
+							p += r*a(k+2,j);
+							a(k+2,j) -= p*z;
+						}
+						a(k+1,j) -= p*y;
+						a(k,j) -= p*x;
+					}
+					const long imax = std::min(nn, k + 3);
+					for(long i = l; i <= imax; ++i){
+						p = x*a(i,k) + y*a(i,k+1);
+						if(k != nn - 1){
+							p += z*a(i,k+2);
+							a(i,k+2) -= p*r;
+						}
+						a(i,k+1) -= p*q;
+						a(i,k) -= p;
+					}
+				}
+			}
+		}
+		
+		//! @brief ウィルキンソンシフト付きQR法で複素数の上ヘッセンベルグ行列の固有値を求める関数
+		//! @param[in,out]	H	上ヘッセンベルグ行列 (計算後は破壊される)
+		//! @param[out]	Lambda	固有値 (対角要素の位置の順)
+		static constexpr void ComplexShiftedQR(Matrix<NN,NN,std::complex<double>>& H, Matrix<1,NN,std::complex<double>>& Lambda){
+			constexpr size_t ITERMAX = 60;	// 固有値1個あたりの反復回数の上限
+			auto h = [&H](const size_t i, const size_t j) -> std::complex<double>& { return H.Data[j][i]; };	// 0始まりの(i行, j列)要素
+			std::array<double, NN> c = {};				// ギブンス回転の余弦
+			std::array<std::complex<double>, NN> s = {};	// ギブンス回転の正弦
+			
+			double anorm = 0;	// 下副対角がゼロのときの収束判定用ノルム
+			for(size_t i = 0; i < NN; ++i){
+				for(size_t j = (0 < i ? i - 1 : 0); j < NN; ++j) anorm += std::abs(h(i,j));
+			}
+			
+			size_t hi = NN - 1;	// 未収束の範囲の右下端
+			size_t its = 0;		// 今の固有値の反復回数
+			while(true){
+				// 下副対角の小さい要素を探して行列を分割する
+				size_t l = hi;
+				for(; 0 < l; --l){
+					double tst = std::abs(h(l-1,l-1)) + std::abs(h(l,l));
+					if(tst == 0) tst = anorm;
+					if(std::abs(h(l,l-1)) + tst == tst){
+						h(l,l-1) = 0;
+						break;
+					}
+				}
+				if(l == hi || ITERMAX <= its){
+					// 1×1ブロックが分離したとき (収束しないときは右下の対角要素を固有値とみなして打ち切る)
+					Lambda.Data[0][hi] = h(hi,hi);
+					if(hi == 0) break;
+					--hi;
+					its = 0;
+					continue;
+				}
+				
+				// シフト量 (右下2×2小行列の固有値のうち右下の要素に近い方，10回ごとに例外シフト)
+				std::complex<double> mu = h(hi,hi);
+				if(its != 0 && its % 10 == 0){
+					mu += std::abs(h(hi,hi-1));
+				}else{
+					const std::complex<double> d = 0.5*(h(hi-1,hi-1) - h(hi,hi)), bc = h(hi-1,hi)*h(hi,hi-1);
+					const std::complex<double> r = std::sqrt(d*d + bc);
+					const std::complex<double> den = std::abs(d - r) <= std::abs(d + r) ? d + r : d - r;
+					if(den != 0.0) mu -= bc/den;
+				}
+				++its;
+				
+				// H - mu*I = QR としてギブンス回転で上三角化し，H = RQ + mu*I とする
+				for(size_t i = l; i <= hi; ++i) h(i,i) -= mu;
+				for(size_t k = l; k < hi; ++k){
+					const std::complex<double> x = h(k,k), y = h(k+1,k);
+					const double xa = std::abs(x), ra = std::sqrt(xa*xa + std::abs(y)*std::abs(y));
+					if(ra == 0){
+						c[k] = 1;
+						s[k] = 0;
+						continue;
+					}
+					c[k] = xa/ra;
+					s[k] = xa == 0 ? std::complex<double>(1) : (x/xa)*std::conj(y)/ra;
+					for(size_t j = k; j <= hi; ++j){
+						const std::complex<double> u = h(k,j), v = h(k+1,j);
+						h(k,j) = c[k]*u + s[k]*v;
+						h(k+1,j) = c[k]*v - std::conj(s[k])*u;
+					}
+				}
+				for(size_t k = l; k < hi; ++k){
+					for(size_t i = l; i <= std::min(k + 2, hi); ++i){
+						const std::complex<double> u = h(i,k), v = h(i,k+1);
+						h(i,k) = c[k]*u + std::conj(s[k])*v;
+						h(i,k+1) = c[k]*v - s[k]*u;
+					}
+				}
+				for(size_t i = l; i <= hi; ++i) h(i,i) += mu;
+			}
+		}
+		
+		//! @brief 片側ヤコビ法による特異値分解の本体 (行数 R ≧ 列数 C の行列用)
+		//! 2列ずつ直交するように回転させることを全列の組について繰り返し，A*V = W の W の各列のノルムを特異値とする。
+		//! @param[in]	A	入力行列 (C列×R行)
+		//! @param[out]	U	左特異ベクトル (R×R の直交行列)
+		//! @param[out]	s	特異値 (降順)
+		//! @param[out]	V	右特異ベクトル (C×C の直交行列)
+		template <size_t C, size_t R>
+		static constexpr void JacobiSVD(const Matrix<C,R,TT>& A, Matrix<R,R,TT>& U, Matrix<1,C,TT>& s, Matrix<C,C,TT>& V){
+			static_assert(C <= R, "Matrix Size Error");
+			constexpr size_t SweepMax = 60;	// 全列の組の回転を繰り返す回数の上限
+			constexpr TT tol = std::numeric_limits<TT>::epsilon()*R;	// 直交しているとみなす閾値
+			Matrix<C,R,TT> W = A;
+			V = Matrix<C,C,TT>::eye();
+			
+			// 列の組ごとの回転
+			for(size_t l = 0; l < SweepMax; ++l){
+				bool Rotated = false;
+				for(size_t p = 0; p + 1 < C; ++p){
+					for(size_t q = p + 1; q < C; ++q){
+						TT alpha = 0, beta = 0, gamma = 0;
+						for(size_t i = 0; i < R; ++i){
+							alpha += W.Data[p][i]*W.Data[p][i];
+							beta  += W.Data[q][i]*W.Data[q][i];
+							gamma += W.Data[p][i]*W.Data[q][i];
+						}
+						if(std::abs(gamma) <= tol*std::sqrt(alpha*beta)) continue;	// 既に直交しているとき
+						Rotated = true;
+						const TT zeta = (beta - alpha)/(2*gamma);
+						const TT t = sgn(zeta)/(std::abs(zeta) + std::sqrt(1 + zeta*zeta));
+						const TT cs = 1/std::sqrt(1 + t*t), sn = cs*t;
+						for(size_t i = 0; i < R; ++i){
+							const TT wp = W.Data[p][i], wq = W.Data[q][i];
+							W.Data[p][i] = cs*wp - sn*wq;
+							W.Data[q][i] = sn*wp + cs*wq;
+						}
+						for(size_t i = 0; i < C; ++i){
+							const TT vp = V.Data[p][i], vq = V.Data[q][i];
+							V.Data[p][i] = cs*vp - sn*vq;
+							V.Data[q][i] = sn*vp + cs*vq;
+						}
+					}
+				}
+				if(Rotated == false) break;	// すべての列の組が直交したら終了
+			}
+			
+			// 特異値を求めて降順に並べ替える
+			for(size_t j = 0; j < C; ++j){
+				TT n2 = 0;
+				for(size_t i = 0; i < R; ++i) n2 += W.Data[j][i]*W.Data[j][i];
+				s.Data[0][j] = std::sqrt(n2);
+			}
+			for(size_t j = 0; j < C; ++j){
+				size_t k = j;
+				for(size_t i = j + 1; i < C; ++i){
+					if(s.Data[0][k] < s.Data[0][i]) k = i;
+				}
+				if(k == j) continue;
+				const TT sw = s.Data[0][j];
+				s.Data[0][j] = s.Data[0][k];
+				s.Data[0][k] = sw;
+				for(size_t i = 0; i < R; ++i){
+					const TT ww = W.Data[j][i];
+					W.Data[j][i] = W.Data[k][i];
+					W.Data[k][i] = ww;
+				}
+				for(size_t i = 0; i < C; ++i){
+					const TT vw = V.Data[j][i];
+					V.Data[j][i] = V.Data[k][i];
+					V.Data[k][i] = vw;
+				}
+			}
+			
+			// 非ゼロの特異値に対応する左特異ベクトル
+			U = Matrix<R,R,TT>::zeros();
+			size_t r = 0;
+			for(; r < C && s.Data[0][0]*tol < s.Data[0][r]; ++r){
+				for(size_t i = 0; i < R; ++i) U.Data[r][i] = W.Data[r][i]/s.Data[0][r];
+			}
+			
+			// 残りの列は，既存の列との直交成分が最大になる単位ベクトルから作った正規直交基底で埋める
+			for(size_t j = r; j < R; ++j){
+				size_t e = 0;
+				TT emax = -1;
+				for(size_t i = 0; i < R; ++i){
+					TT n2 = 1;
+					for(size_t k = 0; k < j; ++k) n2 -= U.Data[k][i]*U.Data[k][i];
+					if(emax < n2){
+						emax = n2;
+						e = i;
+					}
+				}
+				U.Data[j][e] = 1;
+				for(size_t l = 0; l < 2; ++l){	// 精度のため2回直交化する
+					for(size_t k = 0; k < j; ++k){
+						TT d = 0;
+						for(size_t i = 0; i < R; ++i) d += U.Data[k][i]*U.Data[j][i];
+						for(size_t i = 0; i < R; ++i) U.Data[j][i] -= d*U.Data[k][i];
+					}
+				}
+				TT n2 = 0;
+				for(size_t i = 0; i < R; ++i) n2 += U.Data[j][i]*U.Data[j][i];
+				const TT n = std::sqrt(n2);
+				for(size_t i = 0; i < R; ++i) U.Data[j][i] /= n;
+			}
+		}
+		
 	public:
 		static constexpr size_t N = NN;			//!< 行列の幅(列の数, 横)
 		static constexpr size_t M = MM;			//!< 行列の高さ(行の数, 縦)
-		std::array<std::array<TT, M>, N> Data;	//!< データ格納用変数 配列要素の順番は Data[N列(横)][M行(縦)] なので注意
+		using value_type = TT;					//!< データ型
+		static constexpr size_t ALIGN = 64 <= sizeof(TT)*N*M ? 64 : (32 <= sizeof(TT)*N*M ? 32 : alignof(TT));	//!< データ格納用変数のアライメント [bytes]
+		alignas(ALIGN) std::array<std::array<TT, M>, N> Data;	//!< データ格納用変数 配列要素の順番は Data[N列(横)][M行(縦)] なので注意
 };
 }
 
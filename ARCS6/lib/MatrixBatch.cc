@@ -0,0 +1,14 @@
+//! @file MatrixBatch.cc
+//! @brief 多軸一括行列クラス(テンプレート版)
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+
+#include "MatrixBatch.hh"
+
+// テンプレートのため，実体もヘッダ側に実装。
+
@@ -0,0 +1,315 @@
+//! @file MatrixBatch.hh
+//! @brief 多軸一括行列クラス(テンプレート版)
+//!
+//! 同じ大きさのK個の行列(例えば多軸の各軸の状態空間モデル)を，同じ位置の要素をK軸分並べて格納し，
+//! SIMDレジスタの1レーンを1軸に割り当てて，K軸分の行列積，加減算，状態方程式の計算をまとめて行うクラス。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・格納は Data[列][行][軸] の構造体配列(SoA)形式。同じ要素のK軸分が連続しているので，各軸の計算がそのままSIMDの1命令になる。
+// ・軸数はSIMDレジスタのレーン数の倍数まで切り上げて確保する(余りのレーンは零のまま計算されるだけで，外からは見えない)。
+//   SIMDが使えない型や ARCS_MATRIX_NOSIMD のときは1レーンとして普通のループで計算する。
+// ・軸番号は std::array と同じく 0 始まり，行と列の番号は Matrix と同じく 1 始まり。
+// ・1軸ずつの計算とは浮動小数点の加算の順番が同じで，FMAによる丸めの違いのみが生じる。
+
+#ifndef MATRIXBATCH
+#define MATRIXBATCH
+
+#include <cassert>
+#include <array>
+#include "Matrix.hh"
+#include "MatrixSIMD.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 多軸一括計算のレーン操作の定義(SIMD非対応型の場合，1レーン)
+//! @tparam	TT	データ型
+//! @tparam	SIMD	SIMD対応フラグ
+template <typename TT, bool SIMD = SIMDregister<TT>::ENABLED>
+struct BatchLane {
+	using reg = TT;						//!< レジスタ型
+	static constexpr size_t LANE = 1;	//!< 1レジスタあたりの要素数
+	static reg load(const TT* p){ return *p; }
+	static void store(TT* p, reg a){ *p = a; }
+	static reg add(reg a, reg b){ return a + b; }
+	static reg sub(reg a, reg b){ return a - b; }
+	static reg mul(reg a, reg b){ return a*b; }
+	static reg fmadd(reg a, reg b, reg c){ return a*b + c; }	// a*b + c
+};
+
+//! @brief 多軸一括計算のレーン操作の定義(SIMD対応型の場合)
+//! @tparam	TT	データ型
+template <typename TT>
+struct BatchLane<TT, true> : public SIMDregister<TT> {};
+
+//! @brief 多軸一括行列クラス
+//! @tparam	K	軸数
+//! @tparam	NN	各行列の幅
+//! @tparam	MM	各行列の高さ
+//! @tparam	TT	データ型(デフォルトはdouble型)
+template <size_t K, size_t NN, size_t MM, typename TT = double>
+class MatrixBatch {
+	public:
+		using Lane = BatchLane<TT>;	//!< レーン操作
+		static constexpr size_t KP = (K + Lane::LANE - 1)/Lane::LANE*Lane::LANE;	//!< レーン数の倍数に切り上げた軸数
+		
+		//! @brief コンストラクタ(零行列)
+		constexpr MatrixBatch()
+			: Data()
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(全軸に同じ行列を設定)
+		//! @param[in]	U	各軸の行列
+		constexpr explicit MatrixBatch(const Matrix<NN,MM,TT>& U)
+			: Data()
+		{
+			for(size_t k = 0; k < K; ++k) SetMatrix(k, U);
+		}
+		
+		//! @brief k軸目の行列を設定する関数
+		//! @param[in]	k	軸番号 (0始まり)
+		//! @param[in]	U	k軸目の行列
+		constexpr void SetMatrix(const size_t k, const Matrix<NN,MM,TT>& U){
+			arcs_assert(k < K);	// 軸番号チェック
+			for(size_t i = 0; i < NN; ++i){
+				for(size_t j = 0; j < MM; ++j) Data[i][j][k] = U.Data[i][j];
+			}
+		}
+		
+		//! @brief k軸目の行列を返す関数
+		//! @param[in]	k	軸番号 (0始まり)
+		//! @return	k軸目の行列
+		constexpr Matrix<NN,MM,TT> GetMatrix(const size_t k) const {
+			arcs_assert(k < K);	// 軸番号チェック
+			Matrix<NN,MM,TT> U;
+			for(size_t i = 0; i < NN; ++i){
+				for(size_t j = 0; j < MM; ++j) U.Data[i][j] = Data[i][j][k];
+			}
+			return U;
+		}
+		
+		//! @brief n列m行目の要素を全軸分まとめて設定する関数(std::array版)
+		//! @param[in]	n	列番号 (1始まり)
+		//! @param[in]	m	行番号 (1始まり)
+		//! @param[in]	v	全軸分の要素の配列
+		constexpr void SetLanes(const size_t n, const size_t m, const std::array<TT,K>& v){
+			arcs_assert(0 < n && n <= NN && 0 < m && m <= MM);	// 要素番号チェック
+			for(size_t k = 0; k < K; ++k) Data[n-1][m-1][k] = v[k];
+		}
+		
+		//! @brief n列m行目の要素を全軸分まとめて設定する関数(縦ベクトル版)
+		//! @param[in]	n	列番号 (1始まり)
+		//! @param[in]	m	行番号 (1始まり)
+		//! @param[in]	v	全軸分の要素の縦ベクトル
+		constexpr void SetLanes(const size_t n, const size_t m, const Matrix<1,K,TT>& v){
+			SetLanes(n, m, v.Data[0]);
+		}
+		
+		//! @brief n列m行目の要素を全軸分まとめて取得する関数(std::array版)
+		//! @param[in]	n	列番号 (1始まり)
+		//! @param[in]	m	行番号 (1始まり)
+		//! @param[out]	v	全軸分の要素の配列
+		constexpr void GetLanes(const size_t n, const size_t m, std::array<TT,K>& v) const {
+			arcs_assert(0 < n && n <= NN && 0 < m && m <= MM);	// 要素番号チェック
+			for(size_t k = 0; k < K; ++k) v[k] = Data[n-1][m-1][k];
+		}
+		
+		//! @brief n列m行目の要素を全軸分まとめて取得する関数(縦ベクトル版)
+		//! @param[in]	n	列番号 (1始まり)
+		//! @param[in]	m	行番号 (1始まり)
+		//! @param[out]	v	全軸分の要素の縦ベクトル
+		constexpr void GetLanes(const size_t n, const size_t m, Matrix<1,K,TT>& v) const {
+			GetLanes(n, m, v.Data[0]);
+		}
+		
+		//! @brief 全軸の全要素を零にする関数
+		constexpr void FillAllZero(void){
+			Data = {};
+		}
+		
+		//! @brief 全軸の行列積を出力先に直接書き込む関数 Y = A*X (YはAともXとも異なること)
+		//! @tparam	L	Xの幅
+		//! @param[out]	Y	出力
+		//! @param[in]	A	左側の行列
+		//! @param[in]	X	右側の行列
+		template <size_t L>
+		friend void mul_into(MatrixBatch<K,L,MM,TT>& Y, const MatrixBatch& A, const MatrixBatch<K,L,NN,TT>& X){
+			arcs_assert(static_cast<const void*>(&Y) != &A && static_cast<const void*>(&Y) != &X);	// 出力先と入力が同じでないかチェック
+			for(size_t k = 0; k < KP; k += Lane::LANE){
+				for(size_t l = 0; l < L; ++l){
+					for(size_t j = 0; j < MM; ++j){
+						typename Lane::reg y = Lane::mul(Lane::load(&A.Data[0][j][k]), Lane::load(&X.Data[l][0][k]));
+						for(size_t i = 1; i < NN; ++i) y = Lane::fmadd(Lane::load(&A.Data[i][j][k]), Lane::load(&X.Data[l][i][k]), y);
+						Lane::store(&Y.Data[l][j][k], y);
+					}
+				}
+			}
+		}
+		
+		//! @brief 全軸の行列積を出力先に累積加算する関数 Y = Y + A*X (YはAともXとも異なること)
+		//! @tparam	L	Xの幅
+		//! @param[in,out]	Y	入出力
+		//! @param[in]	A	左側の行列
+		//! @param[in]	X	右側の行列
+		template <size_t L>
+		friend void muladd_into(MatrixBatch<K,L,MM,TT>& Y, const MatrixBatch& A, const MatrixBatch<K,L,NN,TT>& X){
+			arcs_assert(static_cast<const void*>(&Y) != &A && static_cast<const void*>(&Y) != &X);	// 出力先と入力が同じでないかチェック
+			for(size_t k = 0; k < KP; k += Lane::LANE){
+				for(size_t l = 0; l < L; ++l){
+					for(size_t j = 0; j < MM; ++j){
+						typename Lane::reg y = Lane::mul(Lane::load(&A.Data[0][j][k]), Lane::load(&X.Data[l][0][k]));
+						for(size_t i = 1; i < NN; ++i) y = Lane::fmadd(Lane::load(&A.Data[i][j][k]), Lane::load(&X.Data[l][i][k]), y);
+						Lane::store(&Y.Data[l][j][k], Lane::add(Lane::load(&Y.Data[l][j][k]), y));
+					}
+				}
+			}
+		}
+		
+		//! @brief 全軸の行列積演算子 A*X
+		//! @tparam	L	Xの幅
+		//! @param[in]	A	左側の行列
+		//! @param[in]	X	右側の行列
+		//! @return	結果
+		template <size_t L>
+		friend MatrixBatch<K,L,MM,TT> operator*(const MatrixBatch& A, const MatrixBatch<K,L,NN,TT>& X){
+			MatrixBatch<K,L,MM,TT> Y;
+			mul_into(Y, A, X);
+			return Y;
+		}
+		
+		//! @brief 全軸の加算演算子 A + B
+		//! @param[in]	A	左側
+		//! @param[in]	B	右側
+		//! @return	結果
+		friend MatrixBatch operator+(const MatrixBatch& A, const MatrixBatch& B){
+			MatrixBatch Y;
+			Map(Y, A, B, Lane::add);
+			return Y;
+		}
+		
+		//! @brief 全軸の減算演算子 A - B
+		//! @param[in]	A	左側
+		//! @param[in]	B	右側
+		//! @return	結果
+		friend MatrixBatch operator-(const MatrixBatch& A, const MatrixBatch& B){
+			MatrixBatch Y;
+			Map(Y, A, B, Lane::sub);
+			return Y;
+		}
+		
+		//! @brief 全軸の加算代入演算子 A += B
+		//! @param[in]	B	右側
+		//! @return	結果
+		MatrixBatch& operator+=(const MatrixBatch& B){
+			Map(*this, *this, B, Lane::add);
+			return *this;
+		}
+		
+		//! @brief 全軸の減算代入演算子 A -= B
+		//! @param[in]	B	右側
+		//! @return	結果
+		MatrixBatch& operator-=(const MatrixBatch& B){
+			Map(*this, *this, B, Lane::sub);
+			return *this;
+		}
+		
+		std::array<std::array<std::array<TT, KP>, MM>, NN> Data;	//!< データ格納用変数 配列の添字は[列][行][軸]
+	
+	private:
+		//! @brief 全軸の要素ごとの2項演算 Y = op(A, B) (YはAかBと同じでもよい)
+		//! @param[out]	Y	出力
+		//! @param[in]	A	入力
+		//! @param[in]	B	入力
+		//! @param[in]	op	レーン同士の演算
+		template <typename F>
+		static void Map(MatrixBatch& Y, const MatrixBatch& A, const MatrixBatch& B, F op){
+			for(size_t i = 0; i < NN; ++i){
+				for(size_t j = 0; j < MM; ++j){
+					for(size_t k = 0; k < KP; k += Lane::LANE){
+						Lane::store(&Y.Data[i][j][k], op(Lane::load(&A.Data[i][j][k]), Lane::load(&B.Data[i][j][k])));
+					}
+				}
+			}
+		}
+};
+
+//! @brief 全軸の離散系状態方程式を1サンプル進める関数 (C行列が単位行列の場合)
+//! x[k+1] = A*x[k] + B*u[k] を計算して状態ベクトルを上書きする。出力が必要なときは呼ぶ前の x を読むこと。
+//! @tparam	K	軸数
+//! @tparam	N	状態ベクトルの長さ
+//! @tparam	I	入力ベクトルの長さ
+//! @tparam	TT	データ型
+//! @param[in,out]	x	状態ベクトル
+//! @param[in]	A	離散系A行列
+//! @param[in]	B	離散系B行列
+//! @param[in]	u	入力ベクトル
+template <size_t K, size_t N, size_t I, typename TT>
+void statespace_step(MatrixBatch<K,1,N,TT>& x, const MatrixBatch<K,N,N,TT>& A, const MatrixBatch<K,I,N,TT>& B, const MatrixBatch<K,1,I,TT>& u){
+	using Lane = BatchLane<TT>;
+	for(size_t k = 0; k < MatrixBatch<K,1,N,TT>::KP; k += Lane::LANE){
+		// 状態と入力をレジスタに読み込んでおいてから全部の行を計算する
+		typename Lane::reg xr[N];
+		typename Lane::reg ur[I];
+		for(size_t i = 0; i < N; ++i) xr[i] = Lane::load(&x.Data[0][i][k]);
+		for(size_t i = 0; i < I; ++i) ur[i] = Lane::load(&u.Data[0][i][k]);
+		for(size_t j = 0; j < N; ++j){
+			typename Lane::reg ax = Lane::mul(Lane::load(&A.Data[0][j][k]), xr[0]);
+			for(size_t i = 1; i < N; ++i) ax = Lane::fmadd(Lane::load(&A.Data[i][j][k]), xr[i], ax);
+			typename Lane::reg bu = Lane::mul(Lane::load(&B.Data[0][j][k]), ur[0]);
+			for(size_t i = 1; i < I; ++i) bu = Lane::fmadd(Lane::load(&B.Data[i][j][k]), ur[i], bu);
+			Lane::store(&x.Data[0][j][k], Lane::add(ax, bu));
+		}
+	}
+}
+
+//! @brief 全軸の離散系状態方程式を1サンプル進めて出力を計算する関数
+//! y[k] = C*x[k] と x[k+1] = A*x[k] + B*u[k] を計算する。(StateSpaceSystem::GetResponses と同じ順番)
+//! @tparam	K	軸数
+//! @tparam	N	状態ベクトルの長さ
+//! @tparam	I	入力ベクトルの長さ
+//! @tparam	O	出力ベクトルの長さ
+//! @tparam	TT	データ型
+//! @param[in,out]	x	状態ベクトル
+//! @param[out]	y	出力ベクトル
+//! @param[in]	A	離散系A行列
+//! @param[in]	B	離散系B行列
+//! @param[in]	C	C行列
+//! @param[in]	u	入力ベクトル
+template <size_t K, size_t N, size_t I, size_t O, typename TT>
+void statespace_step(
+	MatrixBatch<K,1,N,TT>& x, MatrixBatch<K,1,O,TT>& y,
+	const MatrixBatch<K,N,N,TT>& A, const MatrixBatch<K,I,N,TT>& B, const MatrixBatch<K,N,O,TT>& C, const MatrixBatch<K,1,I,TT>& u
+){
+	using Lane = BatchLane<TT>;
+	for(size_t k = 0; k < MatrixBatch<K,1,N,TT>::KP; k += Lane::LANE){
+		typename Lane::reg xr[N];
+		for(size_t i = 0; i < N; ++i) xr[i] = Lane::load(&x.Data[0][i][k]);
+		for(size_t j = 0; j < O; ++j){
+			typename Lane::reg cx = Lane::mul(Lane::load(&C.Data[0][j][k]), xr[0]);
+			for(size_t i = 1; i < N; ++i) cx = Lane::fmadd(Lane::load(&C.Data[i][j][k]), xr[i], cx);
+			Lane::store(&y.Data[0][j][k], cx);
+		}
+	}
+	statespace_step(x, A, B, u);
+}
+}
+
+#endif
+
@@ -0,0 +1,651 @@
+//! @file MatrixDecomposition.hh
+//! @brief 行列分解クラス(テンプレート版)
+//!
+//! 係数行列を1回だけ分解しておき，右辺を変えながら何度でも連立方程式を解くための，
+//! コレスキー分解(LL^T)，修正コレスキー分解(LDL^T)，部分ピボット選択付きLU分解，ハウスホルダーQR分解のクラス。
+//! QR分解のクラスは正規方程式を作らずに最小二乗解(縦長行列)と最小ノルム解(横長行列)を計算する。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・分解は O(n^3) だが，分解後の solve は前進/後退代入だけなので O(n^2)。inv(A)*b のように逆行列を作るよりも速くて精度も良い。
+// ・solve の右辺は縦ベクトル Matrix<1,N> でも，複数の右辺を並べた行列 Matrix<K,N> でも良い。
+// ・右辺には式や subview などのビュー(MatrixView.hh)も渡せる。その場合は一度だけ行列へ評価してから解く。
+// ・分解できなかった場合(正定値でない，特異，ランク落ち)は arcs_assert で止めずに状態を記憶するので，
+//   IsPositiveDefinite，IsSingular，IsRankDeficient で確認すること。そのまま solve すると解は inf や nan になる。
+// ・すべての関数は定数式として評価できる。
+// ・データ型には二重数(DualNumber.hh)も使える。abs や sqrt は std:: を付けずに呼んでいるので，その型用の関数が呼ばれる。
+// ・LU分解は複素数(std::complex)も使える。ピボットの大きさは abs の戻り値の実数で比べる。
+
+#ifndef MATRIXDECOMPOSITION
+#define MATRIXDECOMPOSITION
+
+#include <cmath>
+#include <cassert>
+#include <array>
+#include <limits>
+#include <algorithm>
+#include <utility>
+#include "Matrix.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief コレスキー分解(LL^T)クラス
+//! 対称正定値行列 A = L*L^T と分解する。Aは下三角部分だけを使う。
+//! @tparam	N	行列のサイズ
+//! @tparam	TT	データ型(デフォルトはdouble型)
+template <size_t N, typename TT = double>
+class CholeskyDecomposition {
+	public:
+		//! @brief コンストラクタ(分解前)
+		constexpr CholeskyDecomposition()
+			: L(), PosDef(false)
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(分解する)
+		//! @param[in]	A	対称正定値行列
+		constexpr explicit CholeskyDecomposition(const Matrix<N,N,TT>& A)
+			: L(), PosDef(false)
+		{
+			Factorize(A);
+		}
+		
+		//! @brief 分解する関数
+		//! @param[in]	A	対称正定値行列
+		constexpr void Factorize(const Matrix<N,N,TT>& A){
+			using std::sqrt;
+			L = Matrix<N,N,TT>::zeros();
+			PosDef = true;
+			for(size_t j = 0; j < N; ++j){
+				// j列目の対角要素
+				TT d = A.Data[j][j];
+				for(size_t k = 0; k < j; ++k) d -= L.Data[k][j]*L.Data[k][j];
+				if(d <= 0){
+					PosDef = false;	// 正定値ではないので打ち切り
+					return;
+				}
+				const TT ljj = sqrt(d);
+				L.Data[j][j] = ljj;
+				
+				// j列目の対角より下の要素 (列ごとに連続した順で計算)
+				for(size_t i = j + 1; i < N; ++i) L.Data[j][i] = A.Data[j][i];
+				for(size_t k = 0; k < j; ++k){
+					const TT ljk = L.Data[k][j];
+					for(size_t i = j + 1; i < N; ++i) L.Data[j][i] -= L.Data[k][i]*ljk;
+				}
+				for(size_t i = j + 1; i < N; ++i) L.Data[j][i] /= ljj;
+			}
+		}
+		
+		//! @brief A*X = B を X について解く関数(引数で返す版)
+		//! @tparam	K	右辺の数
+		//! @param[in]	B	右辺
+		//! @param[out]	X	解
+		template <size_t K>
+		constexpr void solve(const Matrix<K,N,TT>& B, Matrix<K,N,TT>& X) const {
+			X = B;
+			for(size_t c = 0; c < K; ++c){
+				// L*y = b を前進代入で解く
+				for(size_t j = 0; j < N; ++j){
+					X.Data[c][j] /= L.Data[j][j];
+					for(size_t i = j + 1; i < N; ++i) X.Data[c][i] -= L.Data[j][i]*X.Data[c][j];
+				}
+				// L^T*x = y を後退代入で解く
+				for(size_t j = N; 0 < j; --j){
+					TT s = X.Data[c][j-1];
+					for(size_t i = j; i < N; ++i) s -= L.Data[j-1][i]*X.Data[c][i];
+					X.Data[c][j-1] = s/L.Data[j-1][j-1];
+				}
+			}
+		}
+		
+		//! @brief A*X = B を X について解く関数(戻り値として返す版)
+		//! @tparam	K	右辺の数
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <size_t K>
+		constexpr Matrix<K,N,TT> solve(const Matrix<K,N,TT>& B) const {
+			Matrix<K,N,TT> X;
+			solve(B, X);
+			return X;
+		}
+		
+		//! @brief A*X = B を X について解く関数(右辺が式やビューの場合，引数で返す版)
+		//! @param[in]	B	右辺
+		//! @param[out]	X	解
+		template <class EE, size_t K>
+		constexpr void solve(const MatrixExpr<EE,Matrix<K,N,TT>>& B, Matrix<K,N,TT>& X) const {
+			solve(Matrix<K,N,TT>(B), X);
+		}
+		
+		//! @brief A*X = B を X について解く関数(右辺が式やビューの場合，戻り値として返す版)
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <class EE, size_t K>
+		constexpr Matrix<K,N,TT> solve(const MatrixExpr<EE,Matrix<K,N,TT>>& B) const {
+			return solve(Matrix<K,N,TT>(B));
+		}
+		
+		//! @brief 下三角行列Lを返す関数
+		//! @return	下三角行列
+		constexpr Matrix<N,N,TT> GetL(void) const {
+			return L;
+		}
+		
+		//! @brief 行列式を返す関数
+		//! @return	行列式
+		constexpr TT det(void) const {
+			TT ret = 1;
+			for(size_t j = 0; j < N; ++j) ret *= L.Data[j][j]*L.Data[j][j];
+			return ret;
+		}
+		
+		//! @brief 正定値で分解できたかを返す関数
+		//! @return	true = 正定値，false = 正定値ではない(分解失敗)
+		constexpr bool IsPositiveDefinite(void) const {
+			return PosDef;
+		}
+	
+	private:
+		Matrix<N,N,TT> L;	//!< 下三角行列
+		bool PosDef;		//!< 正定値フラグ
+};
+
+//! @brief 修正コレスキー分解(LDL^T)クラス
+//! 対称行列 A = L*D*L^T (Lは対角が1の下三角行列，Dは対角行列) と分解する。平方根を使わず，正定値でなくても良い。
+//! Aは下三角部分だけを使う。ピボット選択はしないので，分解の途中で対角要素が零になる行列は分解できない。
+//! @tparam	N	行列のサイズ
+//! @tparam	TT	データ型(デフォルトはdouble型)
+template <size_t N, typename TT = double>
+class LDLDecomposition {
+	public:
+		//! @brief コンストラクタ(分解前)
+		constexpr LDLDecomposition()
+			: L(), D(), Singular(true)
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(分解する)
+		//! @param[in]	A	対称行列
+		constexpr explicit LDLDecomposition(const Matrix<N,N,TT>& A)
+			: L(), D(), Singular(true)
+		{
+			Factorize(A);
+		}
+		
+		//! @brief 分解する関数
+		//! @param[in]	A	対称行列
+		constexpr void Factorize(const Matrix<N,N,TT>& A){
+			L = Matrix<N,N,TT>::eye();
+			D = Matrix<1,N,TT>::zeros();
+			Singular = false;
+			std::array<TT, N> w = {};	// L(j,k)*D(k) の作業用
+			for(size_t j = 0; j < N; ++j){
+				// j列目の対角要素
+				TT d = A.Data[j][j];
+				for(size_t k = 0; k < j; ++k){
+					w[k] = L.Data[k][j]*D.Data[0][k];
+					d -= L.Data[k][j]*w[k];
+				}
+				D.Data[0][j] = d;
+				if(d == 0){
+					Singular = true;	// 分解できないので打ち切り
+					return;
+				}
+				
+				// j列目の対角より下の要素
+				for(size_t i = j + 1; i < N; ++i) L.Data[j][i] = A.Data[j][i];
+				for(size_t k = 0; k < j; ++k){
+					for(size_t i = j + 1; i < N; ++i) L.Data[j][i] -= L.Data[k][i]*w[k];
+				}
+				for(size_t i = j + 1; i < N; ++i) L.Data[j][i] /= d;
+			}
+		}
+		
+		//! @brief A*X = B を X について解く関数(引数で返す版)
+		//! @tparam	K	右辺の数
+		//! @param[in]	B	右辺
+		//! @param[out]	X	解
+		template <size_t K>
+		constexpr void solve(const Matrix<K,N,TT>& B, Matrix<K,N,TT>& X) const {
+			X = B;
+			for(size_t c = 0; c < K; ++c){
+				// L*y = b を前進代入で解く
+				for(size_t j = 0; j < N; ++j){
+					for(size_t i = j + 1; i < N; ++i) X.Data[c][i] -= L.Data[j][i]*X.Data[c][j];
+				}
+				// D*z = y
+				for(size_t j = 0; j < N; ++j) X.Data[c][j] /= D.Data[0][j];
+				// L^T*x = z を後退代入で解く
+				for(size_t j = N; 0 < j; --j){
+					TT s = X.Data[c][j-1];
+					for(size_t i = j; i < N; ++i) s -= L.Data[j-1][i]*X.Data[c][i];
+					X.Data[c][j-1] = s;
+				}
+			}
+		}
+		
+		//! @brief A*X = B を X について解く関数(戻り値として返す版)
+		//! @tparam	K	右辺の数
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <size_t K>
+		constexpr Matrix<K,N,TT> solve(const Matrix<K,N,TT>& B) const {
+			Matrix<K,N,TT> X;
+			solve(B, X);
+			return X;
+		}
+		
+		//! @brief A*X = B を X について解く関数(右辺が式やビューの場合，引数で返す版)
+		//! @param[in]	B	右辺
+		//! @param[out]	X	解
+		template <class EE, size_t K>
+		constexpr void solve(const MatrixExpr<EE,Matrix<K,N,TT>>& B, Matrix<K,N,TT>& X) const {
+			solve(Matrix<K,N,TT>(B), X);
+		}
+		
+		//! @brief A*X = B を X について解く関数(右辺が式やビューの場合，戻り値として返す版)
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <class EE, size_t K>
+		constexpr Matrix<K,N,TT> solve(const MatrixExpr<EE,Matrix<K,N,TT>>& B) const {
+			return solve(Matrix<K,N,TT>(B));
+		}
+		
+		//! @brief 対角が1の下三角行列Lを返す関数
+		//! @return	下三角行列
+		constexpr Matrix<N,N,TT> GetL(void) const {
+			return L;
+		}
+		
+		//! @brief 対角行列Dの対角要素を返す関数
+		//! @return	対角要素の縦ベクトル
+		constexpr Matrix<1,N,TT> GetD(void) const {
+			return D;
+		}
+		
+		//! @brief 行列式を返す関数
+		//! @return	行列式
+		constexpr TT det(void) const {
+			TT ret = 1;
+			for(size_t j = 0; j < N; ++j) ret *= D.Data[0][j];
+			return ret;
+		}
+		
+		//! @brief 分解できなかったかを返す関数
+		//! @return	true = 対角要素が零になって分解失敗，false = 分解成功
+		constexpr bool IsSingular(void) const {
+			return Singular;
+		}
+	
+	private:
+		Matrix<N,N,TT> L;	//!< 対角が1の下三角行列
+		Matrix<1,N,TT> D;	//!< 対角行列の対角要素
+		bool Singular;		//!< 特異フラグ
+};
+
+//! @brief 部分ピボット選択付きLU分解クラス
+//! P*A = L*U (Pは行の並べ替え，Lは対角が1の下三角行列，Uは上三角行列) と分解する。
+//! @tparam	N	行列のサイズ
+//! @tparam	TT	データ型(デフォルトはdouble型)
+template <size_t N, typename TT = double>
+class LUDecomposition {
+	public:
+		//! @brief コンストラクタ(分解前)
+		constexpr LUDecomposition()
+			: LU(), Perm(), Sign(1), Singular(true)
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(分解する)
+		//! @param[in]	A	正方行列
+		constexpr explicit LUDecomposition(const Matrix<N,N,TT>& A)
+			: LU(), Perm(), Sign(1), Singular(true)
+		{
+			Factorize(A);
+		}
+		
+		//! @brief 分解する関数
+		//! @param[in]	A	正方行列
+		constexpr void Factorize(const Matrix<N,N,TT>& A){
+			using std::abs;
+			using RT = decltype(abs(std::declval<TT>()));	// 絶対値の型 (複素数のときは実数)
+			LU = A;
+			Sign = 1;
+			Singular = false;
+			RT Amax = 0;
+			for(size_t j = 0; j < N; ++j){
+				for(size_t i = 0; i < N; ++i) Amax = std::max(Amax, (RT)abs(A.Data[j][i]));
+			}
+			const RT tol = std::numeric_limits<RT>::epsilon()*(RT)N*Amax;	// 零とみなすピボット
+			
+			for(size_t k = 0; k < N; ++k){
+				// k列目の絶対値最大の要素を探して行を入れ替える
+				size_t p = k;
+				for(size_t i = k + 1; i < N; ++i){
+					if(abs(LU.Data[k][p]) < abs(LU.Data[k][i])) p = i;
+				}
+				Perm[k] = p;
+				if(p != k){
+					for(size_t j = 0; j < N; ++j){
+						const TT w = LU.Data[j][k];
+						LU.Data[j][k] = LU.Data[j][p];
+						LU.Data[j][p] = w;
+					}
+					Sign = -Sign;
+				}
+				if(abs(LU.Data[k][k]) <= tol){
+					Singular = true;	// 特異なので，この列の消去はスキップ
+					continue;
+				}
+				
+				// k列目より右の列を更新 (列ごとに連続した順で計算)
+				for(size_t i = k + 1; i < N; ++i) LU.Data[k][i] /= LU.Data[k][k];
+				for(size_t j = k + 1; j < N; ++j){
+					const TT ukj = LU.Data[j][k];
+					for(size_t i = k + 1; i < N; ++i) LU.Data[j][i] -= LU.Data[k][i]*ukj;
+				}
+			}
+		}
+		
+		//! @brief A*X = B を X について解く関数(引数で返す版)
+		//! @tparam	K	右辺の数
+		//! @param[in]	B	右辺
+		//! @param[out]	X	解
+		template <size_t K>
+		constexpr void solve(const Matrix<K,N,TT>& B, Matrix<K,N,TT>& X) const {
+			X = B;
+			for(size_t c = 0; c < K; ++c){
+				// 行の並べ替えと L*y = P*b の前進代入
+				for(size_t k = 0; k < N; ++k){
+					const TT w = X.Data[c][k];
+					X.Data[c][k] = X.Data[c][Perm[k]];
+					X.Data[c][Perm[k]] = w;
+				}
+				for(size_t j = 0; j < N; ++j){
+					for(size_t i = j + 1; i < N; ++i) X.Data[c][i] -= LU.Data[j][i]*X.Data[c][j];
+				}
+				// U*x = y を後退代入で解く
+				for(size_t j = N; 0 < j; --j){
+					X.Data[c][j-1] /= LU.Data[j-1][j-1];
+					for(size_t i = 0; i < j - 1; ++i) X.Data[c][i] -= LU.Data[j-1][i]*X.Data[c][j-1];
+				}
+			}
+		}
+		
+		//! @brief A*X = B を X について解く関数(戻り値として返す版)
+		//! @tparam	K	右辺の数
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <size_t K>
+		constexpr Matrix<K,N,TT> solve(const Matrix<K,N,TT>& B) const {
+			Matrix<K,N,TT> X;
+			solve(B, X);
+			return X;
+		}
+		
+		//! @brief A*X = B を X について解く関数(右辺が式やビューの場合，引数で返す版)
+		//! @param[in]	B	右辺
+		//! @param[out]	X	解
+		template <class EE, size_t K>
+		constexpr void solve(const MatrixExpr<EE,Matrix<K,N,TT>>& B, Matrix<K,N,TT>& X) const {
+			solve(Matrix<K,N,TT>(B), X);
+		}
+		
+		//! @brief A*X = B を X について解く関数(右辺が式やビューの場合，戻り値として返す版)
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <class EE, size_t K>
+		constexpr Matrix<K,N,TT> solve(const MatrixExpr<EE,Matrix<K,N,TT>>& B) const {
+			return solve(Matrix<K,N,TT>(B));
+		}
+		
+		//! @brief 対角が1の下三角行列Lを返す関数
+		//! @return	下三角行列
+		constexpr Matrix<N,N,TT> GetL(void) const {
+			Matrix<N,N,TT> L = Matrix<N,N,TT>::eye();
+			for(size_t j = 0; j < N; ++j){
+				for(size_t i = j + 1; i < N; ++i) L.Data[j][i] = LU.Data[j][i];
+			}
+			return L;
+		}
+		
+		//! @brief 上三角行列Uを返す関数
+		//! @return	上三角行列
+		constexpr Matrix<N,N,TT> GetU(void) const {
+			Matrix<N,N,TT> U;
+			for(size_t j = 0; j < N; ++j){
+				for(size_t i = 0; i <= j; ++i) U.Data[j][i] = LU.Data[j][i];
+			}
+			return U;
+		}
+		
+		//! @brief 行列式を返す関数
+		//! @return	行列式
+		constexpr TT det(void) const {
+			TT ret = (TT)Sign;
+			for(size_t j = 0; j < N; ++j) ret *= LU.Data[j][j];
+			return ret;
+		}
+		
+		//! @brief 特異かを返す関数
+		//! @return	true = 特異，false = 正則
+		constexpr bool IsSingular(void) const {
+			return Singular;
+		}
+	
+	private:
+		Matrix<N,N,TT> LU;			//!< LとUをまとめて格納した行列 (Lの対角の1は省略)
+		std::array<size_t, N> Perm;	//!< k行目と入れ替えた行の番号
+		int Sign;					//!< 行の並べ替えの符号 (偶数回で1，奇数回で-1)
+		bool Singular;				//!< 特異フラグ
+};
+
+//! @brief ハウスホルダーQR分解クラス
+//! 縦長か正方の行列(M ≧ N)は A = Q*R と分解して最小二乗解を，横長の行列(M < N)は A^T = Q*R と分解して最小ノルム解を計算する。
+//! Qは陽に作らずに，ハウスホルダーベクトルとして R の下に格納する。
+//! @tparam	N	行列の幅(列の数, 横)
+//! @tparam	M	行列の高さ(行の数, 縦)
+//! @tparam	TT	データ型(デフォルトはdouble型)
+template <size_t N, size_t M, typename TT = double>
+class QRDecomposition {
+	public:
+		static constexpr size_t K = std::min(N,M);	//!< 分解する行列の列数 (ハウスホルダー変換の数)
+		static constexpr size_t P = std::max(N,M);	//!< 分解する行列の行数
+		
+		//! @brief コンストラクタ(分解前)
+		constexpr QRDecomposition()
+			: QR(), Tau(), RankDeficient(true)
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(分解する)
+		//! @param[in]	A	入力行列
+		constexpr explicit QRDecomposition(const Matrix<N,M,TT>& A)
+			: QR(), Tau(), RankDeficient(true)
+		{
+			Factorize(A);
+		}
+		
+		//! @brief 分解する関数
+		//! @param[in]	A	入力行列
+		constexpr void Factorize(const Matrix<N,M,TT>& A){
+			using std::abs;
+			using std::sqrt;
+			if constexpr(N <= M){
+				QR = A;
+			}else{
+				QR = tp(A);		// 横長のときは転置行列を分解する
+			}
+			
+			TT Rmax = 0;
+			for(size_t k = 0; k < K; ++k){
+				// k列目の対角より下をゼロにするハウスホルダー変換 H = I - tau*v*v^T (v[k] = 1)
+				const TT alpha = QR.Data[k][k];
+				TT xnorm2 = 0;
+				for(size_t i = k + 1; i < P; ++i) xnorm2 += QR.Data[k][i]*QR.Data[k][i];
+				if(xnorm2 == 0){
+					Tau[k] = 0;		// 既にゼロのときは変換しない
+				}else{
+					const TT beta = (alpha < 0 ? 1 : -1)*sqrt(alpha*alpha + xnorm2);
+					Tau[k] = (beta - alpha)/beta;
+					const TT s = 1/(alpha - beta);
+					for(size_t i = k + 1; i < P; ++i) QR.Data[k][i] *= s;
+					QR.Data[k][k] = beta;
+					
+					// k列目より右の列に掛ける
+					for(size_t j = k + 1; j < K; ++j){
+						TT w = QR.Data[j][k];
+						for(size_t i = k + 1; i < P; ++i) w += QR.Data[k][i]*QR.Data[j][i];
+						w *= Tau[k];
+						QR.Data[j][k] -= w;
+						for(size_t i = k + 1; i < P; ++i) QR.Data[j][i] -= w*QR.Data[k][i];
+					}
+				}
+				Rmax = std::max(Rmax, abs(QR.Data[k][k]));
+			}
+			
+			// Rの対角要素が相対的に零に近ければランク落ち
+			const TT tol = std::numeric_limits<TT>::epsilon()*(TT)P*Rmax;
+			RankDeficient = (Rmax == 0);
+			for(size_t k = 0; k < K; ++k){
+				if(abs(QR.Data[k][k]) <= tol) RankDeficient = true;
+			}
+		}
+		
+		//! @brief A*X = B の最小二乗解(縦長)か最小ノルム解(横長)を計算する関数(引数で返す版)
+		//! @tparam	KB	右辺の数
+		//! @param[in]	B	右辺
+		//! @param[out]	X	解
+		template <size_t KB>
+		constexpr void solve(const Matrix<KB,M,TT>& B, Matrix<KB,N,TT>& X) const {
+			std::array<TT, P> y = {};
+			for(size_t c = 0; c < KB; ++c){
+				if constexpr(N <= M){
+					// 最小二乗解 x = R^(-1)*(Q^T*b の上のN個)
+					for(size_t i = 0; i < M; ++i) y[i] = B.Data[c][i];
+					for(size_t k = 0; k < K; ++k) ApplyReflector(k, y);
+					for(size_t j = N; 0 < j; --j){
+						y[j-1] /= QR.Data[j-1][j-1];
+						for(size_t i = 0; i < j - 1; ++i) y[i] -= QR.Data[j-1][i]*y[j-1];
+					}
+					for(size_t i = 0; i < N; ++i) X.Data[c][i] = y[i];
+				}else{
+					// 最小ノルム解 x = Q*[R^(-T)*b; 0]
+					for(size_t i = 0; i < M; ++i) y[i] = B.Data[c][i];
+					for(size_t i = M; i < N; ++i) y[i] = 0;
+					for(size_t j = 0; j < M; ++j){
+						for(size_t i = 0; i < j; ++i) y[j] -= QR.Data[j][i]*y[i];
+						y[j] /= QR.Data[j][j];
+					}
+					for(size_t k = K; 0 < k; --k) ApplyReflector(k - 1, y);
+					for(size_t i = 0; i < N; ++i) X.Data[c][i] = y[i];
+				}
+			}
+		}
+		
+		//! @brief A*X = B の最小二乗解(縦長)か最小ノルム解(横長)を計算する関数(戻り値として返す版)
+		//! @tparam	KB	右辺の数
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <size_t KB>
+		constexpr Matrix<KB,N,TT> solve(const Matrix<KB,M,TT>& B) const {
+			Matrix<KB,N,TT> X;
+			solve(B, X);
+			return X;
+		}
+		
+		//! @brief A*X = B の最小二乗解(縦長)か最小ノルム解(横長)を計算する関数(右辺が式やビューの場合，引数で返す版)
+		//! @param[in]	B	右辺
+		//! @param[out]	X	解
+		template <class EE, size_t KB>
+		constexpr void solve(const MatrixExpr<EE,Matrix<KB,M,TT>>& B, Matrix<KB,N,TT>& X) const {
+			solve(Matrix<KB,M,TT>(B), X);
+		}
+		
+		//! @brief A*X = B の最小二乗解(縦長)か最小ノルム解(横長)を計算する関数(右辺が式やビューの場合，戻り値として返す版)
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <class EE, size_t KB>
+		constexpr Matrix<KB,N,TT> solve(const MatrixExpr<EE,Matrix<KB,M,TT>>& B) const {
+			return solve(Matrix<KB,M,TT>(B));
+		}
+		
+		//! @brief 上三角行列Rを返す関数 (横長のときは A^T = Q*R のR)
+		//! @return	上三角行列 (K×K)
+		constexpr Matrix<K,K,TT> GetR(void) const {
+			Matrix<K,K,TT> R;
+			for(size_t j = 0; j < K; ++j){
+				for(size_t i = 0; i <= j; ++i) R.Data[j][i] = QR.Data[j][i];
+			}
+			return R;
+		}
+		
+		//! @brief ランク落ちしているかを返す関数
+		//! @return	true = ランク落ち，false = フルランク
+		constexpr bool IsRankDeficient(void) const {
+			return RankDeficient;
+		}
+	
+	private:
+		Matrix<K,P,TT> QR;			//!< 上三角部分にR，その下にハウスホルダーベクトルを格納した行列
+		std::array<TT, K> Tau;		//!< ハウスホルダー変換の係数
+		bool RankDeficient;			//!< ランク落ちフラグ
+		
+		//! @brief k番目のハウスホルダー変換をベクトルに掛ける関数
+		//! @param[in]	k	変換の番号
+		//! @param[in,out]	y	ベクトル
+		constexpr void ApplyReflector(const size_t k, std::array<TT, P>& y) const {
+			TT w = y[k];
+			for(size_t i = k + 1; i < P; ++i) w += QR.Data[k][i]*y[i];
+			w *= Tau[k];
+			y[k] -= w;
+			for(size_t i = k + 1; i < P; ++i) y[i] -= w*QR.Data[k][i];
+		}
+};
+
+//! @brief A*X = B の最小二乗解(縦長)か最小ノルム解(横長)を返す関数 (正規方程式を作らずにQR分解で解く)
+//! @tparam	N	係数行列の幅
+//! @tparam	M	係数行列の高さ
+//! @tparam	KB	右辺の数
+//! @tparam	TT	データ型
+//! @param[in]	A	係数行列
+//! @param[in]	B	右辺
+//! @return	解
+template <size_t N, size_t M, size_t KB, typename TT>
+constexpr Matrix<KB,N,TT> solve_lsq(const Matrix<N,M,TT>& A, const Matrix<KB,M,TT>& B){
+	const QRDecomposition<N,M,TT> QR(A);
+	return QR.solve(B);
+}
+
+//! @brief A*X = B の最小二乗解(縦長)か最小ノルム解(横長)を返す関数 (右辺が式やビューの場合)
+//! @param[in]	A	係数行列
+//! @param[in]	B	右辺
+//! @return	解
+template <size_t N, size_t M, class EE, size_t KB, typename TT>
+constexpr Matrix<KB,N,TT> solve_lsq(const Matrix<N,M,TT>& A, const MatrixExpr<EE,Matrix<KB,M,TT>>& B){
+	return solve_lsq(A, Matrix<KB,M,TT>(B));
+}
+}
+
+#endif
+
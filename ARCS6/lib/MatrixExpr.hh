@@ -0,0 +1,589 @@
+//! @file MatrixExpr.hh
+//! @brief 行列/ベクトル計算クラス用の式テンプレート(遅延評価)
+//!
+//! 「lazy(Ad)*x + lazy(Bd)*u」のように lazy() で明示した行列積と加減算の連鎖を式の木として保持しておき，
+//! Matrixへの代入時に中間の行列を作らずに出力先へ直接計算する。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・同じデータ型の行列同士の積 A*B は，これまで通りその場で計算された行列(Matrix)を返す。
+//   (ただし零埋めされた中間の行列を作らずに，戻り値の行列へ直接計算される)
+// ・lazy(A) で行列を包むと遅延評価が有効になり，lazy(A)*B は式(MatrixExprProd)を返す。
+//   遅延評価の式を含む加減算，スカラー倍，符号反転も式(MatrixExprSum, MatrixExprScale)を返す。
+//   遅延評価の式を含まない演算は，ビューを含む場合も含めてその場で行列に評価される。
+// ・式はMatrixへの代入/初期化/加算代入/減算代入のときに，出力先の行列へ直接書き込まれる。
+//   例えば y = lazy(Ad)*x + lazy(Bd)*u は，y = Ad*x を計算してから y += Bd*u を累積加算するだけになり，
+//   零埋めされた中間の行列もコピーも発生しない。
+// ・累積加算する行列積は零から計算して最後に加算するので，各項の行列積は互いに依存せずに並列実行でき，
+//   丸めも従来の演算子と同じになる。ただし式のスカラー倍は行列積の係数に畳み込まれるので丸めが異なる場合がある。
+// ・代入先の行列が式の中に現れる場合(x = A*x など)は，自動的に一時行列を経由して計算する。
+// ・積の中に式が現れる場合(A*B*C など)は，内側の積を先に行列へ評価してから掛ける。
+// ・定数式評価(constexpr)でも使用可能。
+// ・lazy() を使った式を auto で受けると式のままになり，参照している行列の変更が反映されるので注意。
+//   式はその場で Matrix型の変数へ代入するか，eval() で明示的に評価すること。
+
+#ifndef MATRIXEXPR
+#define MATRIXEXPR
+
+#include <cstddef>
+#include <array>
+#include <type_traits>
+#include <utility>
+#include "MatrixSIMD.hh"
+#include "MatrixUnroll.hh"
+
+namespace ARCS {	// ARCS名前空間
+template <size_t NN, size_t MM, typename TT> class Matrix;	// 前方宣言
+template <class RR, class PP> class MatrixView;				// 前方宣言
+template <class RR> class MatrixExprRef;					// 前方宣言
+
+//! @brief 式テンプレートであることを示すタグ
+struct MatrixExprTag {};
+
+//! @brief 行列の式テンプレートの基底クラス
+//! @tparam	EE	派生クラス(式の型)
+//! @tparam	RR	評価結果の行列の型
+template <class EE, class RR>
+class MatrixExpr : public MatrixExprTag {
+	public:
+		using ResultType = RR;					//!< 評価結果の行列の型
+		static constexpr size_t N = RR::N;		//!< 評価結果の行列の幅(列の数, 横)
+		static constexpr size_t M = RR::M;		//!< 評価結果の行列の高さ(行の数, 縦)
+		
+		//! @brief 派生クラス(式の実体)を返す関数
+		//! @return 式の実体
+		constexpr const EE& Derived(void) const{
+			return static_cast<const EE&>(*this);
+		}
+		
+		//! @brief 式を評価して行列を返す関数
+		//! @return 評価結果
+		constexpr RR eval(void) const{
+			return RR(*this);
+		}
+		
+		//! @brief 式を評価して縦ベクトルの要素を返す関数
+		//! @param[in]	m	縦方向の要素番号(1始まり)
+		//! @return 要素の値
+		constexpr typename RR::value_type operator[](size_t m) const{
+			return RR(*this)[m];
+		}
+};
+
+//! @brief 式テンプレート用の型判定と評価の補助関数群
+class MatrixExprOp {
+	public:
+		//! @brief Matrix型かどうかの判定
+		template <class T> struct IsMatrixType : std::false_type {};
+		template <size_t NN, size_t MM, typename TT> struct IsMatrixType<Matrix<NN,MM,TT>> : std::true_type {};
+		
+		//! @brief Matrix型かどうかを返す関数
+		template <class T>
+		static constexpr bool IsMatrix(void){
+			return IsMatrixType<std::remove_cv_t<std::remove_reference_t<T>>>::value;
+		}
+		
+		//! @brief 式テンプレートかどうかを返す関数
+		template <class T>
+		static constexpr bool IsExpr(void){
+			return std::is_base_of_v<MatrixExprTag, std::remove_cv_t<std::remove_reference_t<T>>>;
+		}
+		
+		//! @brief 行列の参照の式(lazy() の戻り値)かどうかの判定
+		template <class T> struct IsRefType : std::false_type {};
+		template <class RR> struct IsRefType<MatrixExprRef<RR>> : std::true_type {};
+		
+		//! @brief 行列の参照の式かどうかを返す関数
+		template <class T>
+		static constexpr bool IsRef(void){
+			return IsRefType<std::remove_cv_t<std::remove_reference_t<T>>>::value;
+		}
+		
+		//! @brief ビューかどうかの判定
+		template <class T> struct IsViewType : std::false_type {};
+		template <class RR, class PP> struct IsViewType<MatrixView<RR,PP>> : std::true_type {};
+		
+		//! @brief 遅延評価の式かどうかを返す関数
+		//! (遅延評価でない演算はその場で行列に評価されるので，ビュー以外の式は lazy() から作られたものに限られる)
+		template <class T>
+		static constexpr bool IsLazy(void){
+			return IsExpr<T>() && !IsViewType<std::remove_cv_t<std::remove_reference_t<T>>>::value;
+		}
+		
+		//! @brief 行列か式のどちらかであるかを返す関数
+		template <class T>
+		static constexpr bool IsOperand(void){
+			return IsMatrix<T>() || IsExpr<T>();
+		}
+		
+		//! @brief 評価結果の行列の型
+		template <class T, bool = IsExpr<T>()> struct ResultOf { using type = std::remove_cv_t<std::remove_reference_t<T>>; };
+		template <class T> struct ResultOf<T, true> { using type = typename std::remove_cv_t<std::remove_reference_t<T>>::ResultType; };
+		template <class T> using Result = typename ResultOf<T>::type;
+		
+		//! @brief 式の中での被演算子の保持の仕方 (左辺値の行列は参照，それ以外は値で保持)
+		template <class T>
+		using Hold = std::conditional_t<IsMatrix<T>() && std::is_lvalue_reference_v<T>, const Result<T>&, std::remove_cv_t<std::remove_reference_t<T>>>;
+		
+		//! @brief その場で評価する式の中での被演算子の保持の仕方 (式の寿命は演算子の中だけなので，行列は右辺値でも参照で保持)
+		template <class T>
+		using HoldNow = std::conditional_t<IsMatrix<T>(), const Result<T>&, std::remove_cv_t<std::remove_reference_t<T>>>;
+		
+		//! @brief 積の中での被演算子の保持の仕方 (行列の参照の式は元の行列の参照，それ以外の式は先に行列へ評価して値で保持)
+		template <class T, bool Lazy = true>
+		using HoldProd = std::conditional_t<IsRef<T>(), const Result<T>&, std::conditional_t<IsMatrix<T>(), std::conditional_t<Lazy, Hold<T>, HoldNow<T>>, Result<T>>>;
+		
+		//! @brief 行列の参照の式から元の行列を取り出す関数 (それ以外はそのまま転送)
+		template <class T>
+		static constexpr decltype(auto) Unwrap(T&& X){
+			if constexpr(IsRef<T>()){
+				return X.Get();
+			}else{
+				return std::forward<T>(X);
+			}
+		}
+		
+		//! @brief 遅延評価の場合は式をそのまま返し，それ以外はその場で評価した行列を返す関数
+		template <bool Lazy, class E>
+		static constexpr auto Finish(E&& X){
+			if constexpr(Lazy){
+				return std::forward<E>(X);
+			}else{
+				return X.eval();
+			}
+		}
+		
+		//! @brief 2つの被演算子から式を作るかどうか (少なくとも一方が式で，データ型が同じ場合)
+		template <class L, class R>
+		static constexpr bool IsExprPair(void){
+			if constexpr(IsOperand<L>() && IsOperand<R>()){
+				return (IsExpr<L>() || IsExpr<R>()) && std::is_same_v<typename Result<L>::value_type, typename Result<R>::value_type>;
+			}else{
+				return false;
+			}
+		}
+		
+		//! @brief 2つの被演算子から積の式を作るかどうか (両方とも行列か式で，データ型が同じ場合)
+		template <class L, class R>
+		static constexpr bool IsProdPair(void){
+			if constexpr(IsOperand<L>() && IsOperand<R>()){
+				return std::is_same_v<typename Result<L>::value_type, typename Result<R>::value_type>;
+			}else{
+				return false;
+			}
+		}
+		
+		//! @brief 行列の代入 Y = s*X
+		template <size_t NN, size_t MM, typename TT>
+		static constexpr void Assign(Matrix<NN,MM,TT>& Y, const Matrix<NN,MM,TT>& X, const TT s){
+			if(s == (TT)1){
+				Y.Data = X.Data;
+			}else{
+				for(size_t i = 0; i < NN; ++i){
+					for(size_t j = 0; j < MM; ++j) Y.Data[i][j] = s*X.Data[i][j];
+				}
+			}
+		}
+		
+		//! @brief 式の代入 Y = s*X
+		template <class EE, size_t NN, size_t MM, typename TT>
+		static constexpr void Assign(Matrix<NN,MM,TT>& Y, const MatrixExpr<EE,Matrix<NN,MM,TT>>& X, const TT s){
+			X.Derived().AssignTo(Y, s);
+		}
+		
+		//! @brief 行列の累積加算 Y = Y + s*X
+		template <size_t NN, size_t MM, typename TT>
+		static constexpr void AddTo(Matrix<NN,MM,TT>& Y, const Matrix<NN,MM,TT>& X, const TT s){
+			if constexpr(MatrixSIMD::isEnabled<TT>()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::Axpy(Y.Data[0].data(), s, X.Data[0].data(), NN*MM);
+					return;
+				}
+			}
+			for(size_t i = 0; i < NN; ++i){
+				for(size_t j = 0; j < MM; ++j) Y.Data[i][j] += s*X.Data[i][j];
+			}
+		}
+		
+		//! @brief 式の累積加算 Y = Y + s*X
+		template <class EE, size_t NN, size_t MM, typename TT>
+		static constexpr void AddTo(Matrix<NN,MM,TT>& Y, const MatrixExpr<EE,Matrix<NN,MM,TT>>& X, const TT s){
+			X.Derived().AddTo(Y, s);
+		}
+		
+		//! @brief 行列Xが指定した行列そのものかを返す関数
+		template <size_t NN, size_t MM, typename TT>
+		static constexpr bool IsAliasOf(const Matrix<NN,MM,TT>& X, const void* p){
+			return static_cast<const void*>(&X) == p;
+		}
+		
+		//! @brief 式Xの中に指定した行列が含まれているかを返す関数
+		template <class EE, class RR>
+		static constexpr bool IsAliasOf(const MatrixExpr<EE,RR>& X, const void* p){
+			return X.Derived().IsAliasOf(p);
+		}
+	
+	private:
+		MatrixExprOp() = delete;						//!< コンストラクタ使用禁止
+		MatrixExprOp(MatrixExprOp&& r) = delete;		//!< ムーブコンストラクタ使用禁止
+		~MatrixExprOp() = delete;						//!< デストラクタ使用禁止
+		MatrixExprOp(const MatrixExprOp&) = delete;		//!< コピーコンストラクタ使用禁止
+		const MatrixExprOp& operator=(const MatrixExprOp&) = delete;	//!< 代入演算子使用禁止
+};
+
+//! @brief 行列積の式 A*B
+//! @tparam	RR	評価結果の行列の型 (実引数依存の名前探索で RR のfriend関数が見つかるようにテンプレート引数に含める)
+//! @tparam	LL	左側の被演算子の保持型 (Matrix か const Matrix&)
+//! @tparam	RL	右側の被演算子の保持型 (Matrix か const Matrix&)
+template <class RR, class LL, class RL>
+class MatrixExprProd : public MatrixExpr<MatrixExprProd<RR,LL,RL>, RR> {
+	private:
+		using Ltype = std::remove_cv_t<std::remove_reference_t<LL>>;	//!< 左側の行列の型
+		using Rtype = std::remove_cv_t<std::remove_reference_t<RL>>;	//!< 右側の行列の型
+		using TT = typename Ltype::value_type;							//!< データ型
+	
+	public:
+		//! @brief コンストラクタ
+		//! @param[in]	left	左側の被演算子
+		//! @param[in]	right	右側の被演算子
+		template <class L, class R>
+		constexpr MatrixExprProd(L&& left, R&& right)
+			: A(std::forward<L>(left)), B(std::forward<R>(right))
+		{
+			static_assert(Ltype::N == Rtype::M, "Matrix Size Error");	// 行列のサイズチェック
+		}
+		
+		//! @brief 出力先への代入 Y = s*A*B
+		//! @param[out]	Y	出力先の行列 (AやBと同じであってはならない)
+		//! @param[in]	s	スカラー係数
+		constexpr void AssignTo(RR& Y, const TT s = 1) const{
+			if constexpr(isTiny()){
+				MatrixUnroll::MatMul<false>(Y.Data, A.Data, B.Data, s);	// 小さい行列のときは展開版
+				return;
+			}
+			if constexpr(MatrixSIMD::isEnabled<TT>()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::MatMul<Ltype::N,Ltype::M,Rtype::N>(Y.Data[0].data(), A.Data[0].data(), B.Data[0].data(), s);
+					return;
+				}
+			}
+			for(size_t k = 0; k < Rtype::N; ++k){
+				const TT b0 = s*B.Data[k][0];
+				for(size_t j = 0; j < Ltype::M; ++j) Y.Data[k][j] = A.Data[0][j]*b0;
+				for(size_t i = 1; i < Ltype::N; ++i){
+					const TT b = s*B.Data[k][i];
+					for(size_t j = 0; j < Ltype::M; ++j) Y.Data[k][j] += A.Data[i][j]*b;
+				}
+			}
+		}
+		
+		//! @brief 出力先への累積加算 Y = Y + s*A*B
+		//! 行列積は零から計算して最後にYへ加算する (複数の項の行列積が互いに依存せず，従来の演算子と同じ丸めになる)
+		//! @param[in,out]	Y	出力先の行列 (AやBと同じであってはならない)
+		//! @param[in]	s	スカラー係数
+		constexpr void AddTo(RR& Y, const TT s) const{
+			if constexpr(isTiny()){
+				MatrixUnroll::MatMul<true>(Y.Data, A.Data, B.Data, s);	// 小さい行列のときは展開版
+				return;
+			}
+			if constexpr(MatrixSIMD::isEnabled<TT>()){
+				if(!__builtin_is_constant_evaluated()){
+					// SIMD版 (定数式評価のときは下の普通のループ)
+					MatrixSIMD::MatMulAdd<Ltype::N,Ltype::M,Rtype::N>(Y.Data[0].data(), A.Data[0].data(), B.Data[0].data(), s);
+					return;
+				}
+			}
+			for(size_t k = 0; k < Rtype::N; ++k){
+				std::array<TT, Ltype::M> y = {0};	// 1列分の行列積
+				for(size_t i = 0; i < Ltype::N; ++i){
+					const TT b = s*B.Data[k][i];
+					for(size_t j = 0; j < Ltype::M; ++j) y[j] += A.Data[i][j]*b;
+				}
+				for(size_t j = 0; j < Ltype::M; ++j) Y.Data[k][j] += y[j];
+			}
+		}
+		
+		//! @brief 式の中に指定した行列が含まれているかを返す関数
+		constexpr bool IsAliasOf(const void* p) const{
+			return MatrixExprOp::IsAliasOf(A, p) || MatrixExprOp::IsAliasOf(B, p);
+		}
+	
+	private:
+		LL A;	//!< 左側の被演算子
+		RL B;	//!< 右側の被演算子
+		
+		//! @brief 展開版(MatrixUnroll.hh)で計算するかを返す関数
+		static constexpr bool isTiny(void){
+			return MatrixUnroll::isTiny<TT,Ltype::N,Ltype::M,Rtype::N>();
+		}
+};
+
+//! @brief 加減算の式 A + B (SS = 1), A - B (SS = -1)
+//! @tparam	LL	左側の被演算子の保持型
+//! @tparam	RL	右側の被演算子の保持型
+//! @tparam	SS	右側の被演算子の符号
+template <class LL, class RL, int SS>
+class MatrixExprSum : public MatrixExpr<MatrixExprSum<LL,RL,SS>, MatrixExprOp::Result<LL>> {
+	private:
+		using RR = MatrixExprOp::Result<LL>;	//!< 評価結果の行列の型
+		using TT = typename RR::value_type;		//!< データ型
+	
+	public:
+		//! @brief コンストラクタ
+		//! @param[in]	left	左側の被演算子
+		//! @param[in]	right	右側の被演算子
+		template <class L, class R>
+		constexpr MatrixExprSum(L&& left, R&& right)
+			: A(std::forward<L>(left)), B(std::forward<R>(right))
+		{
+			static_assert(MatrixExprOp::Result<LL>::N == MatrixExprOp::Result<RL>::N, "Matrix Size Error");	// 行列のサイズチェック
+			static_assert(MatrixExprOp::Result<LL>::M == MatrixExprOp::Result<RL>::M, "Matrix Size Error");	// 行列のサイズチェック
+		}
+		
+		//! @brief 出力先への代入 Y = s*(A ± B)
+		//! @param[out]	Y	出力先の行列 (式の中に現れてはならない)
+		//! @param[in]	s	スカラー係数
+		constexpr void AssignTo(RR& Y, const TT s = 1) const{
+			MatrixExprOp::Assign(Y, A, s);
+			MatrixExprOp::AddTo(Y, B, (TT)SS*s);
+		}
+		
+		//! @brief 出力先への累積加算 Y = Y + s*(A ± B)
+		//! @param[in,out]	Y	出力先の行列 (式の中に現れてはならない)
+		//! @param[in]	s	スカラー係数
+		constexpr void AddTo(RR& Y, const TT s) const{
+			MatrixExprOp::AddTo(Y, A, s);
+			MatrixExprOp::AddTo(Y, B, (TT)SS*s);
+		}
+		
+		//! @brief 式の中に指定した行列が含まれているかを返す関数
+		constexpr bool IsAliasOf(const void* p) const{
+			return MatrixExprOp::IsAliasOf(A, p) || MatrixExprOp::IsAliasOf(B, p);
+		}
+	
+	private:
+		LL A;	//!< 左側の被演算子
+		RL B;	//!< 右側の被演算子
+};
+
+//! @brief 式のスカラー倍 a*E
+//! @tparam	EL	式の保持型
+template <class EL>
+class MatrixExprScale : public MatrixExpr<MatrixExprScale<EL>, MatrixExprOp::Result<EL>> {
+	private:
+		using RR = MatrixExprOp::Result<EL>;	//!< 評価結果の行列の型
+		using TT = typename RR::value_type;		//!< データ型
+	
+	public:
+		//! @brief コンストラクタ
+		//! @param[in]	a		スカラー係数
+		//! @param[in]	expr	式
+		template <class E>
+		constexpr MatrixExprScale(const TT a, E&& expr)
+			: s(a), X(std::forward<E>(expr))
+		{
+			
+		}
+		
+		//! @brief 出力先への代入 Y = b*a*E
+		//! @param[out]	Y	出力先の行列 (式の中に現れてはならない)
+		//! @param[in]	b	スカラー係数
+		constexpr void AssignTo(RR& Y, const TT b = 1) const{
+			MatrixExprOp::Assign(Y, X, b*s);
+		}
+		
+		//! @brief 出力先への累積加算 Y = Y + b*a*E
+		//! @param[in,out]	Y	出力先の行列 (式の中に現れてはならない)
+		//! @param[in]	b	スカラー係数
+		constexpr void AddTo(RR& Y, const TT b) const{
+			MatrixExprOp::AddTo(Y, X, b*s);
+		}
+		
+		//! @brief 式の中に指定した行列が含まれているかを返す関数
+		constexpr bool IsAliasOf(const void* p) const{
+			return MatrixExprOp::IsAliasOf(X, p);
+		}
+	
+	private:
+		TT s;	//!< スカラー係数
+		EL X;	//!< 式
+};
+
+//! @brief 行列の参照の式 (lazy() で作り，遅延評価を明示するために使う)
+//! @tparam	RR	行列の型
+template <class RR>
+class MatrixExprRef : public MatrixExpr<MatrixExprRef<RR>, RR> {
+	private:
+		using TT = typename RR::value_type;	//!< データ型
+	
+	public:
+		//! @brief コンストラクタ
+		//! @param[in]	right	参照する行列
+		constexpr explicit MatrixExprRef(const RR& right)
+			: A(right)
+		{
+			
+		}
+		
+		//! @brief 出力先への代入 Y = s*A
+		//! @param[out]	Y	出力先の行列
+		//! @param[in]	s	スカラー係数
+		constexpr void AssignTo(RR& Y, const TT s = 1) const{
+			MatrixExprOp::Assign(Y, A, s);
+		}
+		
+		//! @brief 出力先への累積加算 Y = Y + s*A
+		//! @param[in,out]	Y	出力先の行列
+		//! @param[in]	s	スカラー係数
+		constexpr void AddTo(RR& Y, const TT s) const{
+			MatrixExprOp::AddTo(Y, A, s);
+		}
+		
+		//! @brief 式の中に指定した行列が含まれているかを返す関数
+		constexpr bool IsAliasOf(const void* p) const{
+			return MatrixExprOp::IsAliasOf(A, p);
+		}
+		
+		//! @brief 参照している行列を返す関数
+		//! @return 行列への参照
+		constexpr const RR& Get(void) const{
+			return A;
+		}
+	
+	private:
+		const RR& A;	//!< 参照する行列
+};
+
+//! @brief 遅延評価を明示する関数
+//! lazy(A)*B や lazy(Ad)*x + lazy(Bd)*u のように使うと，演算子が行列の代わりに式を返し，
+//! Matrixへの代入時に中間の行列を作らずに出力先へ直接計算される。
+//! @param[in]	U	行列 (式より長生きさせること)
+//! @return	行列の参照の式
+template <size_t NN, size_t MM, typename TT>
+constexpr auto lazy(const Matrix<NN,MM,TT>& U){
+	return MatrixExprRef<Matrix<NN,MM,TT>>(U);
+}
+
+//! @brief 一時的な行列からの遅延評価の式の生成禁止
+template <size_t NN, size_t MM, typename TT>
+void lazy(const Matrix<NN,MM,TT>&& U) = delete;
+
+//! @brief 行列積演算子 (行列/式＊行列/式の場合，データ型が同じときのみ)
+//! @param[in]	left	演算子の左側
+//! @param[in]	right	演算子の右側
+//! @return 結果の行列 (遅延評価の式を含む場合は行列積の式)
+template <class L, class R, std::enable_if_t<MatrixExprOp::IsProdPair<L,R>(), std::nullptr_t> = nullptr>
+constexpr auto operator*(L&& left, R&& right){
+	static_assert(MatrixExprOp::Result<L>::N == MatrixExprOp::Result<R>::M, "Matrix Size Error");	// 行列のサイズチェック
+	using RR = Matrix<MatrixExprOp::Result<R>::N, MatrixExprOp::Result<L>::M, typename MatrixExprOp::Result<L>::value_type>;
+	constexpr bool Lazy = MatrixExprOp::IsLazy<L>() || MatrixExprOp::IsLazy<R>();
+	using Prod = MatrixExprProd<RR, MatrixExprOp::HoldProd<L,Lazy>, MatrixExprOp::HoldProd<R,Lazy>>;
+	return MatrixExprOp::Finish<Lazy>(Prod(MatrixExprOp::Unwrap(std::forward<L>(left)), MatrixExprOp::Unwrap(std::forward<R>(right))));
+}
+
+//! @brief 加算演算子 (少なくとも一方が式の場合)
+//! @param[in]	left	演算子の左側
+//! @param[in]	right	演算子の右側
+//! @return 結果の行列 (遅延評価の式を含む場合は加算の式)
+template <class L, class R, std::enable_if_t<MatrixExprOp::IsExprPair<L,R>(), std::nullptr_t> = nullptr>
+constexpr auto operator+(L&& left, R&& right){
+	static_assert(MatrixExprOp::Result<L>::N == MatrixExprOp::Result<R>::N, "Matrix Size Error");	// 行列のサイズチェック
+	static_assert(MatrixExprOp::Result<L>::M == MatrixExprOp::Result<R>::M, "Matrix Size Error");	// 行列のサイズチェック
+	if constexpr(MatrixExprOp::IsLazy<L>() || MatrixExprOp::IsLazy<R>()){
+		return MatrixExprSum<MatrixExprOp::Hold<L>, MatrixExprOp::Hold<R>, 1>(std::forward<L>(left), std::forward<R>(right));
+	}else{
+		return MatrixExprSum<MatrixExprOp::HoldNow<L>, MatrixExprOp::HoldNow<R>, 1>(std::forward<L>(left), std::forward<R>(right)).eval();
+	}
+}
+
+//! @brief 減算演算子 (少なくとも一方が式の場合)
+//! @param[in]	left	演算子の左側
+//! @param[in]	right	演算子の右側
+//! @return 結果の行列 (遅延評価の式を含む場合は減算の式)
+template <class L, class R, std::enable_if_t<MatrixExprOp::IsExprPair<L,R>(), std::nullptr_t> = nullptr>
+constexpr auto operator-(L&& left, R&& right){
+	static_assert(MatrixExprOp::Result<L>::N == MatrixExprOp::Result<R>::N, "Matrix Size Error");	// 行列のサイズチェック
+	static_assert(MatrixExprOp::Result<L>::M == MatrixExprOp::Result<R>::M, "Matrix Size Error");	// 行列のサイズチェック
+	if constexpr(MatrixExprOp::IsLazy<L>() || MatrixExprOp::IsLazy<R>()){
+		return MatrixExprSum<MatrixExprOp::Hold<L>, MatrixExprOp::Hold<R>, -1>(std::forward<L>(left), std::forward<R>(right));
+	}else{
+		return MatrixExprSum<MatrixExprOp::HoldNow<L>, MatrixExprOp::HoldNow<R>, -1>(std::forward<L>(left), std::forward<R>(right)).eval();
+	}
+}
+
+//! @brief 単項マイナス演算子 (式の場合)
+//! @param[in]	right	演算子の右側
+//! @return 結果の行列 (遅延評価の式の場合は符号反転の式)
+template <class E, std::enable_if_t<MatrixExprOp::IsExpr<E>(), std::nullptr_t> = nullptr>
+constexpr auto operator-(E&& right){
+	using TT = typename MatrixExprOp::Result<E>::value_type;
+	return MatrixExprOp::Finish<MatrixExprOp::IsLazy<E>()>(MatrixExprScale<MatrixExprOp::Hold<E>>((TT)(-1), std::forward<E>(right)));
+}
+
+//! @brief 単項プラス演算子 (式の場合)
+//! @param[in]	right	演算子の右側
+//! @return 結果の行列
+template <class EE, class RR>
+constexpr RR operator+(const MatrixExpr<EE,RR>& right){
+	return RR(right);
+}
+
+//! @brief スカラー乗算演算子 (スカラー＊式の場合)
+//! @param[in]	left	演算子の左側
+//! @param[in]	right	演算子の右側
+//! @return 結果の行列 (遅延評価の式の場合はスカラー倍の式)
+template <class E, std::enable_if_t<MatrixExprOp::IsExpr<E>(), std::nullptr_t> = nullptr>
+constexpr auto operator*(const typename MatrixExprOp::Result<E>::value_type& left, E&& right){
+	return MatrixExprOp::Finish<MatrixExprOp::IsLazy<E>()>(MatrixExprScale<MatrixExprOp::Hold<E>>(left, std::forward<E>(right)));
+}
+
+//! @brief スカラー乗算演算子 (式＊スカラーの場合)
+//! @param[in]	left	演算子の左側
+//! @param[in]	right	演算子の右側
+//! @return 結果の行列 (遅延評価の式の場合はスカラー倍の式)
+template <class E, std::enable_if_t<MatrixExprOp::IsExpr<E>(), std::nullptr_t> = nullptr>
+constexpr auto operator*(E&& left, const typename MatrixExprOp::Result<E>::value_type& right){
+	return MatrixExprOp::Finish<MatrixExprOp::IsLazy<E>()>(MatrixExprScale<MatrixExprOp::Hold<E>>(right, std::forward<E>(left)));
+}
+
+//! @brief スカラー除算演算子 (式／スカラーの場合，評価してから計算)
+template <class EE, class RR>
+constexpr RR operator/(const MatrixExpr<EE,RR>& left, const typename RR::value_type& right){
+	return RR(left)/right;
+}
+
+//! @brief スカラー加算演算子 (式＋スカラーの場合，評価してから計算)
+template <class EE, class RR>
+constexpr RR operator+(const MatrixExpr<EE,RR>& left, const typename RR::value_type& right){
+	return RR(left) + right;
+}
+
+//! @brief スカラー加算演算子 (スカラー＋式の場合，評価してから計算)
+template <class EE, class RR>
+constexpr RR operator+(const typename RR::value_type& left, const MatrixExpr<EE,RR>& right){
+	return left + RR(right);
+}
+
+//! @brief スカラー減算演算子 (式－スカラーの場合，評価してから計算)
+template <class EE, class RR>
+constexpr RR operator-(const MatrixExpr<EE,RR>& left, const typename RR::value_type& right){
+	return RR(left) - right;
+}
+
+//! @brief スカラー減算演算子 (スカラー－式の場合，評価してから計算)
+template <class EE, class RR>
+constexpr RR operator-(const typename RR::value_type& left, const MatrixExpr<EE,RR>& right){
+	return left - RR(right);
+}
+}
+
+#endif
@@ -0,0 +1,18 @@
+//! @file MatrixSIMD.cc
+//! @brief 行列/ベクトル計算クラス用SIMD演算カーネル
+//!
+//! Matrixクラスの行列積，転置，要素ごとの演算をAVX2/FMA命令で計算する。
+//! double型とfloat型のみ対応で，それ以外の型の場合はMatrixクラス側の普通のループが使われる。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+
+#include "MatrixSIMD.hh"
+
+// テンプレートのため，実体もヘッダ側に実装。
+
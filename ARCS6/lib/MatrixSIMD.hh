@@ -0,0 +1,619 @@
+//! @file MatrixSIMD.hh
+//! @brief 行列/ベクトル計算クラス用SIMD演算カーネル
+//!
+//! Matrixクラスの行列積，転置，要素ごとの演算をAVX2/FMA命令で計算する。
+//! double型とfloat型のみ対応で，それ以外の型の場合はMatrixクラス側の普通のループが使われる。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・コンパイラに -mavx2 -mfma (もしくは -march=native でAVX2/FMA対応のCPU) が渡されたときに自動的に有効になる。
+// ・ARCS_MATRIX_NOSIMD を定義すると強制的に無効になる (CMakeの場合は -DARCS_MATRIX_SIMD=OFF)。
+// ・行列積の累積加算の順番はスカラー版と同一で，FMAによる丸めの違いのみが生じる。
+//   従ってスカラー版との差は 要素あたり 高々 (内側の次数)×機械イプシロン×Σ|a||b| 程度。
+//   (-ffp-contract=fast でスカラー版もFMAに縮約されている場合はビット単位で一致する)
+// ・要素ごとの加減乗除と転置はスカラー版とビット単位で一致する。
+
+#ifndef MATRIXSIMD
+#define MATRIXSIMD
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <cmath>
+#include <algorithm>
+
+// SIMD有効化判定用マクロ
+#if defined(__AVX2__) && defined(__FMA__) && !defined(ARCS_MATRIX_NOSIMD)
+	#define ARCS_MATRIX_SIMD_AVX2	//!< AVX2/FMA版のカーネルを使用
+	#include <immintrin.h>
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief SIMDレジスタ操作の型別定義(非対応型の場合)
+//! @tparam	TT	データ型
+template <typename TT>
+struct SIMDregister {
+	static constexpr bool ENABLED = false;	//!< SIMD対応フラグ
+};
+
+#ifdef ARCS_MATRIX_SIMD_AVX2
+//! @brief SIMDレジスタ操作の型別定義(double型, AVX2 4レーン版)
+template <>
+struct SIMDregister<double> {
+	using reg = __m256d;						//!< レジスタ型
+	static constexpr bool ENABLED = true;		//!< SIMD対応フラグ
+	static constexpr size_t LANE = 4;			//!< 1レジスタあたりの要素数
+	static reg load(const double* p){ return _mm256_loadu_pd(p); }
+	static void store(double* p, reg a){ _mm256_storeu_pd(p, a); }
+	static reg set1(double a){ return _mm256_set1_pd(a); }
+	static reg zero(void){ return _mm256_setzero_pd(); }
+	static reg add(reg a, reg b){ return _mm256_add_pd(a, b); }
+	static reg sub(reg a, reg b){ return _mm256_sub_pd(a, b); }
+	static reg mul(reg a, reg b){ return _mm256_mul_pd(a, b); }
+	static reg div(reg a, reg b){ return _mm256_div_pd(a, b); }
+	static reg fmadd(reg a, reg b, reg c){ return _mm256_fmadd_pd(a, b, c); }	// a*b + c
+	
+	//! @brief レジスタ内の全レーンの総和を返す関数
+	static double hsum(reg a){
+		const __m128d h = _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+		return _mm_cvtsd_f64(_mm_add_sd(h, _mm_unpackhi_pd(h, h)));
+	}
+	
+	//! @brief 先頭からn個のレーンを有効にするマスクを返す関数
+	static __m256i mask(size_t n){
+		const __m256i idx = _mm256_set_epi64x(3, 2, 1, 0);
+		return _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)n), idx);
+	}
+	static reg maskload(const double* p, size_t n){ return _mm256_maskload_pd(p, mask(n)); }
+	static void maskstore(double* p, size_t n, reg a){ _mm256_maskstore_pd(p, mask(n), a); }
+};
+
+//! @brief SIMDレジスタ操作の型別定義(float型, AVX2 8レーン版)
+template <>
+struct SIMDregister<float> {
+	using reg = __m256;							//!< レジスタ型
+	static constexpr bool ENABLED = true;		//!< SIMD対応フラグ
+	static constexpr size_t LANE = 8;			//!< 1レジスタあたりの要素数
+	static reg load(const float* p){ return _mm256_loadu_ps(p); }
+	static void store(float* p, reg a){ _mm256_storeu_ps(p, a); }
+	static reg set1(float a){ return _mm256_set1_ps(a); }
+	static reg zero(void){ return _mm256_setzero_ps(); }
+	static reg add(reg a, reg b){ return _mm256_add_ps(a, b); }
+	static reg sub(reg a, reg b){ return _mm256_sub_ps(a, b); }
+	static reg mul(reg a, reg b){ return _mm256_mul_ps(a, b); }
+	static reg div(reg a, reg b){ return _mm256_div_ps(a, b); }
+	static reg fmadd(reg a, reg b, reg c){ return _mm256_fmadd_ps(a, b, c); }	// a*b + c
+	
+	//! @brief レジスタ内の全レーンの総和を返す関数
+	static float hsum(reg a){
+		__m128 h = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+		h = _mm_add_ps(h, _mm_movehl_ps(h, h));
+		return _mm_cvtss_f32(_mm_add_ss(h, _mm_movehdup_ps(h)));
+	}
+	
+	//! @brief 先頭からn個のレーンを有効にするマスクを返す関数
+	static __m256i mask(size_t n){
+		const __m256i idx = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+		return _mm256_cmpgt_epi32(_mm256_set1_epi32((int)n), idx);
+	}
+	static reg maskload(const float* p, size_t n){ return _mm256_maskload_ps(p, mask(n)); }
+	static void maskstore(float* p, size_t n, reg a){ _mm256_maskstore_ps(p, mask(n), a); }
+};
+#endif
+
+//! @brief 行列/ベクトル計算クラス用SIMD演算カーネル
+//! 行列はすべて Data[N列(横)][M行(縦)] の並び，すなわち列ごとに連続した配列として扱う。
+class MatrixSIMD {
+	public:
+		//! @brief 指定した型でSIMDカーネルが使えるかを返す関数
+		//! @tparam	TT	データ型
+		//! @return	true = 使える，false = 使えない
+		template <typename TT>
+		static constexpr bool isEnabled(void){
+			return SIMDregister<TT>::ENABLED;
+		}
+		
+		//! @brief 要素ごとの2項演算 Y = op(A, B) (YはAかBと同じでもよい)
+		//! @param[out]	Y	出力配列の先頭
+		//! @param[in]	A	入力配列の先頭
+		//! @param[in]	B	入力配列の先頭
+		//! @param[in]	L	要素数
+		//! @param[in]	op	レジスタ同士の演算
+		template <typename TT, typename F>
+		static void Map(TT* Y, const TT* A, const TT* B, const size_t L, F op){
+			using R = SIMDregister<TT>;
+			size_t i = 0;
+			for(; i + R::LANE <= L; i += R::LANE) R::store(Y + i, op(R::load(A + i), R::load(B + i)));
+			if(i < L){
+				// 端数はマスク付きで読み書き
+				const size_t r = L - i;
+				R::maskstore(Y + i, r, op(R::maskload(A + i, r), R::maskload(B + i, r)));
+			}
+		}
+		
+		//! @brief 要素とスカラーの2項演算 Y = op(A, b) (YはAと同じでもよい)
+		//! @param[out]	Y	出力配列の先頭
+		//! @param[in]	A	入力配列の先頭
+		//! @param[in]	b	スカラー
+		//! @param[in]	L	要素数
+		//! @param[in]	op	レジスタ同士の演算
+		template <typename TT, typename F>
+		static void MapScalar(TT* Y, const TT* A, const TT b, const size_t L, F op){
+			using R = SIMDregister<TT>;
+			const auto bv = R::set1(b);
+			size_t i = 0;
+			for(; i + R::LANE <= L; i += R::LANE) R::store(Y + i, op(R::load(A + i), bv));
+			if(i < L){
+				// 端数はマスク付きで読み書き
+				const size_t r = L - i;
+				R::maskstore(Y + i, r, op(R::maskload(A + i, r), bv));
+			}
+		}
+		
+		//! @brief 加算 Y = A + B
+		template <typename TT>
+		static void Add(TT* Y, const TT* A, const TT* B, const size_t L){
+			Map(Y, A, B, L, [](auto a, auto b){ return SIMDregister<TT>::add(a, b); });
+		}
+		
+		//! @brief 減算 Y = A - B
+		template <typename TT>
+		static void Sub(TT* Y, const TT* A, const TT* B, const size_t L){
+			Map(Y, A, B, L, [](auto a, auto b){ return SIMDregister<TT>::sub(a, b); });
+		}
+		
+		//! @brief 要素ごとの乗算 Y = A .* B
+		template <typename TT>
+		static void Mul(TT* Y, const TT* A, const TT* B, const size_t L){
+			Map(Y, A, B, L, [](auto a, auto b){ return SIMDregister<TT>::mul(a, b); });
+		}
+		
+		//! @brief 要素ごとの除算 Y = A ./ B
+		template <typename TT>
+		static void Div(TT* Y, const TT* A, const TT* B, const size_t L){
+			Map(Y, A, B, L, [](auto a, auto b){ return SIMDregister<TT>::div(a, b); });
+		}
+		
+		//! @brief スカラー加算 Y = A + b
+		template <typename TT>
+		static void AddScalar(TT* Y, const TT* A, const TT b, const size_t L){
+			MapScalar(Y, A, b, L, [](auto a, auto b){ return SIMDregister<TT>::add(a, b); });
+		}
+		
+		//! @brief スカラー減算 Y = A - b
+		template <typename TT>
+		static void SubScalar(TT* Y, const TT* A, const TT b, const size_t L){
+			MapScalar(Y, A, b, L, [](auto a, auto b){ return SIMDregister<TT>::sub(a, b); });
+		}
+		
+		//! @brief スカラーからの減算 Y = b - A
+		template <typename TT>
+		static void ScalarSub(TT* Y, const TT* A, const TT b, const size_t L){
+			MapScalar(Y, A, b, L, [](auto a, auto b){ return SIMDregister<TT>::sub(b, a); });
+		}
+		
+		//! @brief スカラー乗算 Y = A*b
+		template <typename TT>
+		static void MulScalar(TT* Y, const TT* A, const TT b, const size_t L){
+			MapScalar(Y, A, b, L, [](auto a, auto b){ return SIMDregister<TT>::mul(a, b); });
+		}
+		
+		//! @brief スカラー除算 Y = A/b
+		template <typename TT>
+		static void DivScalar(TT* Y, const TT* A, const TT b, const size_t L){
+			MapScalar(Y, A, b, L, [](auto a, auto b){ return SIMDregister<TT>::div(a, b); });
+		}
+		
+		//! @brief 符号反転 Y = -A
+		template <typename TT>
+		static void Neg(TT* Y, const TT* A, const size_t L){
+			MapScalar(Y, A, (TT)(-0.0), L, [](auto a, auto z){ return SIMDregister<TT>::sub(z, a); });	// -0 - a で符号付きゼロも一致
+		}
+		
+		//! @brief スカラー倍の加算 Y = Y + a*X
+		template <typename TT>
+		static void Axpy(TT* Y, const TT a, const TT* X, const size_t L){
+			using R = SIMDregister<TT>;
+			const auto av = R::set1(a);
+			const size_t LL = L/R::LANE*R::LANE;	// レジスタに収まる要素数
+			for(size_t i = 0; i < LL; i += R::LANE) R::store(Y + i, R::fmadd(av, R::load(X + i), R::load(Y + i)));
+			for(size_t i = LL; i < L; ++i) Y[i] = std::fma(a, X[i], Y[i]);	// 端数は普通のFMAで計算
+		}
+		
+		//! @brief 行列積 Y = A*B
+		//! YはAともBとも異なる領域であること
+		//! @tparam	N	Aの列数 = Bの行数
+		//! @tparam	M	Aの行数
+		//! @tparam	K	Bの列数
+		//! @param[out]	Y	出力行列 (K列×M行)
+		//! @param[in]	A	左側の行列 (N列×M行)
+		//! @param[in]	B	右側の行列 (K列×N行)
+		template <size_t N, size_t M, size_t K, typename TT>
+		static void MatMul(TT* Y, const TT* A, const TT* B){
+			MatMulKernel<N,M,K,false,false>(Y, A, B, (TT)1, (TT)0);
+		}
+		
+		//! @brief スカラー倍付きの行列積 Y = s*A*B
+		//! YはAともBとも異なる領域であること
+		//! @tparam	N	Aの列数 = Bの行数
+		//! @tparam	M	Aの行数
+		//! @tparam	K	Bの列数
+		//! @param[out]	Y	出力行列 (K列×M行)
+		//! @param[in]	A	左側の行列 (N列×M行)
+		//! @param[in]	B	右側の行列 (K列×N行)
+		//! @param[in]	s	スカラー係数
+		template <size_t N, size_t M, size_t K, typename TT>
+		static void MatMul(TT* Y, const TT* A, const TT* B, const TT s){
+			MatMulKernel<N,M,K,false,false>(Y, A, B, s, (TT)0);
+		}
+		
+		//! @brief 行列積の累積加算 Y = Y + s*A*B
+		//! YはAともBとも異なる領域であること
+		//! 行列積は零から計算して最後にYへ加算するので，複数の項の行列積の計算が互いに依存せず並列に実行できる
+		//! @tparam	N	Aの列数 = Bの行数
+		//! @tparam	M	Aの行数
+		//! @tparam	K	Bの列数
+		//! @param[in,out]	Y	入出力行列 (K列×M行)
+		//! @param[in]	A	左側の行列 (N列×M行)
+		//! @param[in]	B	右側の行列 (K列×N行)
+		//! @param[in]	s	スカラー係数
+		template <size_t N, size_t M, size_t K, typename TT>
+		static void MatMulAdd(TT* Y, const TT* A, const TT* B, const TT s){
+			MatMulKernel<N,M,K,true,false>(Y, A, B, s, (TT)1);
+		}
+		
+		//! @brief 出力行列の係数付きの行列積の累積加算 Y = s*A*B + beta*Y
+		//! YはAともBとも異なる領域であること，beta = 1 のときは MatMulAdd と同じ結果になる
+		//! @tparam	N	Aの列数 = Bの行数
+		//! @tparam	M	Aの行数
+		//! @tparam	K	Bの列数
+		//! @param[in,out]	Y	入出力行列 (K列×M行)
+		//! @param[in]	A	左側の行列 (N列×M行)
+		//! @param[in]	B	右側の行列 (K列×N行)
+		//! @param[in]	s	行列積のスカラー係数
+		//! @param[in]	beta	出力行列のスカラー係数
+		template <size_t N, size_t M, size_t K, typename TT>
+		static void MatMulAdd(TT* Y, const TT* A, const TT* B, const TT s, const TT beta){
+			MatMulKernel<N,M,K,true,false>(Y, A, B, s, beta);
+		}
+		
+		//! @brief 右側が転置された行列積 Y = s*A*B^T
+		//! YはAともBとも異なる領域であること，転置行列は作らずにBを行方向に読み出す
+		//! @tparam	N	Aの列数 = Bの列数
+		//! @tparam	M	Aの行数
+		//! @tparam	K	Bの行数
+		//! @param[out]	Y	出力行列 (K列×M行)
+		//! @param[in]	A	左側の行列 (N列×M行)
+		//! @param[in]	B	右側の行列 (N列×K行)
+		//! @param[in]	s	スカラー係数
+		template <size_t N, size_t M, size_t K, typename TT>
+		static void MatMulTp(TT* Y, const TT* A, const TT* B, const TT s){
+			MatMulKernel<N,M,K,false,true>(Y, A, B, s, (TT)0);
+		}
+		
+		//! @brief 左側が転置された行列積 Y = s*A^T*B
+		//! YはAともBとも異なる領域であること，Aの列とBの列がどちらも連続しているので列同士の内積として計算する
+		//! @tparam	N	Aの列数
+		//! @tparam	M	Aの行数 = Bの行数
+		//! @tparam	K	Bの列数
+		//! @param[out]	Y	出力行列 (K列×N行)
+		//! @param[in]	A	左側の行列 (N列×M行)
+		//! @param[in]	B	右側の行列 (K列×M行)
+		//! @param[in]	s	スカラー係数
+		template <size_t N, size_t M, size_t K, typename TT>
+		static void TpMatMul(TT* Y, const TT* A, const TT* B, const TT s){
+			using R = SIMDregister<TT>;
+			constexpr size_t L = R::LANE;
+			constexpr size_t ML = M/L*L;	// レジスタに収まる行数
+			for(size_t k = 0; k < K; ++k){
+				const TT* b = B + k*M;	// 右側行列のk列目
+				TT* y = Y + k*N;		// 出力行列のk列目
+				size_t i = 0;
+				// Aの4列分の内積をまとめて計算してBの列の読み込みを共有
+				for(; i + 4 <= N; i += 4){
+					const TT* a = A + i*M;
+					auto y0 = R::zero(), y1 = R::zero(), y2 = R::zero(), y3 = R::zero();
+					for(size_t j = 0; j < ML; j += L){
+						const auto bj = R::load(b + j);
+						y0 = R::fmadd(R::load(a +       j), bj, y0);
+						y1 = R::fmadd(R::load(a +   M + j), bj, y1);
+						y2 = R::fmadd(R::load(a + 2*M + j), bj, y2);
+						y3 = R::fmadd(R::load(a + 3*M + j), bj, y3);
+					}
+					TT t0 = R::hsum(y0), t1 = R::hsum(y1), t2 = R::hsum(y2), t3 = R::hsum(y3);
+					for(size_t j = ML; j < M; ++j){
+						t0 = std::fma(a[      j], b[j], t0);
+						t1 = std::fma(a[  M + j], b[j], t1);
+						t2 = std::fma(a[2*M + j], b[j], t2);
+						t3 = std::fma(a[3*M + j], b[j], t3);
+					}
+					y[i    ] = s*t0;
+					y[i + 1] = s*t1;
+					y[i + 2] = s*t2;
+					y[i + 3] = s*t3;
+				}
+				// 端数の列
+				for(; i < N; ++i){
+					const TT* a = A + i*M;
+					auto y0 = R::zero();
+					for(size_t j = 0; j < ML; j += L) y0 = R::fmadd(R::load(a + j), R::load(b + j), y0);
+					TT t0 = R::hsum(y0);
+					for(size_t j = ML; j < M; ++j) t0 = std::fma(a[j], b[j], t0);
+					y[i] = s*t0;
+				}
+			}
+		}
+		
+		//! @brief 実行時サイズ版の行列積 Y = s*A*B (ACC = false), Y = s*A*B + beta*Y (ACC = true)
+		//! 動的サイズ行列(DynMatrix)用。内積方向と縦方向をブロックに分割してAのブロックをL2キャッシュに載せたまま，
+		//! 出力の MR_COLS 列分ずつレジスタタイルで計算する。YはAともBとも異なる領域であること
+		//! @param[in,out]	Y	出力行列 (K列×M行)
+		//! @param[in]	A	左側の行列 (N列×M行)
+		//! @param[in]	B	右側の行列 (K列×N行)
+		//! @param[in]	N	Aの列数 = Bの行数
+		//! @param[in]	M	Aの行数
+		//! @param[in]	K	Bの列数
+		//! @param[in]	s	行列積のスカラー係数
+		//! @param[in]	beta	出力行列のスカラー係数 (ACC = true のときのみ)
+		template <bool ACC, typename TT>
+		static void MatMulDynamic(TT* Y, const TT* A, const TT* B, const size_t N, const size_t M, const size_t K, const TT s, const TT beta){
+			MatMulDynamic<ACC>(Y, M, A, M, B, N, N, M, K, s, beta);
+		}
+		
+		//! @brief 実行時サイズ版の行列積 (部分行列版，列の先頭どうしの間隔を指定する)
+		//! 各要素の積和の順序は出力の列の分け方に依らないので，出力を列ごとに分けて並列に計算しても結果は変わらない
+		//! @param[in,out]	Y	出力行列 (K列×M行)
+		//! @param[in]	ldy	Yの列の先頭どうしの間隔
+		//! @param[in]	A	左側の行列 (N列×M行)
+		//! @param[in]	lda	Aの列の先頭どうしの間隔
+		//! @param[in]	B	右側の行列 (K列×N行)
+		//! @param[in]	ldb	Bの列の先頭どうしの間隔
+		//! @param[in]	N	Aの列数 = Bの行数
+		//! @param[in]	M	Aの行数
+		//! @param[in]	K	Bの列数
+		//! @param[in]	s	行列積のスカラー係数
+		//! @param[in]	beta	出力行列のスカラー係数 (ACC = true のときのみ)
+		template <bool ACC, typename TT>
+		static void MatMulDynamic(TT* Y, const size_t ldy, const TT* A, const size_t lda, const TT* B, const size_t ldb, const size_t N, const size_t M, const size_t K, const TT s, const TT beta){
+			static_assert(MR_COLS == 4, "Column tail dispatch assumes MR_COLS == 4");
+			constexpr size_t KC = KC_BYTES/sizeof(TT);							// 内積方向のブロックの長さ
+			constexpr size_t MR = MR_REGS*SIMDregister<TT>::LANE;				// タイルの行数
+			constexpr size_t MC = std::max(MC_BYTES/KC_BYTES/MR, (size_t)1)*MR;	// 縦方向のブロックの長さ
+			for(size_t i0 = 0; i0 < N; i0 += KC){
+				const size_t i1 = std::min(i0 + KC, N);
+				for(size_t j0 = 0; j0 < M; j0 += MC){
+					const size_t j1 = std::min(j0 + MC, M);
+					size_t k = 0;
+					for(; k + MR_COLS <= K; k += MR_COLS) MatMulDynamicPanel<MR_COLS,ACC>(Y, ldy, A, lda, B, ldb, k, j0, j1, i0, i1, s, beta);
+					switch(K - k){
+						case 3: MatMulDynamicPanel<3,ACC>(Y, ldy, A, lda, B, ldb, k, j0, j1, i0, i1, s, beta); break;
+						case 2: MatMulDynamicPanel<2,ACC>(Y, ldy, A, lda, B, ldb, k, j0, j1, i0, i1, s, beta); break;
+						case 1: MatMulDynamicPanel<1,ACC>(Y, ldy, A, lda, B, ldb, k, j0, j1, i0, i1, s, beta); break;
+						default: break;
+					}
+				}
+			}
+		}
+		
+		//! @brief 転置 Y = A^T
+		//! YはAとは異なる領域であること
+		//! @tparam	N	Aの列数
+		//! @tparam	M	Aの行数
+		//! @param[out]	Y	出力行列 (M列×N行)
+		//! @param[in]	A	入力行列 (N列×M行)
+		template <size_t N, size_t M, typename TT>
+		static void Transpose(TT* Y, const TT* A){
+			constexpr size_t N4 = N/4*4;	// 4×4のブロックに収まる列数
+			constexpr size_t M4 = M/4*4;	// 4×4のブロックに収まる行数
+			// 4×4のブロックごとにレジスタ内で転置
+			for(size_t i = 0; i < N4; i += 4){
+				for(size_t j = 0; j < M4; j += 4) Transpose4x4(Y + j*N + i, A + i*M + j, N, M);
+				for(size_t j = M4; j < M; ++j){
+					for(size_t l = i; l < i + 4; ++l) Y[j*N + l] = A[l*M + j];
+				}
+			}
+			// 端数の列
+			for(size_t i = N4; i < N; ++i){
+				for(size_t j = 0; j < M; ++j) Y[j*N + i] = A[i*M + j];
+			}
+		}
+	
+	private:
+		//! @brief 行列積のカーネル Y = s*A*op(B) (ACC = false), Y = s*A*op(B) + beta*Y (ACC = true)
+		//! op(B) は BT = false のとき B (K列×N行)，BT = true のとき B^T (BはN列×K行)
+		//! 端数の行はマスク付きストアにすると直後の読み込みでストアフォワーディングが効かなくなるので，普通のFMAで計算する
+		template <size_t N, size_t M, size_t K, bool ACC, bool BT, typename TT>
+		static void MatMulKernel(TT* Y, const TT* A, const TT* B, const TT s, const TT beta){
+			using R = SIMDregister<TT>;
+			constexpr size_t L = R::LANE;
+			constexpr size_t NR = M/L;			// 1列あたりのレジスタ数
+			constexpr size_t BI = BT ? K : 1;	// 右側行列の縦方向の要素の間隔
+			constexpr size_t BK = BT ? 1 : N;	// 右側行列の横方向の要素の間隔
+			if constexpr(4 < NR){
+				// 大きい行列のときはキャッシュとレジスタの再利用を考慮したブロック版
+				size_t k = 0;
+				for(; k + MR_COLS <= K; k += MR_COLS) MatMulPanel<N,M,K,MR_COLS,ACC,BT>(Y, A, B, s, beta, k);
+				if constexpr(K % MR_COLS != 0) MatMulPanel<N,M,K,K % MR_COLS,ACC,BT>(Y, A, B, s, beta, k);
+				return;
+			}
+			constexpr size_t MT = M - NR*L;		// 端数の行数
+			[[maybe_unused]] const auto betav = R::set1(beta);
+			for(size_t k = 0; k < K; ++k){
+				const TT* b = B + k*BK;	// 右側行列のk列目
+				TT* y = Y + k*M;		// 出力行列のk列目
+				// 小さい行列のときは出力の1列分をすべてレジスタに載せて1回で計算
+				// 端数の行も同じループの中で別々の積和として計算し，出力への書き込みは最後にまとめて行う
+				// (端数の行ごとに書き込むと，出力と入力が重なり得るので行ごとの積和が直列に実行されてしまう)
+				typename R::reg acc[NR == 0 ? 1 : NR];
+				TT tail[MT == 0 ? 1 : MT];
+				#pragma GCC unroll 8
+				for(size_t r = 0; r < NR; ++r) acc[r] = R::zero();
+				#pragma GCC unroll 8
+				for(size_t j = 0; j < MT; ++j) tail[j] = 0;
+				for(size_t i = 0; i < N; ++i){
+					const TT* a = A + i*M;
+					const TT bs = s*b[i*BI];
+					[[maybe_unused]] const auto bi = R::set1(bs);
+					#pragma GCC unroll 8
+					for(size_t r = 0; r < NR; ++r) acc[r] = R::fmadd(R::load(a + r*L), bi, acc[r]);
+					#pragma GCC unroll 8
+					for(size_t j = 0; j < MT; ++j) tail[j] = std::fma(a[NR*L + j], bs, tail[j]);	// 端数は普通のFMAで計算
+				}
+				#pragma GCC unroll 8
+				for(size_t r = 0; r < NR; ++r) R::store(y + r*L, ACC ? R::fmadd(betav, R::load(y + r*L), acc[r]) : acc[r]);
+				#pragma GCC unroll 8
+				for(size_t j = 0; j < MT; ++j) y[NR*L + j] = ACC ? std::fma(beta, y[NR*L + j], tail[j]) : tail[j];
+			}
+		}
+		
+		static constexpr size_t MR_COLS = 4;		//!< ブロック版の行列積で同時に計算する出力の列数
+		static constexpr size_t MR_REGS = 3;		//!< ブロック版の行列積で同時に計算する1列あたりのレジスタ数
+		static constexpr size_t KC_BYTES = 2048;	//!< ブロック版の行列積で内積方向に分割するブロックのAの1行分のバイト数
+		static constexpr size_t MC_BYTES = 262144;	//!< 実行時サイズ版の行列積でL2キャッシュに載せるAのブロックのバイト数
+		
+		//! @brief 大きい行列の行列積のカーネル (出力のk列目からC列分)
+		//! 出力のC列分とBのブロックをL1キャッシュに載せたまま，Aのブロックを縦方向に流す。
+		//! 出力はレジスタ MR_REGS×C 個のタイルごとに計算し，Aの読み込み1回をC列分の積和に使う。
+		//! 内積方向がブロック1個に収まる大きさまでは，各要素の積和の順序は MatMulKernel の単純なループと同じ。
+		template <size_t N, size_t M, size_t K, size_t C, bool ACC, bool BT, typename TT>
+		static void MatMulPanel(TT* Y, const TT* A, const TT* B, const TT s, const TT beta, const size_t k){
+			constexpr size_t KC = KC_BYTES/sizeof(TT);		// 内積方向のブロックの長さ
+			constexpr size_t BI = BT ? K : 1;				// 右側行列の縦方向の要素の間隔
+			constexpr size_t BK = BT ? 1 : N;				// 右側行列の横方向の要素の間隔
+			const TT* b[C];	// 右側行列の列の先頭
+			TT* y[C];		// 出力行列の列の先頭
+			for(size_t c = 0; c < C; ++c){
+				b[c] = B + (k + c)*BK;
+				y[c] = Y + (k + c)*M;
+			}
+			for(size_t i0 = 0; i0 < N; i0 += KC){
+				MatMulColumns<C,ACC,BI>(y, A, M, b, 0, M, i0, std::min(i0 + KC, N), s, beta, i0 == 0);
+			}
+		}
+		
+		//! @brief 実行時サイズ版の行列積で出力のk列目からC列分を計算する関数
+		template <size_t C, bool ACC, typename TT>
+		static void MatMulDynamicPanel(TT* Y, const size_t ldy, const TT* A, const size_t lda, const TT* B, const size_t ldb, const size_t k, const size_t j0, const size_t j1, const size_t i0, const size_t i1, const TT s, const TT beta){
+			const TT* b[C];	// 右側行列の列の先頭
+			TT* y[C];		// 出力行列の列の先頭
+			for(size_t c = 0; c < C; ++c){
+				b[c] = B + (k + c)*ldb;
+				y[c] = Y + (k + c)*ldy;
+			}
+			MatMulColumns<C,ACC,1>(y, A, lda, b, j0, j1, i0, i1, s, beta, i0 == 0);
+		}
+		
+		//! @brief 大きい行列の行列積で，出力のC列分のj0行目からj1行目の手前までに，Aのi0列目からi1列目の手前までの積和を計算する関数
+		//! first = true のときは出力に代入(ACC = true のときは beta倍して加算)，false のときは出力に累積加算する
+		template <size_t C, bool ACC, size_t BI, typename TT>
+		static void MatMulColumns(TT* const* y, const TT* A, const size_t lda, const TT* const* b, const size_t j0, const size_t j1, const size_t i0, const size_t i1, const TT s, const TT beta, const bool first){
+			using R = SIMDregister<TT>;
+			constexpr size_t L = R::LANE;
+			constexpr size_t MR = MR_REGS*L;				// タイルの行数
+			size_t j = j0;
+			for(; j + MR <= j1; j += MR) MatMulTile<MR_REGS,C,ACC,BI>(y, j, A, lda, b, i0, i1, s, beta, first);
+			for(; j + L <= j1; j += L) MatMulTile<1,C,ACC,BI>(y, j, A, lda, b, i0, i1, s, beta, first);
+			// 端数の行
+			for(j = j0 + (j1 - j0)/L*L; j < j1; ++j){
+				for(size_t c = 0; c < C; ++c){
+					TT t = 0;
+					for(size_t i = i0; i < i1; ++i) t = std::fma(A[i*lda + j], s*b[c][i*BI], t);
+					if(!first){
+						y[c][j] += t;
+					}else{
+						y[c][j] = ACC ? std::fma(beta, y[c][j], t) : t;
+					}
+				}
+			}
+		}
+		
+		//! @brief 大きい行列の行列積のタイル計算 (出力のj行目からRN個のレジスタ分×C列分)
+		template <size_t RN, size_t C, bool ACC, size_t BI, typename TT>
+		static void MatMulTile(TT* const* y, const size_t j, const TT* A, const size_t lda, const TT* const* b, const size_t i0, const size_t i1, const TT s, const TT beta, const bool first){
+			using R = SIMDregister<TT>;
+			constexpr size_t L = R::LANE;
+			typename R::reg acc[RN][C];
+			#pragma GCC unroll 8
+			for(size_t r = 0; r < RN; ++r){
+				#pragma GCC unroll 8
+				for(size_t c = 0; c < C; ++c) acc[r][c] = R::zero();
+			}
+			for(size_t i = i0; i < i1; ++i){
+				const TT* a = A + i*lda + j;
+				typename R::reg av[RN];
+				#pragma GCC unroll 8
+				for(size_t r = 0; r < RN; ++r) av[r] = R::load(a + r*L);
+				#pragma GCC unroll 8
+				for(size_t c = 0; c < C; ++c){
+					const auto bc = R::set1(s*b[c][i*BI]);
+					#pragma GCC unroll 8
+					for(size_t r = 0; r < RN; ++r) acc[r][c] = R::fmadd(av[r], bc, acc[r][c]);
+				}
+			}
+			const auto betav = R::set1(beta);
+			#pragma GCC unroll 8
+			for(size_t c = 0; c < C; ++c){
+				#pragma GCC unroll 8
+				for(size_t r = 0; r < RN; ++r){
+					TT* p = y[c] + j + r*L;
+					if(!first){
+						R::store(p, R::add(R::load(p), acc[r][c]));		// 2個目以降のブロックは累積加算
+					}else{
+						R::store(p, ACC ? R::fmadd(betav, R::load(p), acc[r][c]) : acc[r][c]);
+					}
+				}
+			}
+		}
+		
+		MatrixSIMD() = delete;					//!< コンストラクタ使用禁止
+		MatrixSIMD(MatrixSIMD&& r) = delete;	//!< ムーブコンストラクタ使用禁止
+		~MatrixSIMD() = delete;					//!< デストラクタ使用禁止
+		MatrixSIMD(const MatrixSIMD&) = delete;	//!< コピーコンストラクタ使用禁止
+		const MatrixSIMD& operator=(const MatrixSIMD&) = delete;	//!< 代入演算子使用禁止
+		
+		#ifdef ARCS_MATRIX_SIMD_AVX2
+		//! @brief 4×4ブロックの転置(double型版)
+		//! @param[out]	Y	出力ブロックの先頭 (列の間隔 N)
+		//! @param[in]	A	入力ブロックの先頭 (列の間隔 M)
+		static void Transpose4x4(double* Y, const double* A, const size_t N, const size_t M){
+			const __m256d c0 = _mm256_loadu_pd(A      );
+			const __m256d c1 = _mm256_loadu_pd(A +   M);
+			const __m256d c2 = _mm256_loadu_pd(A + 2*M);
+			const __m256d c3 = _mm256_loadu_pd(A + 3*M);
+			const __m256d t0 = _mm256_unpacklo_pd(c0, c1);	// a00 a10 a02 a12
+			const __m256d t1 = _mm256_unpackhi_pd(c0, c1);	// a01 a11 a03 a13
+			const __m256d t2 = _mm256_unpacklo_pd(c2, c3);	// a20 a30 a22 a32
+			const __m256d t3 = _mm256_unpackhi_pd(c2, c3);	// a21 a31 a23 a33
+			_mm256_storeu_pd(Y      , _mm256_permute2f128_pd(t0, t2, 0x20));
+			_mm256_storeu_pd(Y +   N, _mm256_permute2f128_pd(t1, t3, 0x20));
+			_mm256_storeu_pd(Y + 2*N, _mm256_permute2f128_pd(t0, t2, 0x31));
+			_mm256_storeu_pd(Y + 3*N, _mm256_permute2f128_pd(t1, t3, 0x31));
+		}
+		
+		//! @brief 4×4ブロックの転置(float型版)
+		//! @param[out]	Y	出力ブロックの先頭 (列の間隔 N)
+		//! @param[in]	A	入力ブロックの先頭 (列の間隔 M)
+		static void Transpose4x4(float* Y, const float* A, const size_t N, const size_t M){
+			__m128 c0 = _mm_loadu_ps(A      );
+			__m128 c1 = _mm_loadu_ps(A +   M);
+			__m128 c2 = _mm_loadu_ps(A + 2*M);
+			__m128 c3 = _mm_loadu_ps(A + 3*M);
+			_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+			_mm_storeu_ps(Y      , c0);
+			_mm_storeu_ps(Y +   N, c1);
+			_mm_storeu_ps(Y + 2*N, c2);
+			_mm_storeu_ps(Y + 3*N, c3);
+		}
+		#endif
+};
+}
+
+#endif
+
@@ -0,0 +1,711 @@
+//! @file MatrixStructured.hh
+//! @brief 構造化行列クラス(テンプレート版)
+//!
+//! 対角行列，上/下三角行列，対称行列，コンパニオン行列，帯行列を零要素を持たずに格納して，
+//! 行列とベクトルの積や連立方程式の求解を構造に応じた少ない計算量で行うクラス。
+//! 密行列(Matrix)の構造を判定する関数と，密行列の格納のまま帯の中だけを計算する行列積の関数も含む。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・n次の正方行列とベクトルの積の計算量は，密行列が n^2，対角行列が n，三角行列と対称行列が約 n^2/2，
+//   コンパニオン行列が 2n，帯行列(下側帯幅KL，上側帯幅KU)が n*(KL+KU+1) になる。
+// ・求解の計算量は，対角行列とコンパニオン行列が n，三角行列が約 n^2/2，帯行列が約 n*KL*(KL+KU) になる。
+// ・コンパニオン行列は TransferFunction の可制御正準形と同じく，上側の副対角がすべて1で最下行に係数が並ぶ形である。
+// ・各クラスは ToMatrix で密行列に戻せる。すべての関数は定数式として評価できる。
+
+#ifndef MATRIXSTRUCTURED
+#define MATRIXSTRUCTURED
+
+#include <cmath>
+#include <cassert>
+#include <array>
+#include <algorithm>
+#include "Matrix.hh"
+#include "MatrixDecomposition.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 行列の構造の定義
+enum class MatrixStructure {
+	DENSE,		//!< 密行列
+	DIAGONAL,	//!< 対角行列
+	UPPER_TRI,	//!< 上三角行列
+	LOWER_TRI,	//!< 下三角行列
+	BANDED,		//!< 帯行列
+	COMPANION	//!< コンパニオン行列
+};
+
+//! @brief 正方行列の下側帯幅と上側帯幅を返す関数 (対角から最も離れた非零要素までの距離)
+//! @param[in]	A	正方行列
+//! @param[out]	KL	下側帯幅
+//! @param[out]	KU	上側帯幅
+template <size_t N, typename TT>
+constexpr void GetBandwidth(const Matrix<N,N,TT>& A, size_t& KL, size_t& KU){
+	KL = 0;
+	KU = 0;
+	for(size_t j = 0; j < N; ++j){
+		for(size_t i = 0; i < N; ++i){
+			if(A.Data[j][i] == (TT)0) continue;
+			if(j < i) KL = std::max(KL, i - j);
+			if(i < j) KU = std::max(KU, j - i);
+		}
+	}
+}
+
+//! @brief コンパニオン行列(上側の副対角がすべて1，最下行が係数，他は零)かを返す関数
+//! @param[in]	A	正方行列
+//! @return	true = コンパニオン行列，false = それ以外
+template <size_t N, typename TT>
+constexpr bool IsCompanion(const Matrix<N,N,TT>& A){
+	if(N < 2) return false;
+	for(size_t j = 0; j < N; ++j){
+		for(size_t i = 0; i + 1 < N; ++i){
+			if(A.Data[j][i] != (j == i + 1 ? (TT)1 : (TT)0)) return false;
+		}
+	}
+	return true;
+}
+
+//! @brief 正方行列の構造を判定する関数
+//! 帯行列は，帯の外の要素が半分以上零で，密行列の積よりも計算量が減る場合だけ BANDED と判定する。
+//! @param[in]	A	正方行列
+//! @return	行列の構造
+template <size_t N, typename TT>
+constexpr MatrixStructure DetectStructure(const Matrix<N,N,TT>& A){
+	size_t KL = 0, KU = 0;
+	GetBandwidth(A, KL, KU);
+	if(KL == 0 && KU == 0) return MatrixStructure::DIAGONAL;
+	if(IsCompanion(A)) return MatrixStructure::COMPANION;
+	if(KL == 0) return MatrixStructure::UPPER_TRI;
+	if(KU == 0) return MatrixStructure::LOWER_TRI;
+	if(2*(KL + KU + 1) <= N) return MatrixStructure::BANDED;
+	return MatrixStructure::DENSE;
+}
+
+//! @brief 密行列の格納のまま帯の中だけで行列積を計算する関数 Y = A*X
+//! 対角行列(KL = KU = 0)，上三角行列(KL = 0, KU = N - 1)，下三角行列(KL = N - 1, KU = 0)にも使える。(YはXと異なる行列であること)
+//! @param[out]	Y	出力行列
+//! @param[in]	A	正方行列 (帯の外の要素は読まない)
+//! @param[in]	X	右側の行列
+//! @param[in]	KL	下側帯幅
+//! @param[in]	KU	上側帯幅
+template <size_t N, size_t K, typename TT>
+constexpr void mul_band_into(Matrix<K,N,TT>& Y, const Matrix<N,N,TT>& A, const Matrix<K,N,TT>& X, const size_t KL, const size_t KU){
+	for(size_t k = 0; k < K; ++k){
+		for(size_t i = 0; i < N; ++i) Y.Data[k][i] = 0;
+		for(size_t j = 0; j < N; ++j){
+			// A の j列目の帯の中の行 [j - KU, j + KL] だけを足し込む
+			const TT xj = X.Data[k][j];
+			const size_t ibgn = (KU < j) ? j - KU : 0;
+			const size_t iend = std::min(N, j + KL + 1);
+			for(size_t i = ibgn; i < iend; ++i) Y.Data[k][i] += A.Data[j][i]*xj;
+		}
+	}
+}
+
+//! @brief 対角行列クラス
+//! @tparam	N	行列のサイズ
+//! @tparam	TT	データ型(デフォルトはdouble型)
+template <size_t N, typename TT = double>
+class DiagonalMatrix {
+	public:
+		//! @brief コンストラクタ(零行列)
+		constexpr DiagonalMatrix()
+			: d()
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(密行列の対角要素から)
+		//! @param[in]	A	正方行列 (対角以外は無視する)
+		constexpr explicit DiagonalMatrix(const Matrix<N,N,TT>& A)
+			: d()
+		{
+			for(size_t i = 0; i < N; ++i) d.Data[0][i] = A.Data[i][i];
+		}
+		
+		//! @brief 対角要素の縦ベクトルから対角行列を作る関数
+		//! @param[in]	diag	対角要素の縦ベクトル
+		//! @return	対角行列
+		static constexpr DiagonalMatrix FromDiag(const Matrix<1,N,TT>& diag){
+			DiagonalMatrix D;
+			D.d = diag;
+			return D;
+		}
+		
+		//! @brief 対角要素の縦ベクトルを返す関数
+		//! @return	対角要素
+		constexpr Matrix<1,N,TT> GetDiag(void) const {
+			return d;
+		}
+		
+		//! @brief 密行列に戻す関数
+		//! @return	密行列
+		constexpr Matrix<N,N,TT> ToMatrix(void) const {
+			Matrix<N,N,TT> A;
+			for(size_t i = 0; i < N; ++i) A.Data[i][i] = d.Data[0][i];
+			return A;
+		}
+		
+		//! @brief 行列積を出力先に直接書き込む関数 Y = D*X
+		//! @param[out]	Y	出力行列
+		//! @param[in]	D	対角行列
+		//! @param[in]	X	右側の行列
+		template <size_t K>
+		constexpr friend void mul_into(Matrix<K,N,TT>& Y, const DiagonalMatrix& D, const Matrix<K,N,TT>& X){
+			for(size_t k = 0; k < K; ++k){
+				for(size_t i = 0; i < N; ++i) Y.Data[k][i] = D.d.Data[0][i]*X.Data[k][i];
+			}
+		}
+		
+		//! @brief 行列積演算子 D*X
+		//! @param[in]	D	対角行列
+		//! @param[in]	X	右側の行列
+		//! @return	結果
+		template <size_t K>
+		constexpr friend Matrix<K,N,TT> operator*(const DiagonalMatrix& D, const Matrix<K,N,TT>& X){
+			Matrix<K,N,TT> Y;
+			mul_into(Y, D, X);
+			return Y;
+		}
+		
+		//! @brief D*X = B を X について解く関数
+		//! @param[in]	D	対角行列
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <size_t K>
+		constexpr friend Matrix<K,N,TT> solve(const DiagonalMatrix& D, const Matrix<K,N,TT>& B){
+			Matrix<K,N,TT> X;
+			for(size_t k = 0; k < K; ++k){
+				for(size_t i = 0; i < N; ++i) X.Data[k][i] = B.Data[k][i]/D.d.Data[0][i];
+			}
+			return X;
+		}
+		
+		//! @brief 逆行列を返す関数
+		//! @param[in]	D	対角行列
+		//! @return	逆行列
+		constexpr friend DiagonalMatrix inv(const DiagonalMatrix& D){
+			DiagonalMatrix Y;
+			for(size_t i = 0; i < N; ++i) Y.d.Data[0][i] = (TT)1/D.d.Data[0][i];
+			return Y;
+		}
+		
+		//! @brief 行列式を返す関数
+		//! @param[in]	D	対角行列
+		//! @return	行列式
+		constexpr friend TT det(const DiagonalMatrix& D){
+			TT ret = 1;
+			for(size_t i = 0; i < N; ++i) ret *= D.d.Data[0][i];
+			return ret;
+		}
+	
+	private:
+		Matrix<1,N,TT> d;	//!< 対角要素
+};
+
+//! @brief 三角行列クラス
+//! @tparam	N	行列のサイズ
+//! @tparam	UPPER	true = 上三角行列，false = 下三角行列
+//! @tparam	TT	データ型(デフォルトはdouble型)
+template <size_t N, bool UPPER, typename TT = double>
+class TriangularMatrix {
+	public:
+		//! @brief コンストラクタ(零行列)
+		constexpr TriangularMatrix()
+			: T()
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(密行列の三角部分から)
+		//! @param[in]	A	正方行列 (三角部分の外は無視する)
+		constexpr explicit TriangularMatrix(const Matrix<N,N,TT>& A)
+			: T()
+		{
+			for(size_t j = 0; j < N; ++j){
+				for(size_t i = RowBegin(j); i < RowEnd(j); ++i) T.Data[j][i] = A.Data[j][i];
+			}
+		}
+		
+		//! @brief 密行列に戻す関数
+		//! @return	密行列
+		constexpr Matrix<N,N,TT> ToMatrix(void) const {
+			return T;
+		}
+		
+		//! @brief 行列積を出力先に直接書き込む関数 Y = T*X
+		//! @param[out]	Y	出力行列
+		//! @param[in]	U	三角行列
+		//! @param[in]	X	右側の行列
+		template <size_t K>
+		constexpr friend void mul_into(Matrix<K,N,TT>& Y, const TriangularMatrix& U, const Matrix<K,N,TT>& X){
+			for(size_t k = 0; k < K; ++k){
+				for(size_t i = 0; i < N; ++i) Y.Data[k][i] = 0;
+				for(size_t j = 0; j < N; ++j){
+					const TT xj = X.Data[k][j];
+					for(size_t i = RowBegin(j); i < RowEnd(j); ++i) Y.Data[k][i] += U.T.Data[j][i]*xj;
+				}
+			}
+		}
+		
+		//! @brief 行列積演算子 T*X
+		//! @param[in]	U	三角行列
+		//! @param[in]	X	右側の行列
+		//! @return	結果
+		template <size_t K>
+		constexpr friend Matrix<K,N,TT> operator*(const TriangularMatrix& U, const Matrix<K,N,TT>& X){
+			Matrix<K,N,TT> Y;
+			mul_into(Y, U, X);
+			return Y;
+		}
+		
+		//! @brief T*X = B を X について解く関数 (上三角は後退代入，下三角は前進代入)
+		//! @param[in]	U	三角行列
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <size_t K>
+		constexpr friend Matrix<K,N,TT> solve(const TriangularMatrix& U, const Matrix<K,N,TT>& B){
+			Matrix<K,N,TT> X = B;
+			for(size_t k = 0; k < K; ++k){
+				if constexpr(UPPER){
+					for(size_t j = N; 0 < j; --j){
+						X.Data[k][j-1] /= U.T.Data[j-1][j-1];
+						for(size_t i = 0; i < j - 1; ++i) X.Data[k][i] -= U.T.Data[j-1][i]*X.Data[k][j-1];
+					}
+				}else{
+					for(size_t j = 0; j < N; ++j){
+						X.Data[k][j] /= U.T.Data[j][j];
+						for(size_t i = j + 1; i < N; ++i) X.Data[k][i] -= U.T.Data[j][i]*X.Data[k][j];
+					}
+				}
+			}
+			return X;
+		}
+		
+		//! @brief 逆行列を返す関数 (三角行列の逆行列は同じ向きの三角行列)
+		//! @param[in]	U	三角行列
+		//! @return	逆行列
+		constexpr friend TriangularMatrix inv(const TriangularMatrix& U){
+			TriangularMatrix Y;
+			if constexpr(UPPER){
+				inv_upper_tri(U.T, Y.T);
+			}else{
+				// L^(-1) = (L^T)^(-1)^T
+				const Matrix<N,N,TT> Lt = tp(U.T);
+				Matrix<N,N,TT> Ltinv;
+				inv_upper_tri(Lt, Ltinv);
+				Y.T = tp(Ltinv);
+			}
+			return Y;
+		}
+		
+		//! @brief 行列式を返す関数
+		//! @param[in]	U	三角行列
+		//! @return	行列式
+		constexpr friend TT det(const TriangularMatrix& U){
+			TT ret = 1;
+			for(size_t i = 0; i < N; ++i) ret *= U.T.Data[i][i];
+			return ret;
+		}
+	
+	private:
+		Matrix<N,N,TT> T;	//!< 三角行列 (三角部分の外は常に零)
+		
+		//! @brief j列目の三角部分の最初の行を返す関数
+		static constexpr size_t RowBegin(const size_t j){
+			return UPPER ? 0 : j;
+		}
+		
+		//! @brief j列目の三角部分の最後の行の次を返す関数
+		static constexpr size_t RowEnd(const size_t j){
+			return UPPER ? j + 1 : N;
+		}
+};
+
+//! @brief 上三角行列クラス
+template <size_t N, typename TT = double>
+using UpperTriMatrix = TriangularMatrix<N, true, TT>;
+
+//! @brief 下三角行列クラス
+template <size_t N, typename TT = double>
+using LowerTriMatrix = TriangularMatrix<N, false, TT>;
+
+//! @brief 対称行列クラス
+//! 下三角部分だけを列ごとに詰めて格納する。
+//! @tparam	N	行列のサイズ
+//! @tparam	TT	データ型(デフォルトはdouble型)
+template <size_t N, typename TT = double>
+class SymmetricMatrix {
+	public:
+		//! @brief コンストラクタ(零行列)
+		constexpr SymmetricMatrix()
+			: S()
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(密行列の下三角部分から)
+		//! @param[in]	A	対称行列 (上三角部分は無視する)
+		constexpr explicit SymmetricMatrix(const Matrix<N,N,TT>& A)
+			: S()
+		{
+			for(size_t j = 0; j < N; ++j){
+				for(size_t i = j; i < N; ++i) S[Index(i,j)] = A.Data[j][i];
+			}
+		}
+		
+		//! @brief 密行列に戻す関数
+		//! @return	密行列
+		constexpr Matrix<N,N,TT> ToMatrix(void) const {
+			Matrix<N,N,TT> A;
+			for(size_t j = 0; j < N; ++j){
+				for(size_t i = j; i < N; ++i){
+					A.Data[j][i] = S[Index(i,j)];
+					A.Data[i][j] = S[Index(i,j)];
+				}
+			}
+			return A;
+		}
+		
+		//! @brief 行列積を出力先に直接書き込む関数 Y = S*X
+		//! 格納している下三角部分を，そのままの向きと転置の向きの両方で1回ずつ使う。
+		//! @param[out]	Y	出力行列
+		//! @param[in]	A	対称行列
+		//! @param[in]	X	右側の行列
+		template <size_t K>
+		constexpr friend void mul_into(Matrix<K,N,TT>& Y, const SymmetricMatrix& A, const Matrix<K,N,TT>& X){
+			for(size_t k = 0; k < K; ++k){
+				for(size_t i = 0; i < N; ++i) Y.Data[k][i] = 0;
+				for(size_t j = 0; j < N; ++j){
+					const TT xj = X.Data[k][j];
+					const size_t c = Index(j,j);
+					TT yj = A.S[c]*xj;
+					for(size_t i = j + 1; i < N; ++i){
+						const TT aij = A.S[c + i - j];
+						Y.Data[k][i] += aij*xj;
+						yj += aij*X.Data[k][i];
+					}
+					Y.Data[k][j] += yj;
+				}
+			}
+		}
+		
+		//! @brief 行列積演算子 S*X
+		//! @param[in]	A	対称行列
+		//! @param[in]	X	右側の行列
+		//! @return	結果
+		template <size_t K>
+		constexpr friend Matrix<K,N,TT> operator*(const SymmetricMatrix& A, const Matrix<K,N,TT>& X){
+			Matrix<K,N,TT> Y;
+			mul_into(Y, A, X);
+			return Y;
+		}
+		
+		//! @brief S*X = B を X について解く関数 (修正コレスキー分解 LDL^T を使う)
+		//! @param[in]	A	対称行列
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <size_t K>
+		constexpr friend Matrix<K,N,TT> solve(const SymmetricMatrix& A, const Matrix<K,N,TT>& B){
+			return LDLDecomposition<N,TT>(A.ToMatrix()).solve(B);
+		}
+		
+		//! @brief 行列式を返す関数
+		//! @param[in]	A	対称行列
+		//! @return	行列式
+		constexpr friend TT det(const SymmetricMatrix& A){
+			return LDLDecomposition<N,TT>(A.ToMatrix()).det();
+		}
+	
+	private:
+		std::array<TT, N*(N + 1)/2> S;	//!< 下三角部分を列ごとに詰めた配列
+		
+		//! @brief i行j列(i ≧ j, 0始まり)の要素の格納位置を返す関数
+		static constexpr size_t Index(const size_t i, const size_t j){
+			return j*N - j*(j - 1)/2 + i - j;
+		}
+};
+
+//! @brief コンパニオン行列クラス
+//! 上側の副対角がすべて1で，最下行に係数 r1 … rN が並ぶ行列 (伝達関数の可制御正準形のA行列)。
+//! @tparam	N	行列のサイズ
+//! @tparam	TT	データ型(デフォルトはdouble型)
+template <size_t N, typename TT = double>
+class CompanionMatrix {
+	public:
+		//! @brief コンストラクタ(最下行が零)
+		constexpr CompanionMatrix()
+			: r()
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(密行列から)
+		//! @param[in]	A	コンパニオン行列 (最下行だけを読む)
+		constexpr explicit CompanionMatrix(const Matrix<N,N,TT>& A)
+			: r()
+		{
+			for(size_t j = 0; j < N; ++j) r.Data[0][j] = A.Data[j][N-1];
+		}
+		
+		//! @brief 最下行の縦ベクトルからコンパニオン行列を作る関数
+		//! @param[in]	LastRow	最下行の要素を並べた縦ベクトル
+		//! @return	コンパニオン行列
+		static constexpr CompanionMatrix FromLastRow(const Matrix<1,N,TT>& LastRow){
+			CompanionMatrix C;
+			C.r = LastRow;
+			return C;
+		}
+		
+		//! @brief 多項式の係数からコンパニオン行列を作る関数
+		//! @param[in]	Den	多項式の係数ベクトル 例：(s^2 + a1*s + a0) のとき Matrix<1,3> Den = {1, a1, a0}
+		//! @return	コンパニオン行列
+		static constexpr CompanionMatrix FromPolynomial(const Matrix<1,N+1,TT>& Den){
+			CompanionMatrix C;
+			for(size_t j = 0; j < N; ++j) C.r.Data[0][j] = -Den.Data[0][N-j]/Den.Data[0][0];
+			return C;
+		}
+		
+		//! @brief 最下行の縦ベクトルを返す関数
+		//! @return	最下行の要素
+		constexpr Matrix<1,N,TT> GetLastRow(void) const {
+			return r;
+		}
+		
+		//! @brief 密行列に戻す関数
+		//! @return	密行列
+		constexpr Matrix<N,N,TT> ToMatrix(void) const {
+			Matrix<N,N,TT> A;
+			for(size_t i = 0; i + 1 < N; ++i) A.Data[i+1][i] = 1;
+			for(size_t j = 0; j < N; ++j) A.Data[j][N-1] = r.Data[0][j];
+			return A;
+		}
+		
+		//! @brief 行列積を出力先に直接書き込む関数 Y = C*X
+		//! @param[out]	Y	出力行列
+		//! @param[in]	C	コンパニオン行列
+		//! @param[in]	X	右側の行列
+		template <size_t K>
+		constexpr friend void mul_into(Matrix<K,N,TT>& Y, const CompanionMatrix& C, const Matrix<K,N,TT>& X){
+			for(size_t k = 0; k < K; ++k){
+				const TT y = C.dot_lastrow(X.Data[k]);
+				for(size_t i = 0; i + 1 < N; ++i) Y.Data[k][i] = X.Data[k][i+1];	// 副対角の1はずらすだけ
+				Y.Data[k][N-1] = y;
+			}
+		}
+		
+		//! @brief 行列積演算子 C*X
+		//! @param[in]	C	コンパニオン行列
+		//! @param[in]	X	右側の行列
+		//! @return	結果
+		template <size_t K>
+		constexpr friend Matrix<K,N,TT> operator*(const CompanionMatrix& C, const Matrix<K,N,TT>& X){
+			Matrix<K,N,TT> Y;
+			mul_into(Y, C, X);
+			return Y;
+		}
+		
+		//! @brief C*X = B を X について解く関数
+		//! 1行目からN-1行目で x2 … xN がそのまま決まり，最下行から x1 が決まる。
+		//! @param[in]	C	コンパニオン行列
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <size_t K>
+		constexpr friend Matrix<K,N,TT> solve(const CompanionMatrix& C, const Matrix<K,N,TT>& B){
+			Matrix<K,N,TT> X;
+			for(size_t k = 0; k < K; ++k){
+				TT s = B.Data[k][N-1];
+				for(size_t i = 1; i < N; ++i){
+					X.Data[k][i] = B.Data[k][i-1];
+					s -= C.r.Data[0][i]*X.Data[k][i];
+				}
+				X.Data[k][0] = s/C.r.Data[0][0];
+			}
+			return X;
+		}
+		
+		//! @brief 行列式を返す関数
+		//! @param[in]	C	コンパニオン行列
+		//! @return	行列式
+		constexpr friend TT det(const CompanionMatrix& C){
+			return (N % 2 == 1 ? (TT)1 : (TT)(-1))*C.r.Data[0][0];
+		}
+		
+		//! @brief 最下行と列ベクトルの内積を返す関数
+		//! 加算の依存の連鎖が長くならないように，4つの部分和に分けて足し込む
+		//! @param[in]	x	列ベクトルの要素の配列
+		//! @return	内積
+		constexpr TT dot_lastrow(const std::array<TT, N>& x) const {
+			if constexpr(N < 4){
+				// 小さいときは部分和を使わずにそのまま足す (零の部分和を足す分の遅延をなくす)
+				TT y = r.Data[0][0]*x[0];
+				for(size_t i = 1; i < N; ++i) y += r.Data[0][i]*x[i];
+				return y;
+			}else{
+				std::array<TT, 4> y = {r.Data[0][0]*x[0], r.Data[0][1]*x[1], r.Data[0][2]*x[2], r.Data[0][3]*x[3]};
+				size_t i = 4;
+				for(; i + 4 <= N; i += 4){
+					for(size_t l = 0; l < 4; ++l) y[l] += r.Data[0][i + l]*x[i + l];
+				}
+				for(; i < N; ++i) y[0] += r.Data[0][i]*x[i];
+				return (y[0] + y[1]) + (y[2] + y[3]);
+			}
+		}
+	
+	private:
+		Matrix<1,N,TT> r;	//!< 最下行の要素
+};
+
+//! @brief 帯行列クラス
+//! LAPACKと同じ帯格納形式で，i行j列の要素を AB(KU + i - j, j) に格納する。
+//! @tparam	N	行列のサイズ
+//! @tparam	KL	下側帯幅
+//! @tparam	KU	上側帯幅
+//! @tparam	TT	データ型(デフォルトはdouble型)
+template <size_t N, size_t KL, size_t KU, typename TT = double>
+class BandedMatrix {
+	public:
+		//! @brief コンストラクタ(零行列)
+		constexpr BandedMatrix()
+			: AB()
+		{
+			
+		}
+		
+		//! @brief コンストラクタ(密行列の帯の中から)
+		//! @param[in]	A	正方行列 (帯の外は無視する)
+		constexpr explicit BandedMatrix(const Matrix<N,N,TT>& A)
+			: AB()
+		{
+			for(size_t j = 0; j < N; ++j){
+				for(size_t i = RowBegin(j); i < RowEnd(j); ++i) AB.Data[j][KU + i - j] = A.Data[j][i];
+			}
+		}
+		
+		//! @brief 密行列に戻す関数
+		//! @return	密行列
+		constexpr Matrix<N,N,TT> ToMatrix(void) const {
+			Matrix<N,N,TT> A;
+			for(size_t j = 0; j < N; ++j){
+				for(size_t i = RowBegin(j); i < RowEnd(j); ++i) A.Data[j][i] = AB.Data[j][KU + i - j];
+			}
+			return A;
+		}
+		
+		//! @brief 行列積を出力先に直接書き込む関数 Y = A*X
+		//! @param[out]	Y	出力行列
+		//! @param[in]	A	帯行列
+		//! @param[in]	X	右側の行列
+		template <size_t K>
+		constexpr friend void mul_into(Matrix<K,N,TT>& Y, const BandedMatrix& A, const Matrix<K,N,TT>& X){
+			for(size_t k = 0; k < K; ++k){
+				for(size_t i = 0; i < N; ++i) Y.Data[k][i] = 0;
+				for(size_t j = 0; j < N; ++j){
+					const TT xj = X.Data[k][j];
+					for(size_t i = RowBegin(j); i < RowEnd(j); ++i) Y.Data[k][i] += A.AB.Data[j][KU + i - j]*xj;
+				}
+			}
+		}
+		
+		//! @brief 行列積演算子 A*X
+		//! @param[in]	A	帯行列
+		//! @param[in]	X	右側の行列
+		//! @return	結果
+		template <size_t K>
+		constexpr friend Matrix<K,N,TT> operator*(const BandedMatrix& A, const Matrix<K,N,TT>& X){
+			Matrix<K,N,TT> Y;
+			mul_into(Y, A, X);
+			return Y;
+		}
+		
+		//! @brief A*X = B を X について解く関数 (部分ピボット選択付きの帯LU分解，LAPACKのgbsvと同じ手順)
+		//! 行の入れ替えで上側帯幅が KL+KU まで広がるので，その分を含めた作業領域で分解する。
+		//! @param[in]	A	帯行列
+		//! @param[in]	B	右辺
+		//! @return	解
+		template <size_t K>
+		constexpr friend Matrix<K,N,TT> solve(const BandedMatrix& A, const Matrix<K,N,TT>& B){
+			constexpr size_t KV = KL + KU;	// 分解後のUの上側帯幅
+			std::array<std::array<TT, 2*KL + KU + 1>, N> W = {};	// i行j列を W[j][KV + i - j] に格納
+			std::array<size_t, N> piv = {};
+			for(size_t j = 0; j < N; ++j){
+				for(size_t i = RowBegin(j); i < RowEnd(j); ++i) W[j][KV + i - j] = A.AB.Data[j][KU + i - j];
+			}
+			
+			// 帯LU分解
+			size_t ju = 0;	// 更新が及ぶ最後の列
+			for(size_t j = 0; j < N; ++j){
+				const size_t km = std::min(KL, N - 1 - j);
+				size_t p = 0;
+				for(size_t t = 1; t <= km; ++t){
+					if(std::abs(W[j][KV + p]) < std::abs(W[j][KV + t])) p = t;
+				}
+				piv[j] = j + p;
+				if(W[j][KV + p] == (TT)0) continue;	// 特異 (解は inf か nan になる)
+				ju = std::max(ju, std::min(j + KU + p, N - 1));
+				if(p != 0){
+					for(size_t c = j; c <= ju; ++c){
+						const TT w = W[c][KV + j - c];
+						W[c][KV + j - c] = W[c][KV + j + p - c];
+						W[c][KV + j + p - c] = w;
+					}
+				}
+				for(size_t t = 1; t <= km; ++t) W[j][KV + t] /= W[j][KV];
+				for(size_t c = j + 1; c <= ju; ++c){
+					const TT f = W[c][KV + j - c];
+					for(size_t t = 1; t <= km; ++t) W[c][KV + j + t - c] -= W[j][KV + t]*f;
+				}
+			}
+			
+			// 前進代入と後退代入
+			Matrix<K,N,TT> X = B;
+			for(size_t k = 0; k < K; ++k){
+				for(size_t j = 0; j < N; ++j){
+					const TT w = X.Data[k][piv[j]];
+					X.Data[k][piv[j]] = X.Data[k][j];
+					X.Data[k][j] = w;
+					const size_t km = std::min(KL, N - 1 - j);
+					for(size_t t = 1; t <= km; ++t) X.Data[k][j + t] -= W[j][KV + t]*w;
+				}
+				for(size_t j = N; 0 < j; --j){
+					X.Data[k][j-1] /= W[j-1][KV];
+					const size_t ibgn = (KV < j - 1) ? j - 1 - KV : 0;
+					for(size_t i = ibgn; i < j - 1; ++i) X.Data[k][i] -= W[j-1][KV + i - (j - 1)]*X.Data[k][j-1];
+				}
+			}
+			return X;
+		}
+	
+	private:
+		Matrix<N, KL + KU + 1, TT> AB;	//!< 帯格納形式の行列
+		
+		//! @brief j列目の帯の最初の行を返す関数
+		static constexpr size_t RowBegin(const size_t j){
+			return (KU < j) ? j - KU : 0;
+		}
+		
+		//! @brief j列目の帯の最後の行の次を返す関数
+		static constexpr size_t RowEnd(const size_t j){
+			return std::min(N, j + KL + 1);
+		}
+};
+}
+
+#endif
+
@@ -0,0 +1,184 @@
+//! @file MatrixThreadPool.cc
+//! @brief 行列計算用スレッドプール
+//!
+//! 動的サイズ行列(DynMatrix)の大きな行列積やLU分解，QR分解の更新処理を，列ごとに分けて複数のスレッドで並列に計算する。
+//! 範囲の分け方はスレッド数だけで決まる静的な分割なので，スレッド数が同じなら計算結果は毎回同じになる。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+
+#include <algorithm>
+#include "MatrixThreadPool.hh"
+
+using namespace ARCS;
+
+thread_local bool MatrixThreadPool::InParallel = false;	//!< 並列計算の中であるかどうか
+
+//! @brief コンストラクタ
+MatrixThreadPool::MatrixThreadPool()
+	: CallMutex(), SyncMutex(), StartCond(), DoneCond(), Workers(), Args(),
+	  NumThreads(1), Generation(0), Remaining(0), QuitFlag(false), JobFunc(nullptr), JobCount(0), JobRanges()
+{
+	pthread_mutex_init(&CallMutex, nullptr);	// Mutex初期化
+	pthread_mutex_init(&SyncMutex, nullptr);	// Mutex初期化
+	pthread_cond_init(&StartCond, nullptr);		// 条件初期化
+	pthread_cond_init(&DoneCond, nullptr);		// 条件初期化
+}
+
+//! @brief デストラクタ
+MatrixThreadPool::~MatrixThreadPool(){
+	StopWorkers();	// 計算スレッドを終了させてから破棄
+	pthread_cond_destroy(&DoneCond);
+	pthread_cond_destroy(&StartCond);
+	pthread_mutex_destroy(&SyncMutex);
+	pthread_mutex_destroy(&CallMutex);
+}
+
+//! @brief 並列計算に使うスレッド数を設定する関数
+//! @param[in]	Num	呼び出し元を含めたスレッド数 (0のときは1とみなす)
+void MatrixThreadPool::SetNumThreads(const size_t Num){
+	MatrixThreadPool& Pool = GetInstance();
+	pthread_mutex_lock(&Pool.CallMutex);	// 並列計算中は待つ
+	Pool.StopWorkers();
+	Pool.StartWorkers(std::max(Num, (size_t)1));
+	pthread_mutex_unlock(&Pool.CallMutex);
+}
+
+//! @brief 並列計算に使うスレッド数を返す関数
+//! @return	呼び出し元を含めたスレッド数
+size_t MatrixThreadPool::GetNumThreads(void){
+	MatrixThreadPool& Pool = GetInstance();
+	pthread_mutex_lock(&Pool.CallMutex);
+	const size_t ret = Pool.NumThreads;
+	pthread_mutex_unlock(&Pool.CallMutex);
+	return ret;
+}
+
+//! @brief 範囲を分割して並列に計算する関数
+//! [Begin, End) を Grain の倍数の境界でスレッド数個の連続した範囲に分けて，Func(開始, 終了) を各スレッドで呼ぶ。
+//! すべての範囲の計算が終わるまで戻らない。
+//! @param[in]	Begin	範囲の開始
+//! @param[in]	End		範囲の終了(この値は含まない)
+//! @param[in]	Grain	分割の単位 (0のときは1とみなす)
+//! @param[in]	Func	計算する関数 引数(開始, 終了)
+void MatrixThreadPool::ParallelFor(const size_t Begin, const size_t End, const size_t Grain, const std::function<void(size_t,size_t)>& Func){
+	if(End <= Begin) return;
+	MatrixThreadPool& Pool = GetInstance();
+	if(InParallel == true){
+		Func(Begin, End);	// 入れ子のときは逐次計算
+		return;
+	}
+	
+	pthread_mutex_lock(&Pool.CallMutex);	// 他のスレッドからの同時呼び出しを防止
+	const size_t G = std::max(Grain, (size_t)1);
+	const size_t NumGrains = (End - Begin + G - 1)/G;			// 分割の単位の数
+	const size_t NumJobs = std::min(Pool.NumThreads, NumGrains);	// 実際に分割する数
+	if(NumJobs <= 1){
+		pthread_mutex_unlock(&Pool.CallMutex);
+		Func(Begin, End);	// 分割しないときは逐次計算
+		return;
+	}
+	
+	// 各スレッドが担当する範囲を決めて，計算する関数と範囲の数と一緒に計算スレッドに公開する
+	// (前回の計算要求に遅れて起きた計算スレッドが読むかもしれないので，すべて SyncMutex の中で書き換える)
+	pthread_mutex_lock(&Pool.SyncMutex);
+	Pool.JobRanges.resize(NumJobs);
+	size_t Start = Begin;
+	for(size_t i = 0; i < NumJobs; ++i){
+		const size_t Count = NumGrains/NumJobs + (i < NumGrains % NumJobs ? 1 : 0);	// 単位の数をできるだけ均等に割り振る
+		const size_t Stop = std::min(Start + Count*G, End);
+		Pool.JobRanges[i] = std::make_pair(Start, Stop);
+		Start = Stop;
+	}
+	Pool.JobFunc = &Func;
+	Pool.JobCount = NumJobs;
+	Pool.Remaining = NumJobs - 1;
+	const std::pair<size_t,size_t> Range = Pool.JobRanges[0];	// 最初の範囲は呼び出し元が担当
+	
+	// 計算スレッドに計算開始を知らせる
+	++Pool.Generation;
+	pthread_cond_broadcast(&Pool.StartCond);
+	pthread_mutex_unlock(&Pool.SyncMutex);
+	
+	// 最初の範囲は呼び出し元のスレッドで計算
+	InParallel = true;
+	Func(Range.first, Range.second);
+	InParallel = false;
+	
+	// すべての計算スレッドが終わるまで待機
+	pthread_mutex_lock(&Pool.SyncMutex);
+	while(Pool.Remaining != 0) pthread_cond_wait(&Pool.DoneCond, &Pool.SyncMutex);
+	Pool.JobFunc = nullptr;
+	Pool.JobCount = 0;	// 遅れて起きた計算スレッドには担当する範囲がないように見せる
+	pthread_mutex_unlock(&Pool.SyncMutex);
+	pthread_mutex_unlock(&Pool.CallMutex);
+}
+
+//! @brief スレッドプールの実体を返す関数
+//! @return	スレッドプール
+MatrixThreadPool& MatrixThreadPool::GetInstance(void){
+	static MatrixThreadPool Instance;	// 最初に使われたときに生成され，プログラム終了時に破棄される
+	return Instance;
+}
+
+//! @brief 計算スレッド
+//! @param[in]	p	計算スレッドに渡す引数
+void* MatrixThreadPool::WorkerThread(void* p){
+	const WorkerArgs* a = static_cast<WorkerArgs*>(p);
+	MatrixThreadPool* Pool = a->Pool;
+	InParallel = true;	// 計算スレッドの中からの呼び出しは逐次計算
+	
+	pthread_mutex_lock(&Pool->SyncMutex);
+	size_t Seen = a->Generation;	// 生成された後の計算要求だけを受け付ける
+	while(true){
+		// 計算要求が来るまで待機
+		while(Pool->Generation == Seen && Pool->QuitFlag == false) pthread_cond_wait(&Pool->StartCond, &Pool->SyncMutex);
+		if(Pool->QuitFlag == true) break;
+		Seen = Pool->Generation;
+		const size_t Count = Pool->JobCount;	// 起きたときに公開されている計算要求の範囲の数
+		if(Count <= a->Index) continue;			// 担当する範囲がないとき(計算要求に遅れて起きたときも含む)は次の要求を待つ
+		const std::pair<size_t,size_t> Range = Pool->JobRanges[a->Index];
+		const std::function<void(size_t,size_t)>* Func = Pool->JobFunc;
+		pthread_mutex_unlock(&Pool->SyncMutex);
+		
+		(*Func)(Range.first, Range.second);	// 担当する範囲の計算
+		
+		pthread_mutex_lock(&Pool->SyncMutex);
+		if(--Pool->Remaining == 0) pthread_cond_signal(&Pool->DoneCond);	// 最後の範囲が終わったら呼び出し元に知らせる
+	}
+	pthread_mutex_unlock(&Pool->SyncMutex);
+	return nullptr;
+}
+
+//! @brief 計算スレッドを生成する関数
+//! @param[in]	Num	呼び出し元を含めたスレッド数
+void MatrixThreadPool::StartWorkers(const size_t Num){
+	NumThreads = Num;
+	QuitFlag = false;
+	Workers.resize(Num - 1);
+	Args.resize(Num - 1);
+	for(size_t i = 0; i < Num - 1; ++i){
+		Args[i].Pool = this;
+		Args[i].Index = i + 1;	// 0番目の範囲は呼び出し元が担当
+		Args[i].Generation = Generation;
+		pthread_create(&Workers[i], nullptr, WorkerThread, &Args[i]);
+	}
+}
+
+//! @brief 計算スレッドを終了させる関数
+void MatrixThreadPool::StopWorkers(void){
+	pthread_mutex_lock(&SyncMutex);
+	QuitFlag = true;
+	pthread_cond_broadcast(&StartCond);
+	pthread_mutex_unlock(&SyncMutex);
+	for(pthread_t& t : Workers) pthread_join(t, nullptr);
+	Workers.clear();
+	Args.clear();
+	NumThreads = 1;
+}
+
@@ -0,0 +1,74 @@
+//! @file MatrixThreadPool.hh
+//! @brief 行列計算用スレッドプール
+//!
+//! 動的サイズ行列(DynMatrix)の大きな行列積やLU分解，QR分解の更新処理を，列ごとに分けて複数のスレッドで並列に計算する。
+//! 範囲の分け方はスレッド数だけで決まる静的な分割なので，スレッド数が同じなら計算結果は毎回同じになる。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・スレッド数の初期値は1(並列化なし)。オフライン計算などで並列化したいときに SetNumThreads で設定する。
+//   実時間制御中はCPUコアを制御スレッドに割り当てているので，初期値のまま使うこと。
+// ・呼び出し元のスレッドも最初の範囲の計算を担当するので，追加で生成されるスレッドは「スレッド数－1」個。
+// ・ParallelFor の中からさらに ParallelFor を呼んだ場合は，入れ子の方は呼び出し元のスレッドで逐次計算される。
+
+#ifndef MATRIXTHREADPOOL
+#define MATRIXTHREADPOOL
+
+#include <pthread.h>
+#include <functional>
+#include <vector>
+#include <utility>
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 行列計算用スレッドプール
+class MatrixThreadPool {
+	public:
+		static void SetNumThreads(const size_t Num);	//!< 並列計算に使うスレッド数を設定する関数
+		static size_t GetNumThreads(void);				//!< 並列計算に使うスレッド数を返す関数
+		static void ParallelFor(const size_t Begin, const size_t End, const size_t Grain, const std::function<void(size_t,size_t)>& Func);	//!< 範囲を分割して並列に計算する関数
+	
+	private:
+		MatrixThreadPool();		//!< コンストラクタ
+		~MatrixThreadPool();	//!< デストラクタ
+		MatrixThreadPool(MatrixThreadPool&& r) = delete;						//!< ムーブコンストラクタ使用禁止
+		MatrixThreadPool(const MatrixThreadPool&) = delete;						//!< コピーコンストラクタ使用禁止
+		const MatrixThreadPool& operator=(const MatrixThreadPool&) = delete;	//!< 代入演算子使用禁止
+		
+		static MatrixThreadPool& GetInstance(void);	//!< スレッドプールの実体を返す関数
+		static void* WorkerThread(void* p);			//!< 計算スレッド
+		void StartWorkers(const size_t Num);		//!< 計算スレッドを生成する関数
+		void StopWorkers(void);						//!< 計算スレッドを終了させる関数
+		
+		//! @brief 計算スレッドに渡す引数
+		struct WorkerArgs {
+			MatrixThreadPool* Pool;	//!< スレッドプールへのポインタ
+			size_t Index;			//!< 担当する範囲の番号
+			size_t Generation;		//!< 生成されたときの計算要求の通し番号
+		};
+		
+		pthread_mutex_t CallMutex;		//!< ParallelFor の同時呼び出し防止用Mutex
+		pthread_mutex_t SyncMutex;		//!< 計算スレッドとの同期用Mutex
+		pthread_cond_t StartCond;		//!< 計算開始の待機条件
+		pthread_cond_t DoneCond;		//!< 計算終了の待機条件
+		std::vector<pthread_t> Workers;	//!< 計算スレッドの識別子
+		std::vector<WorkerArgs> Args;	//!< 計算スレッドに渡す引数
+		size_t NumThreads;				//!< 呼び出し元を含めたスレッド数
+		size_t Generation;				//!< 計算要求の通し番号
+		size_t Remaining;				//!< 計算が終わっていない範囲の数
+		bool QuitFlag;					//!< 計算スレッドの終了要求
+		const std::function<void(size_t,size_t)>* JobFunc;	//!< 計算する関数
+		size_t JobCount;									//!< 今の計算要求の範囲の数 (計算要求が無いときは0)
+		std::vector<std::pair<size_t,size_t>> JobRanges;	//!< 各スレッドが担当する範囲 [開始, 終了)
+		static thread_local bool InParallel;				//!< 並列計算の中であるかどうか
+};
+}
+
+#endif
+
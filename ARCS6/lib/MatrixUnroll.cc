@@ -0,0 +1,13 @@
+//! @file MatrixUnroll.cc
+//! @brief 行列/ベクトル計算クラス用の小さい行列(4×4以下)の展開版演算カーネル
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+
+#include "MatrixUnroll.hh"
+
+// テンプレートのため，実体もヘッダ側に実装。
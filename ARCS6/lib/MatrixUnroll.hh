@@ -0,0 +1,231 @@
+//! @file MatrixUnroll.hh
+//! @brief 行列/ベクトル計算クラス用の小さい行列(4×4以下)の展開版演算カーネル
+//!
+//! 4×4以下の行列積と転置をコンパイル時にループを完全に展開して計算し，
+//! 行列式，逆行列，連立1次方程式の解をLU分解を使わずに余因子による閉形式で計算する。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・外乱オブザーバや2慣性系の状態オブザーバなどでは1×1～4×4の行列ばかりなので，
+//   ループの制御やLU分解の並べ替えの方が計算そのものよりも重くなる。そのような行列のための専用版。
+// ・行列積は std::index_sequence の展開で，すべての要素の積和が1本の式に展開される。
+//   積和の順番は Matrix.hh の普通のループと同じ。
+// ・逆行列は余因子行列を行列式で割って求める。ピボット選択をしないので，
+//   条件数の悪い行列ではLU分解版よりも精度が落ちる場合がある (正則でない場合はどちらも inf/nan になる)。
+// ・引数は Matrix クラスの Data と同じ Data[N列(横)][M行(縦)] の並び。
+//   行列式と余因子行列は転置しても形が変わらないので，計算式の添字は Data[i][j] をそのまま i行j列 とみなして書いている。
+// ・定数式評価(constexpr)でも使用可能。
+
+#ifndef MATRIXUNROLL
+#define MATRIXUNROLL
+
+#include <cstddef>
+#include <array>
+#include <utility>
+#include "MatrixSIMD.hh"
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 小さい行列(4×4以下)の展開版演算カーネル
+class MatrixUnroll {
+	public:
+		static constexpr size_t MAX_SIZE = 4;	//!< 展開版を使う行列の最大サイズ
+		
+		//! @brief 行列積/転置を展開版で計算すべきかを返す関数
+		//! 1列がSIMDレジスタにちょうど収まる場合(double型の4行など)はSIMD版(MatrixSIMD.hh)の方が速いのでそちらを使う
+		//! @tparam	TT	データ型
+		//! @tparam	N	Aの列数 = Bの行数
+		//! @tparam	M	Aの行数
+		//! @tparam	K	Bの列数
+		//! @return	true = 展開版, false = SIMD版か普通のループ
+		template <typename TT, size_t N, size_t M, size_t K>
+		static constexpr bool isTiny(void){
+			if constexpr(MatrixSIMD::isEnabled<TT>()){
+				if constexpr(M % SIMDregister<TT>::LANE == 0) return false;
+			}
+			return N <= MAX_SIZE && M <= MAX_SIZE && K <= MAX_SIZE;
+		}
+		
+		//! @brief 行列積 Y = s*A*B (ACC = false), Y = Y + s*A*B (ACC = true)
+		//! YはAともBとも異なる領域であること，累積加算の場合は行列積を零から計算して最後にYへ加算する
+		//! @tparam	ACC	累積加算するかどうか
+		//! @param[in,out]	Y	出力行列 (K列×M行)
+		//! @param[in]	A	左側の行列 (N列×M行)
+		//! @param[in]	B	右側の行列 (K列×N行)
+		//! @param[in]	s	スカラー係数
+		template <bool ACC, size_t N, size_t M, size_t K, typename TT>
+		static constexpr void MatMul(std::array<std::array<TT, M>, K>& Y, const std::array<std::array<TT, M>, N>& A, const std::array<std::array<TT, N>, K>& B, const TT s){
+			MatMulColumns<ACC>(Y, A, B, s, std::make_index_sequence<K>{});
+		}
+		
+		//! @brief 転置行列 Y = A^T
+		//! @param[out]	Y	出力行列 (M列×N行)
+		//! @param[in]	A	入力行列 (N列×M行)
+		template <size_t N, size_t M, typename TT>
+		static constexpr void Transpose(std::array<std::array<TT, N>, M>& Y, const std::array<std::array<TT, M>, N>& A){
+			TransposeRows(Y, A, std::make_index_sequence<M>{}, std::make_index_sequence<N>{});
+		}
+		
+		//! @brief 行列式を返す関数
+		//! @param[in]	A	入力行列
+		//! @return	行列式
+		template <size_t N, typename TT>
+		static constexpr TT Det(const std::array<std::array<TT, N>, N>& A){
+			static_assert(N <= MAX_SIZE, "Matrix Size Error");	// サイズチェック
+			if constexpr(N == 1){
+				return A[0][0];
+			}else if constexpr(N == 2){
+				return A[0][0]*A[1][1] - A[0][1]*A[1][0];
+			}else if constexpr(N == 3){
+				// 1行目に沿った余因子展開
+				return   A[0][0]*(A[1][1]*A[2][2] - A[1][2]*A[2][1])
+					   - A[0][1]*(A[1][0]*A[2][2] - A[1][2]*A[2][0])
+					   + A[0][2]*(A[1][0]*A[2][1] - A[1][1]*A[2][0]);
+			}else{
+				// 上2行と下2行の2×2小行列式によるラプラス展開
+				const std::array<TT, 6> s = Minors2x2<0,1>(A), c = Minors2x2<2,3>(A);
+				return s[0]*c[5] - s[1]*c[4] + s[2]*c[3] + s[3]*c[2] - s[4]*c[1] + s[5]*c[0];
+			}
+		}
+		
+		//! @brief 余因子行列と行列式を計算する関数
+		//! @param[in]	A	入力行列
+		//! @param[out]	Y	余因子行列 (Aと異なる領域であること)
+		//! @return	行列式
+		template <size_t N, typename TT>
+		static constexpr TT Adjugate(const std::array<std::array<TT, N>, N>& A, std::array<std::array<TT, N>, N>& Y){
+			static_assert(N <= MAX_SIZE, "Matrix Size Error");	// サイズチェック
+			if constexpr(N == 1){
+				Y[0][0] = 1;
+				return A[0][0];
+			}else if constexpr(N == 2){
+				Y[0][0] =  A[1][1];
+				Y[0][1] = -A[0][1];
+				Y[1][0] = -A[1][0];
+				Y[1][1] =  A[0][0];
+				return A[0][0]*A[1][1] - A[0][1]*A[1][0];
+			}else if constexpr(N == 3){
+				Y[0][0] = A[1][1]*A[2][2] - A[1][2]*A[2][1];
+				Y[0][1] = A[0][2]*A[2][1] - A[0][1]*A[2][2];
+				Y[0][2] = A[0][1]*A[1][2] - A[0][2]*A[1][1];
+				Y[1][0] = A[1][2]*A[2][0] - A[1][0]*A[2][2];
+				Y[1][1] = A[0][0]*A[2][2] - A[0][2]*A[2][0];
+				Y[1][2] = A[0][2]*A[1][0] - A[0][0]*A[1][2];
+				Y[2][0] = A[1][0]*A[2][1] - A[1][1]*A[2][0];
+				Y[2][1] = A[0][1]*A[2][0] - A[0][0]*A[2][1];
+				Y[2][2] = A[0][0]*A[1][1] - A[0][1]*A[1][0];
+				return A[0][0]*Y[0][0] + A[0][1]*Y[1][0] + A[0][2]*Y[2][0];
+			}else{
+				// 上2行と下2行の2×2小行列式から各余因子を組み立てる
+				const std::array<TT, 6> s = Minors2x2<0,1>(A), c = Minors2x2<2,3>(A);
+				Y[0][0] =  A[1][1]*c[5] - A[1][2]*c[4] + A[1][3]*c[3];
+				Y[0][1] = -A[0][1]*c[5] + A[0][2]*c[4] - A[0][3]*c[3];
+				Y[0][2] =  A[3][1]*s[5] - A[3][2]*s[4] + A[3][3]*s[3];
+				Y[0][3] = -A[2][1]*s[5] + A[2][2]*s[4] - A[2][3]*s[3];
+				Y[1][0] = -A[1][0]*c[5] + A[1][2]*c[2] - A[1][3]*c[1];
+				Y[1][1] =  A[0][0]*c[5] - A[0][2]*c[2] + A[0][3]*c[1];
+				Y[1][2] = -A[3][0]*s[5] + A[3][2]*s[2] - A[3][3]*s[1];
+				Y[1][3] =  A[2][0]*s[5] - A[2][2]*s[2] + A[2][3]*s[1];
+				Y[2][0] =  A[1][0]*c[4] - A[1][1]*c[2] + A[1][3]*c[0];
+				Y[2][1] = -A[0][0]*c[4] + A[0][1]*c[2] - A[0][3]*c[0];
+				Y[2][2] =  A[3][0]*s[4] - A[3][1]*s[2] + A[3][3]*s[0];
+				Y[2][3] = -A[2][0]*s[4] + A[2][1]*s[2] - A[2][3]*s[0];
+				Y[3][0] = -A[1][0]*c[3] + A[1][1]*c[1] - A[1][2]*c[0];
+				Y[3][1] =  A[0][0]*c[3] - A[0][1]*c[1] + A[0][2]*c[0];
+				Y[3][2] = -A[3][0]*s[3] + A[3][1]*s[1] - A[3][2]*s[0];
+				Y[3][3] =  A[2][0]*s[3] - A[2][1]*s[1] + A[2][2]*s[0];
+				return s[0]*c[5] - s[1]*c[4] + s[2]*c[3] + s[3]*c[2] - s[4]*c[1] + s[5]*c[0];
+			}
+		}
+		
+		//! @brief 逆行列を計算する関数 (正則チェック無し)
+		//! @param[in]	A	入力行列
+		//! @param[out]	Y	逆行列 (Aと異なる領域であること)
+		template <size_t N, typename TT>
+		static constexpr void Inv(const std::array<std::array<TT, N>, N>& A, std::array<std::array<TT, N>, N>& Y){
+			const TT d = (TT)1/Adjugate(A, Y);	// 余因子行列と行列式の逆数
+			for(size_t i = 0; i < N; ++i){
+				for(size_t j = 0; j < N; ++j) Y[i][j] *= d;
+			}
+		}
+		
+		//! @brief Ax = b の形の線形連立1次方程式をxについて解く関数 (正則チェック無し)
+		//! @param[in]	A	係数行列
+		//! @param[in]	b	係数ベクトル
+		//! @param[out]	x	解ベクトル
+		template <size_t N, typename TT>
+		static constexpr void Solve(const std::array<std::array<TT, N>, N>& A, const std::array<TT, N>& b, std::array<TT, N>& x){
+			std::array<std::array<TT, N>, N> Y = {};	// 余因子行列
+			const TT d = Adjugate(A, Y);				// 行列式
+			// x = adj(A)*b/det(A) の積和を列ごとに展開して計算
+			const std::array<std::array<TT, N>, 1> B = {b};
+			std::array<std::array<TT, N>, 1> X = {};
+			MatMul<false>(X, Y, B, (TT)1);
+			for(size_t j = 0; j < N; ++j) x[j] = X[0][j]/d;
+		}
+	
+	private:
+		MatrixUnroll() = delete;						//!< コンストラクタ使用禁止
+		MatrixUnroll(MatrixUnroll&& r) = delete;		//!< ムーブコンストラクタ使用禁止
+		~MatrixUnroll() = delete;						//!< デストラクタ使用禁止
+		MatrixUnroll(const MatrixUnroll&) = delete;		//!< コピーコンストラクタ使用禁止
+		const MatrixUnroll& operator=(const MatrixUnroll&) = delete;	//!< 代入演算子使用禁止
+		
+		//! @brief 行列積の全列を展開して計算する関数
+		template <bool ACC, size_t N, size_t M, size_t K, typename TT, size_t... Ks>
+		static constexpr void MatMulColumns(std::array<std::array<TT, M>, K>& Y, const std::array<std::array<TT, M>, N>& A, const std::array<std::array<TT, N>, K>& B, const TT s, std::index_sequence<Ks...>){
+			(MatMulColumn<ACC,Ks>(Y, A, B, s, std::make_index_sequence<M>{}, std::make_index_sequence<N>{}), ...);
+		}
+		
+		//! @brief 行列積のk列目の全要素を展開して計算する関数
+		template <bool ACC, size_t k, size_t N, size_t M, size_t K, typename TT, size_t... Js, size_t... Is>
+		static constexpr void MatMulColumn(std::array<std::array<TT, M>, K>& Y, const std::array<std::array<TT, M>, N>& A, const std::array<std::array<TT, N>, K>& B, const TT s, std::index_sequence<Js...>, std::index_sequence<Is...> is){
+			const std::array<TT, N> b = {(s*B[k][Is])...};	// 右側行列のk列目のスカラー倍
+			if constexpr(ACC){
+				((Y[k][Js] += Dot<Js>(A, b, is)), ...);
+			}else{
+				((Y[k][Js] = Dot<Js>(A, b, is)), ...);
+			}
+		}
+		
+		//! @brief 転置行列の全要素を展開して計算する関数
+		template <size_t N, size_t M, typename TT, size_t... Js, size_t... Is>
+		static constexpr void TransposeRows(std::array<std::array<TT, N>, M>& Y, const std::array<std::array<TT, M>, N>& A, std::index_sequence<Js...>, std::index_sequence<Is...> is){
+			((Y[Js] = Row<Js>(A, is)), ...);
+		}
+		
+		//! @brief j行目を取り出す関数
+		template <size_t j, size_t N, size_t M, typename TT, size_t... Is>
+		static constexpr std::array<TT, N> Row(const std::array<std::array<TT, M>, N>& A, std::index_sequence<Is...>){
+			return {A[Is][j]...};
+		}
+		
+		//! @brief 左側行列のj行目と右側の列ベクトルの内積を展開して計算する関数
+		template <size_t j, size_t N, size_t M, typename TT, size_t... Is>
+		static constexpr TT Dot(const std::array<std::array<TT, M>, N>& A, const std::array<TT, N>& b, std::index_sequence<Is...>){
+			return (... + (A[Is][j]*b[Is]));
+		}
+		
+		//! @brief 4×4行列のp行目とq行目から作られる2×2小行列式6個を返す関数
+		template <size_t p, size_t q, typename TT>
+		static constexpr std::array<TT, 6> Minors2x2(const std::array<std::array<TT, 4>, 4>& A){
+			return {
+				A[p][0]*A[q][1] - A[q][0]*A[p][1],
+				A[p][0]*A[q][2] - A[q][0]*A[p][2],
+				A[p][0]*A[q][3] - A[q][0]*A[p][3],
+				A[p][1]*A[q][2] - A[q][1]*A[p][2],
+				A[p][1]*A[q][3] - A[q][1]*A[p][3],
+				A[p][2]*A[q][3] - A[q][2]*A[p][3]
+			};
+		}
+};
+}
+
+#endif
+
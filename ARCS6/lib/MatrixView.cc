@@ -0,0 +1,13 @@
+//! @file MatrixView.cc
+//! @brief 行列/ベクトル計算クラス用のビュー(部分行列の参照)
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+
+#include "MatrixView.hh"
+
+// テンプレートのため，実体もヘッダ側に実装。
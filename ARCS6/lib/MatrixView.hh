@@ -0,0 +1,347 @@
+//! @file MatrixView.hh
+//! @brief 行列/ベクトル計算クラス用のビュー(部分行列の参照)
+//!
+//! 行列の一部(ブロック，行，列，飛び飛びの要素)を，コピーせずに元の行列の要素を直接参照するビュー。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・subview, rowview, columnview, vvectorview, stridedview で元の行列の一部を参照するビューを作る。
+//   getsubmatrix や getvvector などと違い，ビューを作っただけでは要素のコピーは発生しない。
+// ・ビューは式テンプレート(MatrixExpr.hh)の一種として振る舞うので，行列との加減算，スカラー倍，行列積にそのまま使え，
+//   Matrixへの代入時に元の行列から出力先へ直接読み出される。tp(ビュー) も添字の向きを入れ替えるだけでコピーしない。
+//   ただし行列積の被演算子になった場合は，他の式と同様に先に一度だけ行列へ評価される。
+//   また，lazy() を含まないビューの演算は，その場で行列に評価された結果を返す。
+// ・det, inv, solve などの行列を引数に取る関数には，ビューが自動的に行列へ評価されて渡される。
+// ・const でない行列から作ったビューへの代入(=, +=, -=)は，元の行列の該当部分へ書き込まれる。
+//   右辺に同じ行列が現れても良いように，右辺を一時行列へ評価してから書き込む。
+// ・ビューは元の行列へのポインタを持つだけなので，元の行列より長生きさせないこと。
+//   一時的な行列からはビューを作れないようにしている。
+// ・定数式評価(constexpr)でも使用可能。
+
+#ifndef MATRIXVIEW
+#define MATRIXVIEW
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include "MatrixExpr.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 行列のビュー(元の行列の要素を参照する部分行列)
+//!
+//! ビューの (a,b) 要素(0始まり, a:列, b:行)は，元の行列の (n0 + a*cn + b*rn, m0 + a*cm + b*rm) 要素を指す。
+//!
+//! @tparam	RR	ビューを行列として評価したときの型 (実引数依存の名前探索で RR のfriend関数が見つかるようにテンプレート引数に含める)
+//! @tparam	PP	元の行列の型 (Matrix か const Matrix)
+template <class RR, class PP>
+class MatrixView : public MatrixExpr<MatrixView<RR,PP>, RR> {
+	private:
+		using TT = typename RR::value_type;						//!< データ型
+		static constexpr size_t VN = RR::N;						//!< ビューの幅
+		static constexpr size_t VM = RR::M;						//!< ビューの高さ
+		static constexpr bool WRITABLE = !std::is_const_v<PP>;	//!< 書き込み可能なビューかどうか
+		static_assert(std::is_same_v<TT, typename PP::value_type>, "Matrix Type Error");	// データ型チェック
+		template <class R, class P> friend class MatrixView;	// 転置ビュー生成用
+	
+	public:
+		//! @brief コンストラクタ
+		//! @param[in]	U	元の行列
+		//! @param[in]	n	ビューの先頭の列番号(0始まり)
+		//! @param[in]	m	ビューの先頭の行番号(0始まり)
+		//! @param[in]	dnc	ビューの列が1つ進んだときの元の行列の列の増分
+		//! @param[in]	dmc	ビューの列が1つ進んだときの元の行列の行の増分
+		//! @param[in]	dnr	ビューの行が1つ進んだときの元の行列の列の増分
+		//! @param[in]	dmr	ビューの行が1つ進んだときの元の行列の行の増分
+		constexpr MatrixView(PP& U, const size_t n, const size_t m, const size_t dnc, const size_t dmc, const size_t dnr, const size_t dmr)
+			: P(&U), n0(n), m0(m), cn(dnc), cm(dmc), rn(dnr), rm(dmr)
+		{
+			// 最後の要素が元の行列の範囲内にあるかチェック
+			arcs_assert(n0 + (VN - 1)*cn + (VM - 1)*rn < PP::N);
+			arcs_assert(m0 + (VN - 1)*cm + (VM - 1)*rm < PP::M);
+		}
+		
+		//! @brief コピーコンストラクタ(同じ要素を参照するビューを作る)
+		constexpr MatrixView(const MatrixView& right) = default;
+		
+		//! @brief ビュー代入演算子(参照先を付け替えるのではなく，要素を書き込む)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		constexpr MatrixView& operator=(const MatrixView& right){
+			return (*this) = RR(right);	// 参照先が重なっていても良いように一時行列を経由
+		}
+		
+		//! @brief 行列代入演算子
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		constexpr MatrixView& operator=(const RR& right){
+			static_assert(WRITABLE, "Matrix View is Read Only");	// const行列のビューには書き込めない
+			for(size_t i = 0; i < VN; ++i){
+				for(size_t j = 0; j < VM; ++j) At(i, j) = right.Data[i][j];
+			}
+			return (*this);
+		}
+		
+		//! @brief 行列代入演算子 (式テンプレートやほかのビューの場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		template <class EE>
+		constexpr MatrixView& operator=(const MatrixExpr<EE,RR>& right){
+			return (*this) = RR(right);	// 右辺に元の行列が現れても良いように一時行列を経由
+		}
+		
+		//! @brief 行列加算代入演算子
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		constexpr MatrixView& operator+=(const RR& right){
+			static_assert(WRITABLE, "Matrix View is Read Only");	// const行列のビューには書き込めない
+			for(size_t i = 0; i < VN; ++i){
+				for(size_t j = 0; j < VM; ++j) At(i, j) += right.Data[i][j];
+			}
+			return (*this);
+		}
+		
+		//! @brief 行列加算代入演算子 (式テンプレートやほかのビューの場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		template <class EE>
+		constexpr MatrixView& operator+=(const MatrixExpr<EE,RR>& right){
+			return (*this) += RR(right);
+		}
+		
+		//! @brief 行列減算代入演算子
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		constexpr MatrixView& operator-=(const RR& right){
+			static_assert(WRITABLE, "Matrix View is Read Only");	// const行列のビューには書き込めない
+			for(size_t i = 0; i < VN; ++i){
+				for(size_t j = 0; j < VM; ++j) At(i, j) -= right.Data[i][j];
+			}
+			return (*this);
+		}
+		
+		//! @brief 行列減算代入演算子 (式テンプレートやほかのビューの場合)
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		template <class EE>
+		constexpr MatrixView& operator-=(const MatrixExpr<EE,RR>& right){
+			return (*this) -= RR(right);
+		}
+		
+		//! @brief 要素を設定する関数
+		//! @param[in]	n	ビューの列番号(1始まり)
+		//! @param[in]	m	ビューの行番号(1始まり)
+		//! @param[in]	val	設定する値
+		constexpr void SetElement(const size_t n, const size_t m, const TT val){
+			static_assert(WRITABLE, "Matrix View is Read Only");	// const行列のビューには書き込めない
+			arcs_assert(0 < n && n <= VN);
+			arcs_assert(0 < m && m <= VM);
+			At(n - 1, m - 1) = val;
+		}
+		
+		//! @brief 要素を取得する関数
+		//! @param[in]	n	ビューの列番号(1始まり)
+		//! @param[in]	m	ビューの行番号(1始まり)
+		//! @return	要素の値
+		constexpr TT GetElement(const size_t n, const size_t m) const{
+			arcs_assert(0 < n && n <= VN);
+			arcs_assert(0 < m && m <= VM);
+			return At(n - 1, m - 1);
+		}
+		
+		//! @brief 縦ベクトル/横ベクトルのビューの要素を参照する演算子
+		//! @param[in]	k	要素番号(1始まり)
+		//! @return	要素への参照
+		constexpr auto& operator[](const size_t k) const{
+			static_assert(VN == 1 || VM == 1, "Matrix View is not Vector");	// ベクトルのビューのみ
+			arcs_assert(0 < k && k <= VN*VM);
+			if constexpr(VN == 1){
+				return At(0, k - 1);
+			}else{
+				return At(k - 1, 0);
+			}
+		}
+		
+		//! @brief 出力先への代入 Y = s*V
+		//! @param[out]	Y	出力先の行列 (元の行列と同じであってはならない)
+		//! @param[in]	s	スカラー係数
+		constexpr void AssignTo(RR& Y, const TT s = 1) const{
+			if(cm == 0 && rn == 0 && rm == 1){
+				// 列ごとに元の行列の連続した要素を読む場合
+				for(size_t i = 0; i < VN; ++i){
+					const auto& Col = P->Data[n0 + i*cn];
+					for(size_t j = 0; j < VM; ++j) Y.Data[i][j] = s*Col[m0 + j];
+				}
+			}else{
+				for(size_t i = 0; i < VN; ++i){
+					for(size_t j = 0; j < VM; ++j) Y.Data[i][j] = s*At(i, j);
+				}
+			}
+		}
+		
+		//! @brief 出力先への累積加算 Y = Y + s*V
+		//! @param[in,out]	Y	出力先の行列 (元の行列と同じであってはならない)
+		//! @param[in]		s	スカラー係数
+		constexpr void AddTo(RR& Y, const TT s = 1) const{
+			for(size_t i = 0; i < VN; ++i){
+				for(size_t j = 0; j < VM; ++j) Y.Data[i][j] += s*At(i, j);
+			}
+		}
+		
+		//! @brief 指定した行列を参照しているかを返す関数
+		//! @param[in]	p	行列へのポインタ
+		//! @return	true = 参照している
+		constexpr bool IsAliasOf(const void* p) const{
+			return static_cast<const void*>(P) == p;
+		}
+		
+		//! @brief ビューの転置 (添字の向きを入れ替えたビューを返し，コピーはしない)
+		//! @param[in]	V	ビュー
+		//! @return	転置したビュー
+		friend constexpr auto tp(const MatrixView& V){
+			return MatrixView<Matrix<VM,VN,TT>,PP>(*V.P, V.n0, V.m0, V.rn, V.rm, V.cn, V.cm);
+		}
+	
+	private:
+		PP* P;		//!< 元の行列へのポインタ
+		size_t n0;	//!< 先頭の列番号(0始まり)
+		size_t m0;	//!< 先頭の行番号(0始まり)
+		size_t cn;	//!< ビューの列が1つ進んだときの列の増分
+		size_t cm;	//!< ビューの列が1つ進んだときの行の増分
+		size_t rn;	//!< ビューの行が1つ進んだときの列の増分
+		size_t rm;	//!< ビューの行が1つ進んだときの行の増分
+		
+		//! @brief 元の行列の要素への参照を返す関数
+		//! @param[in]	i	ビューの列番号(0始まり)
+		//! @param[in]	j	ビューの行番号(0始まり)
+		//! @return	要素への参照 (const行列のビューのときはconst参照)
+		constexpr auto& At(const size_t i, const size_t j) const{
+			return P->Data[n0 + i*cn + j*rn][m0 + i*cm + j*rm];
+		}
+};
+
+//! @brief 部分行列のビューを返す関数 (getsubmatrix のコピーなし版)
+//! @tparam	SN, SM	部分行列の幅と高さ
+//! @param[in]	U	元の行列
+//! @param[in]	n	部分行列の左上の列番号(1始まり)
+//! @param[in]	m	部分行列の左上の行番号(1始まり)
+//! @return	部分行列のビュー
+template <size_t SN, size_t SM, size_t NN, size_t MM, typename TT>
+constexpr auto subview(Matrix<NN,MM,TT>& U, const size_t n, const size_t m){
+	arcs_assert(0 < n && 0 < m);
+	return MatrixView<Matrix<SN,SM,TT>, Matrix<NN,MM,TT>>(U, n - 1, m - 1, 1, 0, 0, 1);
+}
+
+//! @brief 部分行列のビューを返す関数 (const版)
+template <size_t SN, size_t SM, size_t NN, size_t MM, typename TT>
+constexpr auto subview(const Matrix<NN,MM,TT>& U, const size_t n, const size_t m){
+	arcs_assert(0 < n && 0 < m);
+	return MatrixView<Matrix<SN,SM,TT>, const Matrix<NN,MM,TT>>(U, n - 1, m - 1, 1, 0, 0, 1);
+}
+
+//! @brief 一時的な行列からのビュー生成禁止
+template <size_t SN, size_t SM, size_t NN, size_t MM, typename TT>
+void subview(Matrix<NN,MM,TT>&& U, const size_t n, const size_t m) = delete;
+
+//! @brief 飛び飛びの要素の部分行列のビューを返す関数
+//! @tparam	SN, SM	部分行列の幅と高さ
+//! @param[in]	U	元の行列
+//! @param[in]	n	部分行列の左上の列番号(1始まり)
+//! @param[in]	m	部分行列の左上の行番号(1始まり)
+//! @param[in]	dn	列の間隔 (1なら連続)
+//! @param[in]	dm	行の間隔 (1なら連続)
+//! @return	部分行列のビュー
+template <size_t SN, size_t SM, size_t NN, size_t MM, typename TT>
+constexpr auto stridedview(Matrix<NN,MM,TT>& U, const size_t n, const size_t m, const size_t dn, const size_t dm){
+	arcs_assert(0 < n && 0 < m);
+	return MatrixView<Matrix<SN,SM,TT>, Matrix<NN,MM,TT>>(U, n - 1, m - 1, dn, 0, 0, dm);
+}
+
+//! @brief 飛び飛びの要素の部分行列のビューを返す関数 (const版)
+template <size_t SN, size_t SM, size_t NN, size_t MM, typename TT>
+constexpr auto stridedview(const Matrix<NN,MM,TT>& U, const size_t n, const size_t m, const size_t dn, const size_t dm){
+	arcs_assert(0 < n && 0 < m);
+	return MatrixView<Matrix<SN,SM,TT>, const Matrix<NN,MM,TT>>(U, n - 1, m - 1, dn, 0, 0, dm);
+}
+
+//! @brief 一時的な行列からのビュー生成禁止
+template <size_t SN, size_t SM, size_t NN, size_t MM, typename TT>
+void stridedview(Matrix<NN,MM,TT>&& U, const size_t n, const size_t m, const size_t dn, const size_t dm) = delete;
+
+//! @brief 縦ベクトルの一部のビューを返す関数 (getvvector のコピーなし版)
+//! @tparam	VM	切り出すベクトルの長さ
+//! @param[in]	U	元の行列
+//! @param[in]	n	列番号(1始まり)
+//! @param[in]	m	先頭の行番号(1始まり)
+//! @return	縦ベクトルのビュー
+template <size_t VM, size_t NN, size_t MM, typename TT>
+constexpr auto vvectorview(Matrix<NN,MM,TT>& U, const size_t n, const size_t m){
+	return subview<1,VM>(U, n, m);
+}
+
+//! @brief 縦ベクトルの一部のビューを返す関数 (const版)
+template <size_t VM, size_t NN, size_t MM, typename TT>
+constexpr auto vvectorview(const Matrix<NN,MM,TT>& U, const size_t n, const size_t m){
+	return subview<1,VM>(U, n, m);
+}
+
+//! @brief 一時的な行列からのビュー生成禁止
+template <size_t VM, size_t NN, size_t MM, typename TT>
+void vvectorview(Matrix<NN,MM,TT>&& U, const size_t n, const size_t m) = delete;
+
+//! @brief 行のビューを返す関数 (getrow のコピーなし版)
+//! @param[in]	U	元の行列
+//! @param[in]	m	行番号(1始まり)
+//! @return	横ベクトルのビュー
+template <size_t NN, size_t MM, typename TT>
+constexpr auto rowview(Matrix<NN,MM,TT>& U, const size_t m){
+	return subview<NN,1>(U, 1, m);
+}
+
+//! @brief 行のビューを返す関数 (const版)
+template <size_t NN, size_t MM, typename TT>
+constexpr auto rowview(const Matrix<NN,MM,TT>& U, const size_t m){
+	return subview<NN,1>(U, 1, m);
+}
+
+//! @brief 一時的な行列からのビュー生成禁止
+template <size_t NN, size_t MM, typename TT>
+void rowview(Matrix<NN,MM,TT>&& U, const size_t m) = delete;
+
+//! @brief 列のビューを返す関数 (getcolumn のコピーなし版)
+//! @param[in]	U	元の行列
+//! @param[in]	n	列番号(1始まり)
+//! @return	縦ベクトルのビュー
+template <size_t NN, size_t MM, typename TT>
+constexpr auto columnview(Matrix<NN,MM,TT>& U, const size_t n){
+	return subview<1,MM>(U, n, 1);
+}
+
+//! @brief 列のビューを返す関数 (const版)
+template <size_t NN, size_t MM, typename TT>
+constexpr auto columnview(const Matrix<NN,MM,TT>& U, const size_t n){
+	return subview<1,MM>(U, n, 1);
+}
+
+//! @brief 一時的な行列からのビュー生成禁止
+template <size_t NN, size_t MM, typename TT>
+void columnview(Matrix<NN,MM,TT>&& U, const size_t n) = delete;
+}
+
+#endif
+
@@ -2,11 +2,12 @@
 //! @brief モータシミュレータ(ベクトル対応版)
 //!
 //! 複数のモータを模擬する
+//! 全軸の状態方程式は多軸一括行列(MatrixBatch)でまとめて計算する。
 //!
-//! @date 2020/04/14
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -17,8 +18,9 @@
 #include <cassert>
 #include <array>
 #include "Matrix.hh"
+#include "MatrixBatch.hh"
+#include "Discret.hh"
 #include "MotorParamDef.hh"
-#include "MotorSimulator.hh"
 
 // ARCS組込み用マクロ
 #ifdef ARCS_IN
@@ -43,23 +45,23 @@ class MotorSimulators {
 		//! @param[in]	Params	モータパラメータ構造体の配列
 		//! @param[in]	SmplTime	サンプリング周期 [s]
 		MotorSimulators(const std::array<struct MotorParamDef, N>& Params, const double SmplTime)
-			: PlantSyss()
+			: Ad(), Bd(), u(), x()
 		{
 			PassedLog();
-			// 各軸数分のモータシミュレータのパラメータ設定
+			// 各軸数分のモータのパラメータ設定
 			for(size_t i = 0; i < N; ++i){
-				PlantSyss.at(i).SetParameters(Params.at(i).Kt, Params.at(i).Jm, Params.at(i).Dm, SmplTime);
+				SetStateSpaceModel(i, Params.at(i).Kt, Params.at(i).Jm, Params.at(i).Dm, SmplTime);
 			}
 		}
-
+		
 		//! @brief ムーブコンストラクタ
 		//! @param[in]	r	右辺値
 		MotorSimulators(MotorSimulators&& r)
-			: PlantSyss(std::move(r.PlantSyss))
+			: Ad(r.Ad), Bd(r.Bd), u(r.u), x(r.x)
 		{
 			
 		}
-
+		
 		//! @brief デストラクタ
 		~MotorSimulators(){
 			PassedLog();
@@ -69,28 +71,56 @@ class MotorSimulators {
 		//! @param[in]	Current	[A] 電流の配列
 		//! @param[in]	LoadTorque	[Nm] 負荷トルクの配列
 		void SetCurrentAndLoadTorque(const std::array<double, N> Current, const std::array<double, N> LoadTorque){
-			// 各軸の電流と負荷トルクを設定
-			for(size_t i = 0; i < N; ++i){
-				PlantSyss.at(i).SetCurrentAndLoadTorque(Current.at(i), LoadTorque.at(i));
-			}
+			// 全軸の入力ベクトルを設定
+			u.SetLanes(1, 1, Current);
+			u.SetLanes(1, 2, LoadTorque);
 		}
 		
 		//! @brief 予めセットされたモータ電流と負荷トルクから速度と位置を計算する関数
 		//! @param[out]	Velocity	[rad/s] 速度
 		//! @param[out] Position	[rad] 位置
 		void GetVelocityAndPosition(std::array<double, N>& Velocity, std::array<double, N>& Position){
-			// 各軸の応答計算
-			for(size_t i = 0; i < N; ++i){
-				PlantSyss.at(i).GetVelocityAndPosition(Velocity.at(i), Position.at(i));
-			}
+			// 全軸の応答をまとめて計算 (C行列は単位行列なので出力は更新前の状態ベクトルそのもの)
+			x.GetLanes(1, 1, Velocity);
+			x.GetLanes(1, 2, Position);
+			statespace_step(x, Ad, Bd, u);	// x[k+1] = Ad*x[k] + Bd*u[k]
 		}
-		
-		
+	
+	
 	private:
 		MotorSimulators(const MotorSimulators&) = delete;					//!< コピーコンストラクタ使用禁止
 		const MotorSimulators& operator=(const MotorSimulators&) = delete;	//!< 代入演算子使用禁止
 		
-		std::array<MotorSimulator, N> PlantSyss;	//!< モータシミュレータの配列
+		MatrixBatch<N,2,2> Ad;	//!< 全軸の離散系A行列
+		MatrixBatch<N,2,2> Bd;	//!< 全軸の離散系B行列
+		MatrixBatch<N,1,2> u;	//!< 全軸の入力ベクトル
+		MatrixBatch<N,1,2> x;	//!< 全軸の状態ベクトル
+		
+		//! @brief i軸目の状態空間モデルを設定する関数
+		//! @param[in]	i	軸番号 (0始まり)
+		//! @param[in]	Kt	[Nm/A] トルク定数
+		//! @param[in]	Jm	[kgm^2]モータ慣性
+		//! @param[in]	Dm	[Nm/(rad/s)]モータ粘性
+		//! @param[in]	SmplTime	[s] サンプリング時間
+		void SetStateSpaceModel(const size_t i, const double Kt, const double Jm, const double Dm, const double SmplTime){
+			// 連続系A行列の設定
+			const Matrix<2,2> A = {
+				-Dm/Jm,  0,
+				     1,  0
+			};
+			
+			// 連続系B行列の設定
+			const Matrix<2,2> B = {
+				Kt/Jm, -1.0/Jm,
+				    0,       0
+			};
+			
+			// 離散化して i軸目に格納
+			Matrix<2,2> Adi, Bdi;
+			Discret::GetDiscSystem(A, B, Adi, Bdi, SmplTime);
+			Ad.SetMatrix(i, Adi);
+			Bd.SetMatrix(i, Bdi);
+		}
 };
 }
 
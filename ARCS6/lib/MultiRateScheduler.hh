@@ -0,0 +1,215 @@
+//! @file MultiRateScheduler.hh
+//! @brief マルチレートスケジューラクラス(テンプレート版)
+//!
+//! 1つのリアルタイムスレッドの基本周期の中で，周期の異なる複数の制御用関数(レートグループ)を決まった順番で実行する。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・各レートグループの周期は基本周期の整数倍(分周比)で指定する。基本周期1回分を「マイナーフレーム」と呼ぶ。
+// ・フレーム番号 k が k % 分周比 = 位相オフセット を満たすときにそのグループを実行する。
+//   同じフレームで複数のグループを実行するときはグループ番号の小さい順に実行する。(速いグループを若い番号にすること)
+// ・位相オフセットをずらすと遅いグループの処理が別々のフレームに分散されて，1フレームあたりの最大消費時間が減る。
+//   SpreadOffsets() を呼ぶと，各フレームで実行されるグループの数がなるべく均等になるように位相オフセットを自動で決める。
+// ・すべてのグループが1つのスレッドで順番に実行されるので，グループ間で変数を共有してもデータ競合は起きない。
+//   ただし，遅いグループの処理も1つのマイナーフレームの中に収める必要がある。(途中で中断して次のフレームに持ち越すことはできない)
+// ・SetRateGroup() や SpreadOffsets() はリアルタイムスレッドの停止中に呼ぶこと。Execute() はメモリ確保もロックも無い。
+// ・各グループの最初の計測周期がグループの周期になるように，分周比と位相オフセットを設定するたびに前回の実行時刻を設定し直す。
+//   (フレーム番号 k の時刻を k × 基本周期 とみなす。制御を再開して時刻が 0 に戻るときは Reset() を呼ぶこと)
+
+#ifndef MULTIRATESCHEDULER
+#define MULTIRATESCHEDULER
+
+#include <cassert>
+#include <time.h>
+#include <array>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+	#include "ARCSeventlog.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+	#define PassedLog()
+	#define EventLog(a)
+	#define EventLogVar(a)
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief マルチレートスケジューラクラス
+//! @tparam	N	レートグループの数
+template <size_t N>
+class MultiRateScheduler {
+	public:
+		//! @brief コンストラクタ
+		//! @param[in]	BasePeriod	[ns] 基本周期 (リアルタイムスレッドの制御周期)
+		explicit MultiRateScheduler(const unsigned long BasePeriod)
+			: Ts(BasePeriod), Frame(0), Divisor(), Offset(), Func(), TimePrev(), CompTime(), MaxCompTime()
+		{
+			PassedLog();
+			Divisor.fill(1);
+			Offset.fill(0);
+			Reset();
+		}
+		
+		//! @brief ムーブコンストラクタ
+		MultiRateScheduler(MultiRateScheduler&& r)
+			: Ts(r.Ts), Frame(r.Frame), Divisor(r.Divisor), Offset(r.Offset), Func(std::move(r.Func)),
+			  TimePrev(r.TimePrev), CompTime(r.CompTime), MaxCompTime(r.MaxCompTime)
+		{
+			
+		}
+		
+		//! @brief デストラクタ
+		~MultiRateScheduler(){
+			PassedLog();
+		}
+		
+		//! @brief レートグループを設定する関数
+		//! @param[in]	i		グループ番号 (0 から N-1 まで，同じフレームでは番号の小さい順に実行される)
+		//! @param[in]	Div		[-] 分周比 (グループの周期 = 基本周期 × Div)
+		//! @param[in]	Function	制御用関数 引数(時刻 [s], 計測周期 [s], 前回の消費時間 [s])，戻り値 false でクロックオーバーライド
+		//! @param[in]	Ofs		[-] 位相オフセット (0 ≦ Ofs < Div)
+		void SetRateGroup(const size_t i, const unsigned long Div, const std::function<bool(double,double,double)>& Function, const unsigned long Ofs = 0){
+			arcs_assert(i < N);			// 範囲チェック
+			arcs_assert(0 < Div);		// 分周比は1以上
+			arcs_assert(Ofs < Div);		// 位相オフセットは分周比未満
+			Divisor[i] = Div;
+			Offset[i] = Ofs;
+			Func[i] = Function;
+			SeedTimePrev(i);
+		}
+		
+		//! @brief 各フレームで実行されるグループの数がなるべく均等になるように位相オフセットを決める関数
+		//! グループ番号の小さい順に，それまでに決めたグループとの重なりが最も少ない位相オフセットを選んでいく。
+		void SpreadOffsets(void){
+			// 全グループの周期の最小公倍数(ハイパーピリオド)にわたってフレームごとの実行数を数える
+			unsigned long Hyper = 1;
+			for(size_t i = 0; i < N; ++i) Hyper = std::lcm(Hyper, Divisor[i]);
+			std::vector<unsigned long> Load(Hyper, 0);
+			
+			for(size_t i = 0; i < N; ++i){
+				// それまでのグループと重なる数の最大値が最も小さい位相オフセットを探す (同じなら合計が小さい方)
+				unsigned long BestOfs = 0, BestMax = Hyper, BestSum = Hyper;
+				for(unsigned long ofs = 0; ofs < Divisor[i]; ++ofs){
+					unsigned long Max = 0, Sum = 0;
+					for(unsigned long k = ofs; k < Hyper; k += Divisor[i]){
+						Max = std::max(Max, Load[k]);
+						Sum += Load[k];
+					}
+					if(Max < BestMax || (Max == BestMax && Sum < BestSum)){
+						BestOfs = ofs;
+						BestMax = Max;
+						BestSum = Sum;
+					}
+				}
+				Offset[i] = BestOfs;
+				SeedTimePrev(i);
+				for(unsigned long k = BestOfs; k < Hyper; k += Divisor[i]) ++Load[k];
+			}
+		}
+		
+		//! @brief フレーム番号と計測値をリセットする関数 (リアルタイムスレッドの停止中に呼ぶこと)
+		void Reset(void){
+			Frame = 0;
+			for(size_t i = 0; i < N; ++i) SeedTimePrev(i);
+			CompTime.fill(0);
+			MaxCompTime.fill(0);
+		}
+		
+		//! @brief 今のマイナーフレームで実行すべきレートグループを実行する関数 (基本周期ごとにリアルタイムスレッドから呼ぶこと)
+		//! @param[in]	t		[s] 時刻
+		//! @param[in]	Tact	[s] 計測周期 (使用しない，SFthread の関数オブジェクトと引数を合わせるためのもの)
+		//! @param[in]	Tcmp	[s] 消費時間 (使用しない，同上)
+		//! @return	クロックオーバーライドフラグ (どれかのグループが false を返したら false)
+		bool Execute(const double t, [[maybe_unused]] const double Tact, [[maybe_unused]] const double Tcmp){
+			bool ret = true;
+			timespec Start, End;
+			for(size_t i = 0; i < N; ++i){
+				if(Frame % Divisor[i] != Offset[i] || !Func[i]) continue;	// このフレームの担当でなければ飛ばす
+				clock_gettime(CLOCK_MONOTONIC, &Start);
+				ret &= Func[i](t, t - TimePrev[i], CompTime[i]);	// グループの関数を実行
+				clock_gettime(CLOCK_MONOTONIC, &End);
+				TimePrev[i] = t;
+				CompTime[i] = (End.tv_sec - Start.tv_sec) + (End.tv_nsec - Start.tv_nsec)*1e-9;
+				MaxCompTime[i] = std::max(MaxCompTime[i], CompTime[i]);
+			}
+			++Frame;
+			return ret;
+		}
+		
+		//! @brief 現在のフレーム番号を返す関数
+		//! @return	フレーム番号
+		unsigned long GetFrame(void) const {
+			return Frame;
+		}
+		
+		//! @brief レートグループの位相オフセットを返す関数
+		//! @param[in]	i	グループ番号
+		//! @return	[-] 位相オフセット
+		unsigned long GetOffset(const size_t i) const {
+			arcs_assert(i < N);	// 範囲チェック
+			return Offset[i];
+		}
+		
+		//! @brief レートグループの周期を返す関数
+		//! @param[in]	i	グループ番号
+		//! @return	[s] 周期
+		double GetPeriod(const size_t i) const {
+			arcs_assert(i < N);	// 範囲チェック
+			return Divisor[i]*Ts*1e-9;
+		}
+		
+		//! @brief レートグループの直近の消費時間を返す関数 (リアルタイムスレッドから呼ぶか，停止中に呼ぶこと)
+		//! @param[in]	i	グループ番号
+		//! @return	[s] 消費時間
+		double GetCompTime(const size_t i) const {
+			arcs_assert(i < N);	// 範囲チェック
+			return CompTime[i];
+		}
+		
+		//! @brief レートグループの消費時間の最大値を返す関数 (リアルタイムスレッドから呼ぶか，停止中に呼ぶこと)
+		//! @param[in]	i	グループ番号
+		//! @return	[s] 消費時間の最大値
+		double GetMaxCompTime(const size_t i) const {
+			arcs_assert(i < N);	// 範囲チェック
+			return MaxCompTime[i];
+		}
+	
+	private:
+		MultiRateScheduler(const MultiRateScheduler&) = delete;					//!< コピーコンストラクタ使用禁止
+		const MultiRateScheduler& operator=(const MultiRateScheduler&) = delete;//!< 代入演算子使用禁止
+		
+		unsigned long Ts;										//!< [ns] 基本周期
+		unsigned long Frame;									//!< [-] フレーム番号
+		std::array<unsigned long, N> Divisor;					//!< [-] 分周比
+		std::array<unsigned long, N> Offset;					//!< [-] 位相オフセット
+		std::array<std::function<bool(double,double,double)>, N> Func;	//!< 制御用関数
+		std::array<double, N> TimePrev;							//!< [s] 前回の実行時刻
+		std::array<double, N> CompTime;							//!< [s] 直近の消費時間
+		std::array<double, N> MaxCompTime;						//!< [s] 消費時間の最大値
+		
+		//! @brief レートグループの前回の実行時刻を設定する関数
+		//! 次にグループを実行するフレームの時刻からグループの周期を引いた時刻にして，最初の計測周期がグループの周期になるようにする。
+		//! @param[in]	i	グループ番号
+		void SeedTimePrev(const size_t i){
+			const unsigned long Next = Frame + (Offset[i] + Divisor[i] - Frame % Divisor[i]) % Divisor[i];	// 次に実行するフレーム番号
+			TimePrev[i] = ((double)Next - (double)Divisor[i])*Ts*1e-9;
+		}
+};
+}
+
+#endif
+
@@ -3,10 +3,10 @@
 //!
 //! 任意の制御対象の状態空間モデルからオブザーバを構成して，入出力信号から状態ベクトルを推定する。
 //!
-//! @date 2020/04/06
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -43,7 +43,7 @@ namespace ARCS {	// ARCS名前空間
 			{
 				PassedLog();
 			}
-
+			
 			//! @brief ムーブコンストラクタ
 			//! @param[in]	r	右辺値
 			Observer(Observer&& r)
@@ -51,7 +51,7 @@ namespace ARCS {	// ARCS名前空間
 			{
 				
 			}
-
+			
 			//! @brief デストラクタ
 			~Observer(){
 				PassedLog();
@@ -66,8 +66,8 @@ namespace ARCS {	// ARCS名前空間
 			void SetPlantModelAndGain(const Matrix<N,N>& A, const Matrix<1,N>& b, const Matrix<N,1>& c, const Matrix<1,N>& k, const double Ts){
 				const Matrix<N,N> Ao = A - k*c;			// オブザーバの連続系A行列
 				Matrix<2,N> Bo;							// オブザーバの連続系B行列
-				setcolumn(Bo, b, 1);					// オブザーバの連続系B行列1列目
-				setcolumn(Bo, k, 2);					// オブザーバの連続系B行列2列目
+				columnview(Bo, 1) = b;					// オブザーバの連続系B行列1列目
+				columnview(Bo, 2) = k;					// オブザーバの連続系B行列2列目
 				const auto Co = Matrix<N,N>::eye();		// オブザーバの出力行列
 				ObsrvSys.SetContinuous(Ao, Bo, Co, Ts);	// オブザーバの状態空間モデルを設定
 			}
@@ -76,16 +76,18 @@ namespace ARCS {	// ARCS名前空間
 			//! @param[in]	u	オブザーバの入力ベクトル
 			//! @param[out]	xhat	推定状態ベクトル
 			void Estimate(const Matrix<1,2>& u, Matrix<1,N>& xhat){
-				ObsrvSys.GetResponses(u, xhat);			// 推定演算
+				ObsrvSys.GetStateResponses(u, xhat);	// 推定演算 (出力行列は単位行列なので行列積を省略)
 			}
 			
 			//! @brief 状態推定の計算をして状態ベクトルを返す関数(ベクトルを返す版)
 			//! @param[in]	u	オブザーバの入力ベクトル
 			//! @return 推定状態ベクトル
 			Matrix<1,N> Estimate(const Matrix<1,2>& u){
-				return ObsrvSys.GetResponses(u);		// 推定演算
+				Matrix<1,N> xhat;	// 推定状態ベクトル
+				Estimate(u, xhat);	// 推定演算
+				return xhat;		// 推定状態ベクトルを返す
 			}
-			
+		
 		private:
 			Observer(const Observer&) = delete;					//!< コピーコンストラクタ使用禁止
 			const Observer& operator=(const Observer&) = delete;//!< 代入演算子使用禁止
@@ -75,10 +75,8 @@ namespace ARCS {	// ARCS名前空間
 			//! @param[out]	Y	乱数行列
 			template <size_t N, size_t M>
 			void GetRandomMatrix(Matrix<N,M>& Y){
-				for(size_t n = 1; n <= N; ++n){
-					for(size_t m = 1; m <= M; ++m){
-						Y.SetElement(n, m, GetDoubleRandom());	// 行列の各要素に乱数値を書き込む
-					}
+				for(size_t n = 0; n < N; ++n){
+					for(size_t m = 0; m < M; ++m) Y.Data[n][m] = GetDoubleRandom();	// 列ごとに連続した格納順に乱数値を書き込む
 				}
 			}
 
@@ -86,10 +84,8 @@ namespace ARCS {	// ARCS名前空間
 			//! @param[out]	Y	乱数行列
 			template <size_t N, size_t M>
 			void GetGaussianRandomMatrix(Matrix<N,M>& Y){
-				for(size_t n = 1; n <= N; ++n){
-					for(size_t m = 1; m <= M; ++m){
-						Y.SetElement(n, m, GetGaussianRandom());// 行列の各要素に乱数値を書き込む
-					}
+				for(size_t n = 0; n < N; ++n){
+					for(size_t m = 0; m < M; ++m) Y.Data[n][m] = GetGaussianRandom();	// 列ごとに連続した格納順に乱数値を書き込む
 				}
 			}
 			
@@ -3,10 +3,10 @@
 //!
 //! pthreadのSCHED_FIFOで実時間スレッドを生成＆管理＆破棄する。実際に計測された制御周期や計算消費時間も提供する。
 //!
-//! @date 2021/07/08
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2021 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -14,18 +14,26 @@
 #ifndef SFTHREADING
 #define SFTHREADING
 
+#include <cassert>
 #include <sys/mman.h>
 #include <sys/time.h>
 #include <time.h>
 #include <unistd.h>
 #include <pthread.h>
+#include <sched.h>
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <type_traits>
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <fstream>
 #include <iostream>
 #include "CPUSettings.hh"
 #include "LinuxCommander.hh"
+#include "SeqLock.hh"
+#include "LatencyHistogram.hh"
 
 // ARCS組込み用マクロ
 #ifdef ARCS_IN
@@ -46,15 +54,52 @@ namespace ARCS {	// ARCS名前空間
 //! 時間ゼロのスリープを入れるとLinuxが安定動作できるが，リアルタイム性は犠牲になる。
 //! 古い低速の処理系では INSERT_ZEROSLEEP を推奨する。
 //! 新しい高速の処理系では WITHOUT_ZEROSLEEP に設定するとリアルタイム性が改善する。
+//! 上記2つは次の周期まで clock_gettime で待ち続けるのでCPUコアの使用率が常に100%になる。
+//! SLEEP_AND_SPIN は次の周期の少し手前まで clock_nanosleep で眠ってから残りを待つので，
+//! 消費時間が短いときはCPUコアが休めて発熱やSMTの相方のコアへの影響が減る。
+//! 起床の遅れから手前の余裕時間を自動で調整するので，ジッタは WITHOUT_ZEROSLEEP に近くなる。
+//! DEADLINE_YIELD は SCHED_DEADLINE で1周期あたりの実行時間をカーネルに保証させ，計算が終わったら sched_yield で次の周期まで眠る。
+//! 待機中にCPUコアを一切使わず，実行時間を超えたスレッドはカーネルが止めるので，複数の制御ループが安全に1つのCPUコアを共有できる。
+//! root権限が無いなどで SCHED_DEADLINE に設定できないときは，SCHED_FIFO の SLEEP_AND_SPIN として動作する。
 enum class SFalgorithm {
 	INSERT_ZEROSLEEP,	//!< リアルタイムループに時間ゼロのスリープを入れる
-	WITHOUT_ZEROSLEEP	//!< スリープは一切入れない
+	WITHOUT_ZEROSLEEP,	//!< スリープは一切入れない
+	SLEEP_AND_SPIN,		//!< 次の周期の少し手前までスリープしてから残りを待つ
+	DEADLINE_YIELD		//!< SCHED_DEADLINE で動作して周期の終わりに sched_yield で眠る
 };
 
+//! @brief 周期超過(消費時間が次の周期の開始時刻を過ぎること)のときの動作の定義
+//! 解説：
+//! 周期の開始時刻はスレッド開始時の初期時刻を基準とした絶対時刻で予定するので，周期超過しても位相はずれない。
+//! SKIP は過ぎてしまった周期を飛ばして，次に間に合う周期の開始時刻まで待つ。
+//! CATCH_UP は過ぎてしまった周期を待たずに続けて実行して遅れを取り戻す。(計算が重い状態が続くと遅れが溜まるので注意)
+//! DEGRADE は縮退動作用の関数を呼んでから SKIP と同様に動作する。
+//! SCHED_DEADLINE で動作中の DEADLINE_YIELD では周期をカーネルが管理するので，これらの動作は適用されず，
+//! 周期超過の回数を数えて上限で緊急停止することと，開始時刻の遅れの計測用に過ぎた周期を飛ばすことだけを行う。
+enum class SFoverrun {
+	SKIP,		//!< 過ぎた周期を飛ばす
+	CATCH_UP,	//!< 過ぎた周期を続けて実行して追いつく
+	DEGRADE		//!< 縮退動作用の関数を呼んでから過ぎた周期を飛ばす
+};
+
+//! @brief 制御用実行関数の標準の型 引数(時刻 [s], 計測周期 [s], 消費時間 [s])，戻り値 false でクロックオーバーライド
+using SFfunction = std::function<bool(double,double,double)>;
+
 //! @brief 実時間スレッド生成・破棄クラス
+//! 制御用実行関数の型 F を SFfunction 以外(ラムダ式の型など)にすると，std::function を経由せずに直接呼ぶので
+//! 制御用実行関数が RealTimeLoop の中にインライン展開できるようになり，引数も実数に変換せずに std::chrono::nanoseconds で渡す。
+//! 単位を型で区別するので，[s] 単位の実数を受け取る関数を渡すとコンパイルエラーになる。
+//! 例： auto Func = [&](std::chrono::nanoseconds t, std::chrono::nanoseconds Tact, std::chrono::nanoseconds Tcmp){ ...; return true; };
+//!      SFthread<SFalgorithm::SLEEP_AND_SPIN, decltype(Func)> Thread(Ts, Func, CPU);
 //! @tparam	SFA	リアルタイムアルゴリズムのタイプ
-template <SFalgorithm SFA = SFalgorithm::INSERT_ZEROSLEEP>
+//! @tparam	F	制御用実行関数の型 (SFfunction 以外のときは 引数(時刻, 計測周期, 消費時間) を std::chrono::nanoseconds で受け取って bool を返すこと)
+template <SFalgorithm SFA = SFalgorithm::INSERT_ZEROSLEEP, typename F = SFfunction>
 class SFthread {
+	static_assert(
+		std::is_same_v<F, SFfunction> || std::is_invocable_r_v<bool, F&, std::chrono::nanoseconds, std::chrono::nanoseconds, std::chrono::nanoseconds>,
+		"SFthread: F must be SFfunction or callable as bool(std::chrono::nanoseconds, std::chrono::nanoseconds, std::chrono::nanoseconds)"
+	);
+	
 	public:
 		//! @brief 動作状態の定義
 		enum ThreadState {
@@ -66,11 +111,23 @@ class SFthread {
 			SFID_DSTRCT	//!< スレッド破棄
 		};
 		
+		//! @brief 計測された時間情報 (リアルタイムスレッドが毎周期の終わりに公開する)
+		struct TimingInfo {
+			double Time;			//!< [s] 時刻
+			double SmplTime;		//!< [s] 計測周期
+			double CompTime;		//!< [s] 消費時間
+			double MaxTime;			//!< [s] 計測周期の最大値
+			double MinTime;			//!< [s] 計測周期の最小値
+			double SpinMargin;		//!< [s] スピン待機の余裕時間 (SLEEP_AND_SPIN用)
+			double WakeupLatency;	//!< [s] 直近のスリープからの起床遅れ (SLEEP_AND_SPIN用)
+			unsigned long Overruns;	//!< 消費時間が制御周期を超えた回数
+		};
+		
 		//! @brief コンストラクタ
 		//! @param[in] PeriodTime	制御周期
 		//! @param[in] FuncObject	制御用実行関数の関数オブジェクト
-		//! @param[in] CPUno		使用するCPUコアの番号
-		SFthread(const unsigned long PeriodTime, const std::function<bool(double,double,double)>& FuncObject, const int CPUno)
+		//! @param[in] CPUno		使用するCPUコアの番号 (DEADLINE_YIELD のときは SCHED_FIFO で動作する場合のみ有効)
+		SFthread(const unsigned long PeriodTime, const F& FuncObject, const int CPUno)
 			: SyncMutex(PTHREAD_MUTEX_INITIALIZER),	// 同期用Mutex
 			  SyncCond(PTHREAD_COND_INITIALIZER),	// 同期用条件
 			  StateFlag(SFID_STOP),		// 動作状態フラグを「停止状態」に設定
@@ -81,15 +138,35 @@ class SFthread {
 			  ComputationTime(),		// 消費時間の初期化
 			  ThreadID(0),				// スレッド識別子の初期化
 			  ThreadParam(),			// スレッドパラメータ
+			  CPUnum(CPUno),			// 使用するCPUコアの番号
 			  MaxMemo(0),				// サンプリング時間最大値計算用
-			  MinMemo(PeriodTime*1e-9)	// サンプリング時間最小値計算用
+			  MinMemo(PeriodTime*1e-9),	// サンプリング時間最小値計算用
+			  SpinMargin(INIT_SPIN_MARGIN),	// スピン待機の余裕時間の初期化
+			  AutoSpinMargin(true),		// スピン待機の余裕時間は自動調整
+			  WakeupLatency(0),			// 起床遅れの初期化
+			  WakeupLatencyPeak(0),		// 起床遅れのピーク値の初期化
+			  StartLatencyHist(),		// 開始時刻の遅れのヒストグラムの初期化
+			  PeriodHist(),				// 計測周期のヒストグラムの初期化
+			  CompTimeHist(),			// 消費時間のヒストグラムの初期化
+			  Overruns(0),				// 周期超過の回数の初期化
+			  ConsecutiveOverruns(0),	// 連続した周期超過の回数の初期化
+			  OverrunPolicy(SFoverrun::SKIP),	// 周期超過のときは過ぎた周期を飛ばす
+			  DegradedFunc(),			// 縮退動作用の関数の初期化
+			  OverrunLimit(0),			// 連続した周期超過の上限は無効
+			  DeadlineRuntime(PeriodTime/2),	// SCHED_DEADLINE の実行時間は制御周期の半分
+			  DeadlineActive(false),	// SCHED_DEADLINE で動作中かどうか
+			  Timing()					// 公開用の時間情報の初期化
 		{
 			// 実時間スレッドの生成と優先度の設定
 			PassedLog();
 			if constexpr(SFA == SFalgorithm::INSERT_ZEROSLEEP){
 				EventLog("INSERT_ZEROSLEEP MODE.");
-			}else{
+			}else if constexpr(SFA == SFalgorithm::WITHOUT_ZEROSLEEP){
 				EventLog("WITHOUT_ZEROSLEEP MODE.");
+			}else if constexpr(SFA == SFalgorithm::SLEEP_AND_SPIN){
+				EventLog("SLEEP_AND_SPIN MODE.");
+			}else{
+				EventLog("DEADLINE_YIELD MODE.");
 			}
 			pthread_mutex_init(&SyncMutex, nullptr);	// 同期用Mutexの初期化
 			pthread_cond_init(&SyncCond, nullptr);		// 同期用条件の初期化
@@ -101,7 +178,7 @@ class SFthread {
 		
 		//! @brief コンストラクタ(制御用実行関数の関数オブジェクトを後で設定する場合)
 		//! @param[in] PeriodTime	制御周期
-		//! @param[in] CPUno		使用するCPUコアの番号
+		//! @param[in] CPUno		使用するCPUコアの番号 (DEADLINE_YIELD のときは SCHED_FIFO で動作する場合のみ有効)
 		SFthread(const unsigned long PeriodTime, const int CPUno)
 			: SyncMutex(PTHREAD_MUTEX_INITIALIZER),	// 同期用Mutex
 			  SyncCond(PTHREAD_COND_INITIALIZER),	// 同期用条件
@@ -113,15 +190,35 @@ class SFthread {
 			  ComputationTime(),		// 消費時間の初期化
 			  ThreadID(0),				// スレッド識別子の初期化
 			  ThreadParam(),			// スレッドパラメータ
+			  CPUnum(CPUno),			// 使用するCPUコアの番号
 			  MaxMemo(0),				// サンプリング時間最大値計算用
-			  MinMemo(PeriodTime*1e-9)	// サンプリング時間最小値計算用
+			  MinMemo(PeriodTime*1e-9),	// サンプリング時間最小値計算用
+			  SpinMargin(INIT_SPIN_MARGIN),	// スピン待機の余裕時間の初期化
+			  AutoSpinMargin(true),		// スピン待機の余裕時間は自動調整
+			  WakeupLatency(0),			// 起床遅れの初期化
+			  WakeupLatencyPeak(0),		// 起床遅れのピーク値の初期化
+			  StartLatencyHist(),		// 開始時刻の遅れのヒストグラムの初期化
+			  PeriodHist(),				// 計測周期のヒストグラムの初期化
+			  CompTimeHist(),			// 消費時間のヒストグラムの初期化
+			  Overruns(0),				// 周期超過の回数の初期化
+			  ConsecutiveOverruns(0),	// 連続した周期超過の回数の初期化
+			  OverrunPolicy(SFoverrun::SKIP),	// 周期超過のときは過ぎた周期を飛ばす
+			  DegradedFunc(),			// 縮退動作用の関数の初期化
+			  OverrunLimit(0),			// 連続した周期超過の上限は無効
+			  DeadlineRuntime(PeriodTime/2),	// SCHED_DEADLINE の実行時間は制御周期の半分
+			  DeadlineActive(false),	// SCHED_DEADLINE で動作中かどうか
+			  Timing()					// 公開用の時間情報の初期化
 		{
 			// 実時間スレッドの生成と優先度の設定
 			PassedLog();
 			if constexpr(SFA == SFalgorithm::INSERT_ZEROSLEEP){
 				EventLog("INSERT_ZEROSLEEP MODE.");
-			}else{
+			}else if constexpr(SFA == SFalgorithm::WITHOUT_ZEROSLEEP){
 				EventLog("WITHOUT_ZEROSLEEP MODE.");
+			}else if constexpr(SFA == SFalgorithm::SLEEP_AND_SPIN){
+				EventLog("SLEEP_AND_SPIN MODE.");
+			}else{
+				EventLog("DEADLINE_YIELD MODE.");
 			}
 			pthread_mutex_init(&SyncMutex, nullptr);	// 同期用Mutexの初期化
 			pthread_cond_init(&SyncCond, nullptr);		// 同期用条件の初期化
@@ -144,8 +241,24 @@ class SFthread {
 			ComputationTime(r.ComputationTime),	// 消費時間
 			ThreadID(r.ThreadID),				// スレッド識別子
 			ThreadParam(r.ThreadParam),			// スレッドパラメータ
+			CPUnum(r.CPUnum),					// 使用するCPUコアの番号
 			MaxMemo(r.MaxMemo),					// サンプリング時間最大値計算用
-			MinMemo(r.MinMemo)					// サンプリング時間最小値計算用
+			MinMemo(r.MinMemo),					// サンプリング時間最小値計算用
+			SpinMargin(r.SpinMargin),			// スピン待機の余裕時間
+			AutoSpinMargin(r.AutoSpinMargin),	// スピン待機の余裕時間の自動調整フラグ
+			WakeupLatency(r.WakeupLatency),		// 起床遅れ
+			WakeupLatencyPeak(r.WakeupLatencyPeak),	// 起床遅れのピーク値
+			StartLatencyHist(r.StartLatencyHist),	// 開始時刻の遅れのヒストグラム
+			PeriodHist(r.PeriodHist),			// 計測周期のヒストグラム
+			CompTimeHist(r.CompTimeHist),		// 消費時間のヒストグラム
+			Overruns(r.Overruns),				// 周期超過の回数
+			ConsecutiveOverruns(r.ConsecutiveOverruns),	// 連続した周期超過の回数
+			OverrunPolicy(r.OverrunPolicy),		// 周期超過のときの動作
+			DegradedFunc(r.DegradedFunc),		// 縮退動作用の関数
+			OverrunLimit(r.OverrunLimit),		// 連続した周期超過の上限
+			DeadlineRuntime(r.DeadlineRuntime),	// SCHED_DEADLINE の実行時間
+			DeadlineActive(r.DeadlineActive.load()),	// SCHED_DEADLINE で動作中かどうか
+			Timing(r.Timing.Read())				// 公開用の時間情報
 		{
 			
 		}
@@ -164,7 +277,7 @@ class SFthread {
 		
 		//! @brief 実時間スレッドから呼び出す関数を設定する関数
 		//! @param[in]	FuncObject	関数オブジェクト
-		void SetRealtimeFunction(std::function<bool(double,double,double)> FuncObject){
+		void SetRealtimeFunction(const F& FuncObject){
 			FuncObj = FuncObject;	// 関数オブジェクトをセット
 		}
 		
@@ -208,13 +321,59 @@ class SFthread {
 			EventLog("Waiting for SFID_EXCMPL...Done");
 		}
 		
-		//! @brief スレッドをリセットする関数
+		//! @brief スレッドをリセットする関数 (スレッドの停止中に呼ぶこと)
 		void Reset(void){
 			timespec_clear(Time);			// 時刻をクリア
 			timespec_clear(ActPeriodicTime);// 実際の周期時間をクリア
 			timespec_clear(ComputationTime);// 消費時間をクリア
 			MaxMemo = 0;		// 計測周期最大値をクリア
 			MinMemo = Ts*1e-9;	// 計測周期最小値をクリア
+			WakeupLatency = 0;		// 起床遅れをクリア
+			WakeupLatencyPeak = 0;	// 起床遅れのピーク値をクリア
+			StartLatencyHist.Reset();	// 開始時刻の遅れのヒストグラムをクリア
+			PeriodHist.Reset();			// 計測周期のヒストグラムをクリア
+			CompTimeHist.Reset();		// 消費時間のヒストグラムをクリア
+			Overruns = 0;				// 周期超過の回数をクリア
+			ConsecutiveOverruns = 0;	// 連続した周期超過の回数をクリア
+			PublishTiming();		// クリアした時間情報を公開
+		}
+		
+		//! @brief スピン待機の余裕時間を設定する関数 (SLEEP_AND_SPIN のときのみ有効)
+		//! 次の周期の開始時刻よりも Margin だけ手前まで眠り，そこからは clock_gettime で待つ。
+		//! @param[in]	Margin	[ns] 余裕時間
+		//! @param[in]	AutoTune	true = 起床遅れから余裕時間を自動調整する(Marginは初期値になる), false = 固定
+		void SetSpinMargin(const unsigned long Margin, const bool AutoTune){
+			SpinMargin = Margin;
+			AutoSpinMargin = AutoTune;
+		}
+		
+		//! @brief 周期超過のときの動作を設定する関数 (スレッドの停止中に呼ぶこと)
+		//! DEADLINE_YIELD で SCHED_DEADLINE に切り替わったときは適用されない。(SCHED_FIFO で動作するときのみ有効)
+		//! @param[in]	Policy	周期超過のときの動作
+		void SetOverrunPolicy(const SFoverrun Policy){
+			OverrunPolicy = Policy;
+		}
+		
+		//! @brief 縮退動作用の関数を設定する関数 (スレッドの停止中に呼ぶこと，SFoverrun::DEGRADE のときのみ有効)
+		//! 周期超過するたびにリアルタイムスレッドから呼ばれるので，関数の中ではメモリ確保などの時間の掛かる処理はしないこと。
+		//! @param[in]	Func	縮退動作用の関数 引数(連続した周期超過の回数)
+		void SetDegradedFunction(const std::function<void(unsigned long)>& Func){
+			DegradedFunc = Func;
+		}
+		
+		//! @brief 連続した周期超過の上限を設定する関数 (スレッドの停止中に呼ぶこと)
+		//! Limit 回連続で周期超過すると arcs_assert で緊急停止する。
+		//! @param[in]	Limit	連続した周期超過の上限 (0 = 無効)
+		void SetOverrunLimit(const unsigned long Limit){
+			OverrunLimit = Limit;
+		}
+		
+		//! @brief SCHED_DEADLINE で保証させる1周期あたりの実行時間を設定する関数 (スレッドの停止中に呼ぶこと，DEADLINE_YIELD のときのみ有効)
+		//! 次に Start() したときに反映される。全スレッドの 実行時間/制御周期 の合計がカーネルの許容量を超えると SCHED_FIFO で動作する。
+		//! @param[in]	Runtime	[ns] 実行時間 (0 < Runtime ≦ 制御周期)
+		void SetDeadlineRuntime(const unsigned long Runtime){
+			arcs_assert(0 < Runtime && Runtime <= Ts);	// 範囲チェック
+			DeadlineRuntime = Runtime;
 		}
 		
 		//! @brief スレッドを強制破壊する関数
@@ -223,44 +382,101 @@ class SFthread {
 			pthread_join(ThreadID, nullptr);// 実時間スレッド終了待機
 		}
 		
+		//! @brief 計測された時間情報をまとめて取得する関数
+		//! リアルタイムスレッドが同じ周期に計測した一貫した値が得られる。リアルタイムスレッドを待たせることはない。
+		//! @return 時間情報
+		TimingInfo GetTimingInfo(void) const {
+			return Timing.Read();
+		}
+		
 		//! @brief 時刻を取得する関数
 		//! @return 時刻 [s]
 		double GetTime(void) const {
-			return timespec_to_sec(Time);			// [s] 時刻に変換して返す
+			return Timing.Read().Time;
 		}
 		
 		//! @brief 計測された実際のサンプリング時間を取得する関数
 		//! @return 計測周期 [s]
 		double GetSmplTime(void) const {
-			return timespec_to_sec(ActPeriodicTime);// [s] 時刻に変換して返す
+			return Timing.Read().SmplTime;
 		}
 		
 		//! @brief 計測された消費時間を取得する関数
 		//! @return 計測消費時間 [s]
 		double GetCompTime(void) const {
-			return timespec_to_sec(ComputationTime);// [s] 時刻に変換して返す
+			return Timing.Read().CompTime;
 		}
 		
 		//! @brief 計測された実際のサンプリング時間の最大値を取得する関数
 		//! @return 計測最大サンプリング時間 [s]
-		double GetMaxTime(void){
-			double TsZ0 = GetSmplTime();	// [s] 今のサンプリング時間を取得
-			if(MaxMemo < TsZ0){
-				MaxMemo = TsZ0;
-			}
-			return MaxMemo;
+		double GetMaxTime(void) const {
+			return Timing.Read().MaxTime;
 		}
 		
 		//! @brief 計測された実際のサンプリング時間の最小値を取得する関数
 		//! @return 計測最小サンプリング時間 [s]
-		double GetMinTime(void){
-			double TsZ0 = GetSmplTime();	// [s] 今のサンプリング時間を取得
-			if(TsZ0 < MinMemo && 1e-6 < TsZ0){
-				MinMemo = TsZ0;
-			}
-			return MinMemo;
+		double GetMinTime(void) const {
+			return Timing.Read().MinTime;
+		}
+		
+		//! @brief 現在のスピン待機の余裕時間を取得する関数
+		//! @return スピン待機の余裕時間 [s]
+		double GetSpinMargin(void) const {
+			return Timing.Read().SpinMargin;
+		}
+		
+		//! @brief 計測された直近のスリープからの起床遅れを取得する関数 (SLEEP_AND_SPIN のときのみ有効)
+		//! @return 起床遅れ [s]
+		double GetWakeupLatency(void) const {
+			return Timing.Read().WakeupLatency;
+		}
+		
+		//! @brief 消費時間が制御周期を超えた回数を取得する関数
+		//! @return 周期超過の回数
+		unsigned long GetOverruns(void) const {
+			return Timing.Read().Overruns;
+		}
+		
+		//! @brief SCHED_DEADLINE で動作しているかどうかを取得する関数 (DEADLINE_YIELD のときのみ有効)
+		//! @return true = SCHED_DEADLINE で動作中，false = SCHED_FIFO で動作中
+		bool IsDeadlineActive(void) const {
+			return DeadlineActive.load(std::memory_order_relaxed);
 		}
 		
+		//! @brief 開始時刻の目標時刻からの遅れ(起床遅れ)のヒストグラムを取得する関数
+		//! @return ヒストグラム [ns]
+		const LatencyHistogram& GetStartLatencyHist(void) const {
+			return StartLatencyHist;
+		}
+		
+		//! @brief 計測周期のヒストグラムを取得する関数
+		//! @return ヒストグラム [ns]
+		const LatencyHistogram& GetPeriodHist(void) const {
+			return PeriodHist;
+		}
+		
+		//! @brief 消費時間のヒストグラムを取得する関数
+		//! @return ヒストグラム [ns]
+		const LatencyHistogram& GetCompTimeHist(void) const {
+			return CompTimeHist;
+		}
+		
+		//! @brief 開始時刻の遅れ，計測周期，消費時間のヒストグラムをCSVファイルに書き出す関数
+		//! 1列目と2列目がバケットの下限値と上限値 [ns] で，3列目以降がそれぞれの個数。どれも零のバケットは省略する。
+		//! @param[in]	FileName	CSVファイル名
+		void WriteHistogramCsv(const std::string& FileName) const {
+			std::ofstream CsvFile(FileName);
+			CsvFile << "Lower[ns],Upper[ns],StartLatency,Period,Computation" << std::endl;
+			for(size_t i = 0; i < LatencyHistogram::BUCKETS; ++i){
+				const uint64_t Latency = StartLatencyHist.GetBucketCount(i);
+				const uint64_t Period = PeriodHist.GetBucketCount(i);
+				const uint64_t Computation = CompTimeHist.GetBucketCount(i);
+				if(Latency == 0 && Period == 0 && Computation == 0) continue;
+				CsvFile << LatencyHistogram::GetLowerBound(i) << "," << LatencyHistogram::GetUpperBound(i) << ","
+						<< Latency << "," << Period << "," << Computation << "\n";
+			}
+		}
+	
 	private:
 		SFthread(const SFthread&) = delete;					//!< コピーコンストラクタ使用禁止
 		const SFthread& operator=(const SFthread&) = delete;//!< 代入演算子使用禁止
@@ -270,14 +486,35 @@ class SFthread {
 		pthread_cond_t	SyncCond;							//!< 同期用条件
 		enum ThreadState StateFlag;							//!< 動作状態フラグ
 		const unsigned long Ts;								//!< 制御周期
-		std::function<bool(double,double,double)> FuncObj;	//!< 関数オブジェクト 引数(時刻, 計測周期, 消費時間)
-		timespec Time;										//!< 計測された実際の時刻
-		timespec ActPeriodicTime;							//!< 計測された実際の周期時間
-		timespec ComputationTime;							//!< 計算によって消費された時間 (つまり ComputationTime < ActPeriodicTime でなければならない)
+		F FuncObj;											//!< 関数オブジェクト 引数(時刻, 計測周期, 消費時間)
+		timespec Time;										//!< 計測された実際の時刻 (リアルタイムスレッド専用)
+		timespec ActPeriodicTime;							//!< 計測された実際の周期時間 (リアルタイムスレッド専用)
+		timespec ComputationTime;							//!< 計算によって消費された時間 (つまり ComputationTime < ActPeriodicTime でなければならない，リアルタイムスレッド専用)
 		pthread_t ThreadID;									//!< スレッド識別子
 		struct sched_param ThreadParam;						//!< スレッドパラメータ
-		double MaxMemo;										//!< [s] サンプリング時間最大値計算用
-		double MinMemo;										//!< [s] サンプリング時間最小値計算用
+		const int CPUnum;									//!< 使用するCPUコアの番号
+		double MaxMemo;										//!< [s] サンプリング時間最大値計算用 (リアルタイムスレッド専用)
+		double MinMemo;										//!< [s] サンプリング時間最小値計算用 (リアルタイムスレッド専用)
+		long SpinMargin;									//!< [ns] スピン待機の余裕時間 (SLEEP_AND_SPIN用)
+		bool AutoSpinMargin;								//!< スピン待機の余裕時間の自動調整フラグ (SLEEP_AND_SPIN用)
+		long WakeupLatency;									//!< [ns] 直近のスリープからの起床遅れ (SLEEP_AND_SPIN用)
+		long WakeupLatencyPeak;								//!< [ns] 起床遅れのピーク値 (ゆっくり減衰させる，SLEEP_AND_SPIN用)
+		LatencyHistogram StartLatencyHist;					//!< 開始時刻の目標時刻からの遅れ(起床遅れ)のヒストグラム
+		LatencyHistogram PeriodHist;						//!< 計測周期のヒストグラム
+		LatencyHistogram CompTimeHist;						//!< 消費時間のヒストグラム
+		unsigned long Overruns;								//!< 消費時間が制御周期を超えた回数 (リアルタイムスレッド専用)
+		unsigned long ConsecutiveOverruns;					//!< 連続した周期超過の回数 (リアルタイムスレッド専用)
+		SFoverrun OverrunPolicy;							//!< 周期超過のときの動作
+		std::function<void(unsigned long)> DegradedFunc;	//!< 縮退動作用の関数 引数(連続した周期超過の回数)
+		unsigned long OverrunLimit;							//!< 連続した周期超過の上限 (0 = 無効)
+		unsigned long DeadlineRuntime;						//!< [ns] SCHED_DEADLINE で保証させる1周期あたりの実行時間 (DEADLINE_YIELD用)
+		std::atomic<bool> DeadlineActive;					//!< SCHED_DEADLINE で動作中かどうか (DEADLINE_YIELD用)
+		SeqLock<TimingInfo> Timing;							//!< 他のスレッドへ公開する時間情報
+		
+		static constexpr long INIT_SPIN_MARGIN = 50000;		//!< [ns] スピン待機の余裕時間の初期値
+		static constexpr long MIN_SPIN_MARGIN = 5000;		//!< [ns] スピン待機の余裕時間の最小値
+		static constexpr long SPIN_MARGIN_GAIN = 2;			//!< [-] 起床遅れのピーク値に対する余裕時間の倍率
+		static constexpr long LATENCY_DECAY = 1024;			//!< [-] 起床遅れのピーク値の減衰の時定数 (周期の数)
 		
 		//! @brief リアルタイムループ
 		//! 実際の制御用実行関数はこの関数から呼ばれている
@@ -289,13 +526,20 @@ class SFthread {
 			timespec StartTime = {0};		// 開始時刻格納用
 			timespec StartTimePrev = {0};	// 前回の開始時間格納用
 			timespec EndTime = {0};			// 終了時刻格納用
+			timespec StartLatency = {0};	// 開始時刻の目標時刻からの遅れ
+			bool Scheduled = false;			// 開始時刻が予定されたものかどうか (前回クロックオーバーライドしたときは予定外)
+			bool Overrun = false;			// 周期超過フラグ
 			timespec PreventStuck = {0};	// 「BUG: soft lockup - CPU#0 Stuck for 67s!」を回避するためのスリープ用
 			bool ClockOverride = false;		// 時刻待機のクロックオーバーライドフラグ
+			bool Deadline = false;			// SCHED_DEADLINE で動作中かどうか
 			
 			EventLog("Starting Realtime Loop.");
 			
+			if constexpr(SFA == SFalgorithm::DEADLINE_YIELD) Deadline = EnterDeadlinePolicy();	// SCHED_DEADLINE に切り替え
+			
 			clock_gettime(CLOCK_MONOTONIC, &InitTime);			// 初期開始時刻の取得
 			StartTimePrev = timespec_sub(InitTime, PeriodTime);	// 実際の制御周期計算用の初期値設定
+			NextTime = InitTime;								// 最初の開始時刻の目標値
 			
 			// 実時間ループ
 			while(StateFlag != SFID_STOP){	// 動作状態フラグが「停止」に設定されるまでループ
@@ -303,14 +547,52 @@ class SFthread {
 				clock_gettime(CLOCK_MONOTONIC, &StartTime);							// 開始時刻の取得
 				Time = timespec_sub(StartTime, InitTime);							// 実際の時刻を計算
 				ActPeriodicTime = timespec_sub(StartTime, StartTimePrev);			// 実際の周期時間を計算(timespec構造体は単純に減算できないことに注意)
-				ClockOverride = !FuncObj(GetTime(), GetSmplTime(), GetCompTime());	// 制御用関数の実行(関数オブジェクトにより、ここで実際の制御関数が呼ばれる)
+				StartLatency = timespec_sub(StartTime, NextTime);					// 開始時刻の目標時刻からの遅れを計算
+				Scheduled = !ClockOverride;											// 前回クロックオーバーライドしていなければ予定通りの開始
+				if constexpr(std::is_same_v<F, SFfunction>){
+					ClockOverride = !FuncObj(timespec_to_sec(Time), timespec_to_sec(ActPeriodicTime), timespec_to_sec(ComputationTime));	// 制御用関数の実行(関数オブジェクトにより、ここで実際の制御関数が呼ばれる)
+				}else{
+					ClockOverride = !FuncObj(timespec_to_duration(Time), timespec_to_duration(ActPeriodicTime), timespec_to_duration(ComputationTime));	// 制御用関数の実行(実数に変換せずに渡す，ここにインライン展開される)
+				}
 				StartTimePrev = StartTime;											// 次回用に今回の開始時刻を格納
-				NextTime = timespec_add(StartTime, PeriodTime);						// 開始時刻に制御周期を加算して次の時刻を計算
+				if(Scheduled == true){
+					NextTime = timespec_add(NextTime, PeriodTime);					// 予定の開始時刻に制御周期を加算して次の時刻を計算(初期時刻を基準とした絶対時刻なので位相がずれない)
+				}else{
+					NextTime = timespec_add(StartTime, PeriodTime);					// 予定外の開始のときは開始時刻を基準に取り直す
+				}
 				if constexpr(SFA == SFalgorithm::INSERT_ZEROSLEEP){
 					clock_nanosleep(CLOCK_MONOTONIC, 0, &PreventStuck, nullptr);	// 「BUG: soft lockup - CPU#0 Stuck for 67s!」を回避するためのスリープ
 				}
 				clock_gettime(CLOCK_MONOTONIC, &EndTime);							// 終了時刻の取得
 				ComputationTime = timespec_sub(EndTime, StartTime);					// 消費時間を計算(timespec構造体は単純に減算できないことに注意)
+				Overrun = ClockOverride == false && timespec_lessthaneq(NextTime, EndTime);	// 次の時刻を過ぎていたら周期超過
+				if(Overrun == true){
+					if(Deadline == true){
+						CountOverrun();												// SCHED_DEADLINE のときは次の周期をカーネルが決めるので，
+						SkipMissedPeriods(EndTime, NextTime);						// 周期超過のときの動作は適用せず，遅れの計測用の時刻だけ合わせる
+					}else{
+						HandleOverrun(EndTime, PeriodTime, NextTime);				// 周期超過のときの処理
+					}
+				}
+				if(Overrun == false) ConsecutiveOverruns = 0;						// 周期超過が途切れたら連続回数をクリア
+				
+				// 次の時刻の少し手前まで眠る
+				if constexpr(SFA == SFalgorithm::SLEEP_AND_SPIN || SFA == SFalgorithm::DEADLINE_YIELD){
+					if(ClockOverride == false && Deadline == false) SleepUntil(timespec_sub(NextTime, nsec_to_timespec(SpinMargin)), EndTime);
+				}
+				
+				// 計測した時間情報を記録して他のスレッドへ公開
+				UpdateMaxMinTime();
+				RecordHistograms(Scheduled, Overrun, StartLatency);
+				PublishTiming();
+				
+				// SCHED_DEADLINE のときは今の周期の残りの実行時間を返上して，カーネルに次の周期で起こしてもらう
+				if constexpr(SFA == SFalgorithm::DEADLINE_YIELD){
+					if(Deadline == true){
+						if(ClockOverride == false) sched_yield();
+						continue;
+					}
+				}
 				
 				// 次の時刻になるまで待機
 				while(StateFlag != SFID_STOP){
@@ -327,6 +609,112 @@ class SFthread {
 			EventLog("Ending Realtime Loop.");
 		}
 		
+		//! @brief 計測周期の最大値と最小値を更新する関数
+		void UpdateMaxMinTime(void){
+			const double TsZ0 = timespec_to_sec(ActPeriodicTime);	// [s] 今のサンプリング時間
+			if(MaxMemo < TsZ0){
+				MaxMemo = TsZ0;
+			}
+			if(TsZ0 < MinMemo && 1e-6 < TsZ0){
+				MinMemo = TsZ0;
+			}
+		}
+		
+		//! @brief 周期超過のときの処理をする関数
+		//! @param[in]	EndTime		計算の終了時刻
+		//! @param[in]	PeriodTime	制御周期
+		//! @param[in,out]	NextTime	次の周期の開始時刻
+		void HandleOverrun(const timespec& EndTime, const timespec& PeriodTime, timespec& NextTime){
+			CountOverrun();
+			
+			switch(OverrunPolicy){
+				case SFoverrun::CATCH_UP:
+					// 次の時刻はそのままにして，待たずに続けて実行する
+					break;
+				case SFoverrun::DEGRADE:
+					if(DegradedFunc) DegradedFunc(ConsecutiveOverruns);			// 縮退動作用の関数を呼んでから，
+					[[fallthrough]];											// 過ぎた周期を飛ばす
+				case SFoverrun::SKIP:
+				default:{
+					SkipMissedPeriods(EndTime, NextTime);
+					break;
+				}
+			}
+		}
+		
+		//! @brief 過ぎてしまった周期の数だけ次の時刻を進めて，間に合う周期の開始時刻にする関数
+		//! @param[in]	EndTime		計算の終了時刻
+		//! @param[in,out]	NextTime	次の周期の開始時刻
+		void SkipMissedPeriods(const timespec& EndTime, timespec& NextTime){
+			const long Missed = timespec_to_nsec(timespec_sub(EndTime, NextTime))/(long)Ts + 1;
+			NextTime = timespec_add(NextTime, nsec_to_timespec(Missed*Ts));
+		}
+		
+		//! @brief 連続した周期超過の回数を数えて，上限に達したら緊急停止する関数
+		void CountOverrun(void){
+			++ConsecutiveOverruns;
+			if(0 < OverrunLimit) arcs_assert(ConsecutiveOverruns < OverrunLimit);	// 周期超過が続いたら緊急停止
+		}
+		
+		//! @brief 時間の分布と周期超過の回数を記録する関数
+		//! @param[in]	Scheduled		開始時刻が予定されたものかどうか (予定外のときは開始時刻の遅れを記録しない)
+		//! @param[in]	Overrun			消費時間が制御周期を超えたかどうか
+		//! @param[in]	StartLatency	開始時刻の目標時刻からの遅れ
+		void RecordHistograms(const bool Scheduled, const bool Overrun, const timespec& StartLatency){
+			if(Scheduled == true) StartLatencyHist.Record(std::max(timespec_to_nsec(StartLatency), 0L));
+			PeriodHist.Record(std::max(timespec_to_nsec(ActPeriodicTime), 0L));
+			CompTimeHist.Record(std::max(timespec_to_nsec(ComputationTime), 0L));
+			if(Overrun == true) ++Overruns;
+		}
+		
+		//! @brief 計測した時間情報を他のスレッドへ公開する関数
+		void PublishTiming(void){
+			Timing.Write({
+				timespec_to_sec(Time), timespec_to_sec(ActPeriodicTime), timespec_to_sec(ComputationTime),
+				MaxMemo, MinMemo, SpinMargin*1e-9, WakeupLatency*1e-9, Overruns
+			});
+		}
+		
+		//! @brief リアルタイムスレッドを SCHED_DEADLINE に切り替える関数 (DEADLINE_YIELD用)
+		//! 切り替えられなかったときは，CPUコアの割り当てを元に戻して SCHED_FIFO のまま動作させる。
+		//! @return	true = SCHED_DEADLINE に切り替えた，false = SCHED_FIFO のまま
+		bool EnterDeadlinePolicy(void){
+			if(CPUSettings::SetDeadlinePolicy(DeadlineRuntime, Ts, Ts) == true){
+				EventLog("SCHED_DEADLINE enabled.");
+				if(OverrunPolicy != SFoverrun::SKIP) EventLog("Overrun policy is not applied under SCHED_DEADLINE.");
+				DeadlineActive.store(true, std::memory_order_relaxed);
+				sched_yield();	// カーネルの周期の始まりまで眠って，初期時刻を周期の境目に揃える
+				return true;
+			}
+			EventLog("SCHED_DEADLINE unavailable. Falling back to SCHED_FIFO SLEEP_AND_SPIN.");
+			CPUSettings::SetCPUandPolicy(pthread_self(), CPUnum, SCHED_FIFO);	// CPUコアの割り当てとポリシーを元に戻す
+			DeadlineActive.store(false, std::memory_order_relaxed);
+			return false;
+		}
+		
+		//! @brief 指定時刻まで眠って，起床遅れからスピン待機の余裕時間を調整する関数
+		//! @param[in]	WakeupTime	起床時刻
+		//! @param[in]	Now			現在時刻
+		void SleepUntil(const timespec& WakeupTime, const timespec& Now){
+			long Latency = 0;	// [ns] 今回の起床遅れ (眠らなかったときは零とみなす)
+			if(timespec_lessthaneq(WakeupTime, Now) == false){
+				// 起床時刻までまだ時間があるときだけ眠る
+				timespec TimeAfterSleep = {0};	// 起床時刻
+				clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &WakeupTime, nullptr);	// 絶対時刻で指定して眠る
+				clock_gettime(CLOCK_MONOTONIC, &TimeAfterSleep);						// 実際の起床時刻の取得
+				Latency = timespec_to_nsec(timespec_sub(TimeAfterSleep, WakeupTime));	// 起床遅れを計算
+				WakeupLatency = Latency;
+			}
+			
+			// 起床遅れのピーク値は瞬時に追従してゆっくり減衰させ，その数倍を余裕時間とする
+			// ただし，1回の外れ値で余裕時間が跳ね上がらないように，ピーク値の更新は今の余裕時間までに制限する
+			// (遅れが続く場合は周期ごとに余裕時間が倍々で増えていく)
+			WakeupLatencyPeak = std::max(std::min(Latency, SpinMargin), WakeupLatencyPeak - WakeupLatencyPeak/LATENCY_DECAY);
+			if(AutoSpinMargin == true){
+				SpinMargin = std::clamp(SPIN_MARGIN_GAIN*WakeupLatencyPeak, MIN_SPIN_MARGIN, (long)Ts);
+			}
+		}
+		
 		//! @brief リアルタイムスレッド
 		//! @param[in]	p	クラスメンバアクセス用ポインタ
 		static void RealTimeThread(SFthread *p){
@@ -429,6 +817,20 @@ class SFthread {
 			return ret;
 		}
 		
+		//! @brief timespec構造体からナノ秒へ変換する関数
+		//! @param[in]	時刻(timespec構造体)
+		//! @return		時刻 [ns]
+		static long timespec_to_nsec(const timespec& time){
+			return time.tv_sec*ONE_SEC_IN_NANO + time.tv_nsec;
+		}
+		
+		//! @brief timespec構造体から std::chrono::nanoseconds へ変換する関数
+		//! @param[in]	時刻(timespec構造体)
+		//! @return		時刻 [ns]
+		static std::chrono::nanoseconds timespec_to_duration(const timespec& time){
+			return std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec);
+		}
+		
 		//! @brief timespec構造体から秒へ変換する関数
 		//! @param[in]	時刻(timespec構造体)
 		//! @return		時刻 [s]
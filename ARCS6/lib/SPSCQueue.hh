@@ -0,0 +1,173 @@
+//! @file SPSCQueue.hh
+//! @brief 単一生産者単一消費者キュークラス(テンプレート版)
+//!
+//! 1つの書き込み側スレッドから1つの読み出し側スレッドへ，固定長のレコードをロック無し・待ち無しで順番に受け渡す。
+//! 例えば，遅い軌道計画スレッドから速い制御スレッドへの目標値の列の受け渡しや，速い制御スレッドから遅いスレッドへの計測値の受け渡しに使う。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・Push() は書き込み側の1つのスレッドからのみ，Pop() と Peek() は読み出し側の1つのスレッドからのみ呼ぶこと。
+// ・書き込み位置と読み出し位置は別々のキャッシュラインに置き，相手側の位置は手元に写しを持っておいて，
+//   キューが満杯/空に見えたときだけ読み直すので，1回の受け渡しあたりのキャッシュラインの行き来は数回で済む。
+// ・満杯のときの Push() と空のときの Pop() は待たずに false を返す。満杯で書けなかった回数は GetDropCount() で取得できる。
+// ・容量 N は2のべき乗であること。(位置の計算をビットマスクで済ませるため)
+
+#ifndef SPSCQUEUE
+#define SPSCQUEUE
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <atomic>
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+	#include "ARCSeventlog.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+	#define PassedLog()
+	#define EventLog(a)
+	#define EventLogVar(a)
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 単一生産者単一消費者キュークラス
+//! @tparam	T	レコードの型
+//! @tparam	N	容量 (2のべき乗)
+template <typename T, size_t N>
+class SPSCQueue {
+	static_assert(0 < N && (N & (N - 1)) == 0, "SPSCQueue: N must be a power of two");
+	
+	public:
+		//! @brief コンストラクタ
+		SPSCQueue()
+			: Head(0), TailCache(0), Drops(0), Tail(0), HeadCache(0), Buffer()
+		{
+			PassedLog();
+		}
+		
+		//! @brief デストラクタ
+		~SPSCQueue(){
+			PassedLog();
+		}
+		
+		//! @brief レコードを末尾に追加する関数 (書き込み側のスレッドのみ呼ぶこと)
+		//! @param[in]	Value	レコード
+		//! @return	true = 追加できた，false = 満杯だったので捨てた
+		bool Push(const T& Value){
+			const size_t h = Head.load(std::memory_order_relaxed);
+			if(h - TailCache == N){
+				// 満杯に見えたときだけ読み出し位置を読み直す
+				TailCache = Tail.load(std::memory_order_acquire);
+				if(h - TailCache == N){
+					Drops.store(Drops.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+					return false;
+				}
+			}
+			Buffer[h & MASK] = Value;
+			Head.store(h + 1, std::memory_order_release);	// レコードを書き終えてから書き込み位置を進める
+			return true;
+		}
+		
+		//! @brief 先頭のレコードを取り出す関数 (読み出し側のスレッドのみ呼ぶこと)
+		//! @param[out]	Value	レコード (失敗したときは変更しない)
+		//! @return	true = 取り出せた，false = 空だった
+		bool Pop(T& Value){
+			if(Peek(Value) == false) return false;
+			Tail.store(Tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);	// レコードを読み終えてから読み出し位置を進める
+			return true;
+		}
+		
+		//! @brief 先頭のレコードを取り出さずに読む関数 (読み出し側のスレッドのみ呼ぶこと)
+		//! @param[out]	Value	レコード (失敗したときは変更しない)
+		//! @return	true = 読めた，false = 空だった
+		bool Peek(T& Value){
+			const size_t t = Tail.load(std::memory_order_relaxed);
+			if(t == HeadCache){
+				// 空に見えたときだけ書き込み位置を読み直す
+				HeadCache = Head.load(std::memory_order_acquire);
+				if(t == HeadCache) return false;
+			}
+			Value = Buffer[t & MASK];
+			return true;
+		}
+		
+		//! @brief 溜まっているレコードをすべて読み捨てて，最後のレコードだけを取り出す関数 (読み出し側のスレッドのみ呼ぶこと)
+		//! @param[out]	Value	最後のレコード (失敗したときは変更しない)
+		//! @return	true = 取り出せた，false = 空だった
+		bool PopLatest(T& Value){
+			HeadCache = Head.load(std::memory_order_acquire);
+			const size_t t = Tail.load(std::memory_order_relaxed);
+			if(t == HeadCache) return false;
+			Value = Buffer[(HeadCache - 1) & MASK];
+			Tail.store(HeadCache, std::memory_order_release);
+			return true;
+		}
+		
+		//! @brief 溜まっているレコードの数を返す関数 (どのスレッドから呼んでも良いが，呼んだ直後に変わり得る)
+		//! @return	レコードの数
+		size_t GetSize(void) const {
+			const size_t t = Tail.load(std::memory_order_acquire);
+			const size_t h = Head.load(std::memory_order_acquire);
+			return h - t;
+		}
+		
+		//! @brief 空かどうかを返す関数 (どのスレッドから呼んでも良いが，呼んだ直後に変わり得る)
+		//! @return	true = 空
+		bool IsEmpty(void) const {
+			return GetSize() == 0;
+		}
+		
+		//! @brief 容量を返す関数
+		//! @return	容量
+		static constexpr size_t GetCapacity(void){
+			return N;
+		}
+		
+		//! @brief 満杯で書けなかった回数を返す関数
+		//! @return	回数
+		unsigned long GetDropCount(void) const {
+			return Drops.load(std::memory_order_relaxed);
+		}
+		
+		//! @brief キューを空にする関数 (書き込み側も読み出し側も止まっているときに呼ぶこと)
+		void Clear(void){
+			Head.store(0, std::memory_order_relaxed);
+			Tail.store(0, std::memory_order_relaxed);
+			TailCache = 0;
+			HeadCache = 0;
+			Drops.store(0, std::memory_order_relaxed);
+		}
+	
+	private:
+		SPSCQueue(const SPSCQueue&) = delete;					//!< コピーコンストラクタ使用禁止
+		const SPSCQueue& operator=(const SPSCQueue&) = delete;	//!< 代入演算子使用禁止
+		
+		static constexpr size_t MASK = N - 1;	//!< 位置から配列の要素番号を得るためのビットマスク
+		
+		// 書き込み側が書き換える変数 (読み出し側の変数とキャッシュラインを分ける)
+		alignas(64) std::atomic<size_t> Head;	//!< 書き込み位置 (次に書き込む位置，単調増加)
+		size_t TailCache;						//!< 書き込み側が持っている読み出し位置の写し
+		std::atomic<unsigned long> Drops;		//!< 満杯で書けなかった回数
+		
+		// 読み出し側が書き換える変数
+		alignas(64) std::atomic<size_t> Tail;	//!< 読み出し位置 (次に読み出す位置，単調増加)
+		size_t HeadCache;						//!< 読み出し側が持っている書き込み位置の写し
+		
+		alignas(64) std::array<T, N> Buffer;	//!< レコードの格納用
+};
+}
+
+#endif
+
@@ -0,0 +1,13 @@
+//! @file SeqLock.cc
+//! @brief シーケンスロッククラス(テンプレート版)
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+
+#include "SeqLock.hh"
+
+// テンプレートのため，実体もヘッダ側に実装。
@@ -0,0 +1,102 @@
+//! @file SeqLock.hh
+//! @brief シーケンスロッククラス(テンプレート版)
+//!
+//! 1つの書き込み側から複数の読み出し側へ，値の一貫した写しをロック無しで受け渡す。
+//! 書き込み側は読み出し側を一切待たないので，リアルタイムスレッドから非リアルタイムスレッドへの情報の公開に使う。
+//!
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+//
+// 以下，コメント。
+// ・書き込みは1つのスレッドからのみ行うこと。読み出しは何個のスレッドからでも良い。
+// ・書き込み側は順序番号を奇数にしてから値を書き，偶数に戻して書き込み完了とする。
+//   読み出し側は読み出しの前後で順序番号が同じ偶数であれば，途中で書き換えられていない値とみなす。
+//   書き換え中だった場合は読み直すので，読み出し側は書き込み1回分だけ待たされることがある。
+// ・値は64bitの原子変数の配列に分割して格納するので，コピーで済む型(trivially copyable)のみ使用可能。
+
+#ifndef SEQLOCK
+#define SEQLOCK
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <atomic>
+#include <type_traits>
+
+namespace ARCS {	// ARCS名前空間
+//! @brief シーケンスロッククラス
+//! @tparam	T	受け渡す値の型
+template <typename T>
+class SeqLock {
+	static_assert(std::is_trivially_copyable_v<T>, "SeqLock: T must be trivially copyable");
+	static_assert(std::is_default_constructible_v<T>, "SeqLock: T must be default constructible");
+	
+	public:
+		//! @brief コンストラクタ
+		SeqLock()
+			: Sequence(0), Words()
+		{
+			Write(T{});
+		}
+		
+		//! @brief コンストラクタ(初期値指定版)
+		//! @param[in]	InitValue	初期値
+		explicit SeqLock(const T& InitValue)
+			: Sequence(0), Words()
+		{
+			Write(InitValue);
+		}
+		
+		//! @brief 値を書き込む関数 (書き込み側のスレッドのみ呼ぶこと)
+		//! @param[in]	Value	書き込む値
+		void Write(const T& Value){
+			std::array<uint64_t, WORDS> Buffer = {0};
+			std::memcpy(Buffer.data(), &Value, sizeof(T));
+			const uint32_t Seq = Sequence.load(std::memory_order_relaxed);
+			Sequence.store(Seq + 1, std::memory_order_relaxed);	// 書き換え中(奇数)にする
+			std::atomic_thread_fence(std::memory_order_release);	// 順序番号の更新を値の書き込みより先に見せる
+			for(size_t i = 0; i < WORDS; ++i) Words[i].store(Buffer[i], std::memory_order_relaxed);
+			Sequence.store(Seq + 2, std::memory_order_release);	// 書き込み完了(偶数)にする
+		}
+		
+		//! @brief 値の一貫した写しを読み出す関数 (書き換え中の場合は読み直す)
+		//! @return	読み出した値
+		T Read(void) const {
+			T Value;
+			while(TryRead(Value) == false);
+			return Value;
+		}
+		
+		//! @brief 値の読み出しを1回だけ試みる関数
+		//! @param[out]	Value	読み出した値 (失敗したときは不定)
+		//! @return	true = 一貫した値が読めた，false = 書き換え中だった
+		bool TryRead(T& Value) const {
+			std::array<uint64_t, WORDS> Buffer = {0};
+			const uint32_t Seq1 = Sequence.load(std::memory_order_acquire);
+			if((Seq1 & 1) != 0) return false;	// 書き換え中
+			for(size_t i = 0; i < WORDS; ++i) Buffer[i] = Words[i].load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_acquire);	// 値の読み出しを順序番号の再読み出しより先に済ませる
+			const uint32_t Seq2 = Sequence.load(std::memory_order_relaxed);
+			if(Seq1 != Seq2) return false;		// 読み出し中に書き換えられた
+			std::memcpy(&Value, Buffer.data(), sizeof(T));
+			return true;
+		}
+	
+	private:
+		SeqLock(const SeqLock&) = delete;					//!< コピーコンストラクタ使用禁止
+		const SeqLock& operator=(const SeqLock&) = delete;	//!< 代入演算子使用禁止
+		
+		static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1)/sizeof(uint64_t);	//!< 値の格納に必要な64bit語の数
+		alignas(64) std::atomic<uint32_t> Sequence;			//!< 順序番号 (奇数 = 書き換え中，偶数 = 書き込み完了)
+		std::array<std::atomic<uint64_t>, WORDS> Words;		//!< 値の格納用
+};
+}
+
+#endif
+
@@ -3,10 +3,10 @@
 //!
 //! 1層のパーセプトロンレイヤ
 //!
-//! @date 2021/06/22
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2021 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -139,7 +139,7 @@ class SingleLayerPerceptron {
 			alph = alpha;
 			NearZero = zero;
 		}
-
+		
 		//! @brief AdaDelta勾配降下法の更新ゲイン(学習率)の設定
 		//! @param[in]	alpha	更新ゲイン(学習率)
 		//! @param[in]	zero	ゼロ割回避用の係数
@@ -171,7 +171,8 @@ class SingleLayerPerceptron {
 		//! @param[in]	zprev	前の層からの入力ベクトル
 		//! @param[in]	z		出力ベクトル
 		void CalcForwardForTraining(const Matrix<1,N>& zprev, Matrix<1,P>& z){
-			u = W*zprev + b;						// 重み乗算加算とバイアス加算
+			u = b;									// バイアス加算
+			muladd_into(u, W, zprev);				// 重み乗算加算
 			ActivationFunctions::f<AF,1,P>(u, z);	// 活性化関数
 			
 			if constexpr(DD == NnDropout::ENABLE){
@@ -184,7 +185,8 @@ class SingleLayerPerceptron {
 		//! @param[in]	zprev	前の層からの入力ベクトル
 		//! @param[in]	z		出力ベクトル
 		void CalcForwardForEstimation(const Matrix<1,N>& zprev, Matrix<1,P>& z){
-			u = W*zprev + b;						// 重み乗算加算とバイアス加算
+			u = b;									// バイアス加算
+			muladd_into(u, W, zprev);				// 重み乗算加算
 			ActivationFunctions::f<AF,1,P>(u, z);	// 活性化関数
 			
 			if constexpr(DD == NnDropout::ENABLE){
@@ -197,7 +199,8 @@ class SingleLayerPerceptron {
 		//! @param[in]	Zprev	前の層からの入力行列
 		//! @param[in]	Z		出力行列
 		void CalcForwardForTraining(const Matrix<M,N>& Zprev, Matrix<M,P>& Z){
-			U = W*Zprev + b*lT;						// 重み乗算加算とバイアス加算
+			mul_into(U, b, lT);						// バイアス加算
+			muladd_into(U, W, Zprev);				// 重み乗算加算
 			ActivationFunctions::f<AF,M,P>(U, Z);	// 活性化関数
 			
 			if constexpr(DD == NnDropout::ENABLE){
@@ -210,7 +213,8 @@ class SingleLayerPerceptron {
 		//! @param[in]	Zprev	前の層からの入力行列
 		//! @param[in]	Z		出力行列
 		void CalcForwardForEstimation(const Matrix<M,N>& Zprev, Matrix<M,P>& Z){
-			U = W*Zprev + b*lT;						// 重み乗算加算とバイアス加算
+			mul_into(U, b, lT);						// バイアス加算
+			muladd_into(U, W, Zprev);				// 重み乗算加算
 			ActivationFunctions::f<AF,M,P>(U, Z);	// 活性化関数
 			
 			if constexpr(DD == NnDropout::ENABLE){
@@ -229,7 +233,7 @@ class SingleLayerPerceptron {
 				// ドロップアウトする場合
 				Delta = Delta & (DropMask*lT);		// 該当ノードをドロップアウト
 			}
-			WDelta = tp(W)*Delta;					// 前の層に渡すための重み誤差計算
+			tpmul_into(WDelta, W, Delta);			// 前の層に渡すための重み誤差計算 (転置行列は作らない)
 		}
 		
 		//! @brief 出力層用の誤差行列の計算
@@ -238,7 +242,7 @@ class SingleLayerPerceptron {
 		//! @param[out]	WDelta	重み誤差行列
 		void CalcDeltaForOutputLayer(const Matrix<M,P>& Y, const Matrix<M,P>& D, Matrix<M,N>& WDelta){
 			Delta = Y - D;			// 誤差計算
-			WDelta = tp(W)*Delta;	// 前の層に渡すための重み誤差計算
+			tpmul_into(WDelta, W, Delta);	// 前の層に渡すための重み誤差計算 (転置行列は作らない)
 		}
 		
 		//! @brief ドロップアウトマスクの計算
@@ -257,12 +261,12 @@ class SingleLayerPerceptron {
 				}
 			}
 		}
-
+		
 		//! @brief 重み行列とバイアスベクトルの更新
 		//! @param[in]	Zprev	前の層からの入力行列
 		void UpdateWeight(const Matrix<M,N>& Zprev){
-			dW = 1.0/M*Delta*tp(Zprev);	// 重み更新差分値
-			db = 1.0/M*Delta*l;			// バイアス更新差分値
+			multp_into(dW, Delta, Zprev, 1.0/M);	// 重み更新差分値 (転置行列は作らない)
+			mul_into(db, Delta, l, 1.0/M);			// バイアス更新差分値
 			
 			// 勾配降下法の指定に従ってコンパイル時条件分岐
 			if constexpr(GD == NnDescentTypes::SGD)		CalcSGD(dW, db);		// 確率的勾配降下法
@@ -366,7 +370,7 @@ class SingleLayerPerceptron {
 			CsvManipulator::LoadFile(S, SettingName);				// CSVファイルから読み込み
 			S.Get(xbar, sigma, eps, alph, bet, NearZero, DropRate);	// 設定値を読み込み
 		}
-		
+	
 	private:
 		SingleLayerPerceptron(const SingleLayerPerceptron&) = delete;					//!< コピーコンストラクタ使用禁止
 		const SingleLayerPerceptron& operator=(const SingleLayerPerceptron&) = delete;	//!< 代入演算子使用禁止
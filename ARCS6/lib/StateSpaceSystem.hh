@@ -3,11 +3,12 @@
 //!
 //! 線形の状態空間モデルで表現されたシステムを保持，入力信号に対する出力信号を計算する。
 //! (MATLABでいうところの「State Space」のようなもの)
+//! A行列が対角，三角，帯，コンパニオン行列のときは，設定時に構造を判定して，毎サンプルの状態方程式をその構造に応じた少ない計算量で計算する。
 //!
-//! @date 2020/06/10
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -17,6 +18,7 @@
 
 #include <cassert>
 #include "Matrix.hh"
+#include "MatrixStructured.hh"
 #include "Discret.hh"
 
 // ARCS組込み用マクロ
@@ -42,7 +44,7 @@ class StateSpaceSystem {
 	public:
 		//! @brief コンストラクタ(空コンストラクタ版)
 		StateSpaceSystem(void)
-			: Ad(), Bd(), Cd(), x(), x_next()
+			: Ad(), Bd(), Cd(), x(), x_next(), AdStruct(MatrixStructure::DENSE), AdKL(N - 1), AdKU(N - 1), AdComp(), IsDelta(false), IsDenseShift(true), IsDeltaComp(false), Tsd(0)
 		{
 			PassedLog();
 		}
@@ -53,7 +55,7 @@ class StateSpaceSystem {
 		//! @param[in]	C	C行列
 		//! @param[in]	Ts	サンプリング周期 [s]
 		StateSpaceSystem(const Matrix<N,N>& A, const Matrix<I,N>& B, const Matrix<N,O>& C, const double Ts)
-			: Ad(), Bd(), Cd(), x(), x_next()
+			: Ad(), Bd(), Cd(), x(), x_next(), AdStruct(MatrixStructure::DENSE), AdKL(N - 1), AdKU(N - 1), AdComp(), IsDelta(false), IsDenseShift(true), IsDeltaComp(false), Tsd(0)
 		{
 			SetContinuous(A, B, C, Ts);	// 連続系のA行列，B行列，C行列を設定して離散化
 			PassedLog();
@@ -62,11 +64,11 @@ class StateSpaceSystem {
 		//! @brief ムーブコンストラクタ
 		//! @param[in]	r	右辺値
 		StateSpaceSystem(StateSpaceSystem&& r)
-			: Ad(r.Ad), Bd(r.Bd), Cd(r.Cd), x(r.x), x_next(r.x_next)
+			: Ad(r.Ad), Bd(r.Bd), Cd(r.Cd), x(r.x), x_next(r.x_next), AdStruct(r.AdStruct), AdKL(r.AdKL), AdKU(r.AdKU), AdComp(r.AdComp), IsDelta(r.IsDelta), IsDenseShift(r.IsDenseShift), IsDeltaComp(r.IsDeltaComp), Tsd(r.Tsd)
 		{
 			
 		}
-
+		
 		//! @brief デストラクタ
 		~StateSpaceSystem(){
 			PassedLog();
@@ -80,6 +82,8 @@ class StateSpaceSystem {
 		void SetContinuous(const Matrix<N,N>& A, const Matrix<I,N>& B, const Matrix<N,O>& C, const double Ts){
 			Discret::GetDiscSystem(A, B, Ad, Bd, Ts);	// 離散化
 			Cd = C;		// C行列はそのまま
+			IsDelta = false;
+			SetStructure();	// A行列の構造を判定
 		}
 		
 		//! @brief 離散系のA行列，B行列，C行列を設定する関数
@@ -90,15 +94,38 @@ class StateSpaceSystem {
 			Ad = A;
 			Bd = B;
 			Cd = C;
+			IsDelta = false;
+			SetStructure();	// A行列の構造を判定
+		}
+		
+		//! @brief デルタ演算子 δ = (z - 1)/Ts の形式の離散系のA行列，B行列，C行列を設定する関数
+		//! 状態方程式は x[k+1] = x[k] + Ts*(A*x[k] + B*u[k]) となる。
+		//! 速いサンプリングで A行列の固有値が1に集まるときも，係数が連続系に近い大きさのままなので丸め誤差に強い。
+		//! @param[in]	A	デルタ演算子形式のA行列
+		//! @param[in]	B	デルタ演算子形式のB行列
+		//! @param[in]	C	C行列
+		//! @param[in]	Ts	サンプリング周期 [s]
+		void SetDelta(const Matrix<N,N>& A, const Matrix<I,N>& B, const Matrix<N,O>& C, const double Ts){
+			Ad = A;
+			Bd = Ts*B;	// 毎サンプルの乗算を減らすため，B行列はサンプリング周期を掛けて保持
+			Cd = C;
+			IsDelta = true;
+			Tsd = Ts;
+			SetStructure();	// A行列の構造を判定
+		}
+		
+		//! @brief 判定したA行列の構造を返す関数
+		//! @return	A行列の構造
+		MatrixStructure GetStructure(void) const {
+			return AdStruct;
 		}
 		
 		//! @brief 状態空間モデルの応答を計算して取得する関数(普通版)
 		//! @param[in]	u	入力ベクトル
 		//! @param[out]	yout	出力ベクトル
 		void GetResponses(const Matrix<1,I>& u, Matrix<1,O>& yout){
-			x_next = Ad*x + Bd*u;	// 状態方程式
-			yout = Cd*x;			// 出力方程式
-			x = x_next;				// 状態ベクトルを更新
+			yout = lazy(Cd)*x;			// 出力方程式 (式テンプレートで出力ベクトルへ直接計算)
+			UpdateState(u);				// 状態方程式で状態ベクトルを更新
 		}
 		
 		//! @brief 状態空間モデルの応答を計算して取得する関数(ベクトルで返す版)
@@ -126,9 +153,8 @@ class StateSpaceSystem {
 		//! @param[in]	u	入力ベクトル
 		//! @param[out]	yout	出力ベクトル
 		void GetNextResponses(const Matrix<1,I>& u, Matrix<1,O>& yout){
-			x_next = Ad*x + Bd*u;	// 状態方程式
-			yout = Cd*x_next;		// 出力方程式(次の時刻の出力ベクトルを即時に返す)
-			x = x_next;				// 状態ベクトルを更新
+			UpdateState(u);				// 状態方程式で状態ベクトルを更新
+			yout = lazy(Cd)*x;			// 出力方程式(次の時刻の出力ベクトルを即時に返す)
 		}
 		
 		//! @brief 状態空間モデルの応答を計算して取得する関数(次の時刻の出力ベクトルを即時に返す版)(ベクトルで返す版)
@@ -152,11 +178,20 @@ class StateSpaceSystem {
 			return y_vec[1];				// 出力を返す
 		}
 		
+		//! @brief 状態空間モデルの状態ベクトルを計算して取得する関数(出力行列を掛けない版)
+		//! C行列が単位行列のとき(オブザーバなど)は GetResponses と同じ結果になり，出力方程式の行列積を省略できる
+		//! @param[in]	u	入力ベクトル
+		//! @param[out]	xout	状態ベクトル
+		void GetStateResponses(const Matrix<1,I>& u, Matrix<1,N>& xout){
+			xout = x;					// 現在の状態ベクトルを出力
+			UpdateState(u);				// 状態方程式で状態ベクトルを更新
+		}
+		
 		//! @brief 状態ベクトルをクリアする関数
 		void ClearStateVector(void){
 			x = Matrix<1,N>::zeros();
 		}
-		
+	
 	private:
 		StateSpaceSystem(const StateSpaceSystem&) = delete;					//!< コピーコンストラクタ使用禁止
 		const StateSpaceSystem& operator=(const StateSpaceSystem&) = delete;//!< 代入演算子使用禁止
@@ -165,6 +200,73 @@ class StateSpaceSystem {
 		Matrix<N,O> Cd;		//!< C行列
 		Matrix<1,N> x;		//!< 状態ベクトル
 		Matrix<1,N> x_next;	//!< 次の時刻の状態ベクトル
+		MatrixStructure AdStruct;	//!< A行列の構造
+		size_t AdKL;				//!< A行列の下側帯幅
+		size_t AdKU;				//!< A行列の上側帯幅
+		CompanionMatrix<N> AdComp;	//!< コンパニオン行列のときのA行列
+		bool IsDelta;				//!< デルタ演算子形式かどうか
+		bool IsDenseShift;			//!< 密行列の普通の形式(構造を使わずにそのまま計算する)かどうか
+		bool IsDeltaComp;			//!< デルタ演算子形式のコンパニオン行列(伝達関数)かどうか
+		double Tsd;					//!< デルタ演算子形式のサンプリング周期 [s]
+		
+		//! @brief A行列の構造を判定して，毎サンプルの行列積の計算方法を決める関数
+		void SetStructure(void){
+			AdStruct = DetectStructure(Ad);
+			GetBandwidth(Ad, AdKL, AdKU);
+			IsDenseShift = (AdStruct == MatrixStructure::DENSE && IsDelta == false);
+			IsDeltaComp = IsDelta && (AdStruct == MatrixStructure::COMPANION || N == 1);	// 1次のときはスカラーなのでコンパニオン行列と同じ
+			if(IsDeltaComp){
+				AdComp = CompanionMatrix<N>::FromLastRow(Tsd*CompanionMatrix<N>(Ad).GetLastRow());	// 最下行はサンプリング周期を掛けて保持
+			}else if(AdStruct == MatrixStructure::COMPANION){
+				AdComp = CompanionMatrix<N>(Ad);
+			}
+		}
+		
+		//! @brief 状態方程式を計算して状態ベクトルを更新する関数
+		//! @param[in]	u	入力ベクトル
+		void UpdateState(const Matrix<1,I>& u){
+			if(__builtin_expect(IsDenseShift, 1)){
+				// 密行列 (式テンプレートで中間の行列を作らずに直接計算)
+				x_next = lazy(Ad)*x + lazy(Bd)*u;
+				x = x_next;
+			}else if(IsDeltaComp){
+				// デルタ演算子形式のコンパニオン行列(伝達関数)は，x[k+1] = x[k] + Ts*(A*x[k] + B*u[k]) を上の要素から順に上書きして計算する
+				// (i番目の要素の更新には，まだ上書きしていないi+1番目の要素を使う)
+				mul_into(x_next, Bd, u);
+				const double xN = AdComp.dot_lastrow(x.Data[0]);
+				// (入力の項を先に足して，状態の依存関係の連鎖を短くする)
+				for(size_t i = 0; i + 1 < N; ++i) x.Data[0][i] = (x.Data[0][i] + x_next.Data[0][i]) + Tsd*x.Data[0][i+1];
+				x.Data[0][N-1] = (x.Data[0][N-1] + x_next.Data[0][N-1]) + xN;
+			}else{
+				UpdateStructuredState(u);
+			}
+		}
+		
+		//! @brief A行列が構造を持つときに，状態方程式を計算して状態ベクトルを更新する関数
+		//! @param[in]	u	入力ベクトル
+		void UpdateStructuredState(const Matrix<1,I>& u){
+			switch(AdStruct){
+				case MatrixStructure::DENSE:
+					mul_into(x_next, Ad, x);
+					break;
+				case MatrixStructure::DIAGONAL:
+					for(size_t i = 0; i < N; ++i) x_next.Data[0][i] = Ad.Data[i][i]*x.Data[0][i];	// 対角行列は要素ごとの積
+					break;
+				case MatrixStructure::COMPANION:
+					mul_into(x_next, AdComp, x);	// コンパニオン行列
+					break;
+				default:
+					mul_band_into(x_next, Ad, x, AdKL, AdKU);	// 三角，帯行列は帯の中だけ計算
+					break;
+			}
+			if(IsDelta){
+				axpy(x, Tsd, x_next);		// x[k+1] = x[k] + Ts*A*x[k] + (Ts*B)*u[k]
+				muladd_into(x, Bd, u);
+			}else{
+				muladd_into(x_next, Bd, u);
+				x = x_next;
+			}
+		}
 };
 }
 
@@ -38,8 +38,8 @@ class Statistics {
 		template <size_t N, size_t M>
 		static double Mean(const Matrix<N,M>& U){
 			double Ubar = 0;
-			for(size_t i = 1; i <= M; ++i){
-				for(size_t j = 1; j <= N; ++j) Ubar += U.GetElement(j,i);
+			for(size_t i = 0; i < N; ++i){
+				for(size_t j = 0; j < M; ++j) Ubar += U.Data[i][j];	// 列ごとに連続した格納順に走査
 			}
 			return Ubar/(double)(N*M);	// 平均値を計算して返す
 		}
@@ -68,9 +68,9 @@ class Statistics {
 			
 			// Uから平均値を減算して2乗して累積加算
 			double xi_xbar = 0, s2 = 0;
-			for(size_t i = 1; i <= M; ++i){
-				for(size_t j = 1; j <= N; ++j){
-					xi_xbar = U.GetElement(j,i) - Ubar;
+			for(size_t i = 0; i < N; ++i){
+				for(size_t j = 0; j < M; ++j){
+					xi_xbar = U.Data[i][j] - Ubar;	// 列ごとに連続した格納順に走査
 					s2 += xi_xbar*xi_xbar;
 				}
 			}
@@ -100,9 +100,9 @@ class Statistics {
 			
 			// Uから平均値を減算して2乗して累積加算
 			double xi_xbar = 0, s2 = 0;
-			for(size_t i = 1; i <= M; ++i){
-				for(size_t j = 1; j <= N; ++j){
-					xi_xbar = U.GetElement(j,i) - Ubar;
+			for(size_t i = 0; i < N; ++i){
+				for(size_t j = 0; j < M; ++j){
+					xi_xbar = U.Data[i][j] - Ubar;	// 列ごとに連続した格納順に走査
 					s2 += xi_xbar*xi_xbar;
 				}
 			}
@@ -157,10 +157,10 @@ class Statistics {
 			
 			// U1とU2から平均値を減算して共分散を計算して返す
 			double U1_Ubar1 = 0, U2_Ubar2 = 0, v = 0;
-			for(size_t i = 1; i <= M; ++i){
-				for(size_t j = 1; j <= N; ++j){
-					U1_Ubar1 = U1.GetElement(j,i) - Ubar1;
-					U2_Ubar2 = U2.GetElement(j,i) - Ubar2;
+			for(size_t i = 0; i < N; ++i){
+				for(size_t j = 0; j < M; ++j){
+					U1_Ubar1 = U1.Data[i][j] - Ubar1;	// 列ごとに連続した格納順に走査
+					U2_Ubar2 = U2.Data[i][j] - Ubar2;
 					v += U1_Ubar1*U2_Ubar2;
 				}
 			}
@@ -5,10 +5,14 @@
 //! (MATLABでいうところの「tf」のようなもの)
 //! 注意：厳密にプロパーで且つ分母の最高次数の係数は１のみサポート
 //!
-//! @date 2020/04/06
+//! ゼロ次ホールドで離散化した伝達関数を，デルタ演算子 δ = (z - 1)/Ts の領域の可制御正準形で実現するので，
+//! A行列はコンパニオン行列になり，毎サンプルの計算量は分母次数Dに比例する O(D) で済む。
+//! z領域の可制御正準形(差分方程式)と違って，速いサンプリングでも係数が丸め誤差で狂いにくい。
+//!
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -18,6 +22,8 @@
 
 #include <cassert>
 #include "Matrix.hh"
+#include "MatrixStructured.hh"
+#include "Discret.hh"
 #include "StateSpaceSystem.hh"
 
 // ARCS組込み用マクロ
@@ -65,11 +71,37 @@ class TransferFunction {
 			for(size_t i = 1; i <= N + 1; ++i){
 				c.SetElement(i, 1, Num[N - i + 2]);
 			}
-			Sys.SetContinuous(A, b, c, Ts);
+			
+			// ゼロ次ホールドで離散化して，デルタ演算子の領域のA行列とbベクトルに変換
+			Matrix<D,D> Ad;
+			Matrix<1,D> bd;
+			Discret::GetDiscSystem(A, b, Ad, bd, Ts);
+			const Matrix<D,D> Ap = (1.0/Ts)*(Ad - Matrix<D,D>::eye());
+			const Matrix<1,D> bp = (1.0/Ts)*bd;
+			
+			// ファデーエフ・ルヴェリエ法で，分母 det(δI - Ap) と分子 c*adj(δI - Ap)*bp の係数を求める
+			Matrix<1,D+1> DenDelta;	// 分母の係数ベクトル (δ^D の係数から順に並ぶ)
+			Matrix<1,D> NumDelta;	// 分子の係数ベクトル (δ^(D-1) の係数から順に並ぶ)
+			Matrix<D,D> M = Matrix<D,D>::eye();
+			DenDelta[1] = 1;
+			for(size_t k = 1; k <= D; ++k){
+				NumDelta[k] = (c*M*bp)[1];
+				const Matrix<D,D> ApM = Ap*M;
+				DenDelta[k + 1] = -tr(ApM)/(double)k;
+				M = ApM + DenDelta[k + 1]*Matrix<D,D>::eye();
+			}
+			
+			// デルタ演算子の領域の可制御正準形 (A行列はコンパニオン行列)
+			const Matrix<D,D> Adelta = CompanionMatrix<D>::FromPolynomial(DenDelta).ToMatrix();
+			Matrix<D,1> cdelta;
+			for(size_t i = 1; i <= D; ++i){
+				cdelta.SetElement(i, 1, NumDelta[D - i + 1]);
+			}
+			Sys.SetDelta(Adelta, b, cdelta, Ts);
 			
 			PassedLog();
 		}
-
+		
 		//! @brief ムーブコンストラクタ
 		//! @param[in]	r	右辺値
 		TransferFunction(TransferFunction&& r)
@@ -80,7 +112,7 @@ class TransferFunction {
 		{
 			
 		}
-
+		
 		//! @brief デストラクタ
 		~TransferFunction(){
 			PassedLog();
@@ -91,7 +123,7 @@ class TransferFunction {
 		double GetResponse(const double u){
 			return Sys.GetNextResponse(u);	// 1サンプル遅れを防ぐために次の応答を即時に返す
 		}
-		
+	
 	private:
 		TransferFunction(const TransferFunction&) = delete;					//!< コピーコンストラクタ使用禁止
 		const TransferFunction& operator=(const TransferFunction&) = delete;//!< 代入演算子使用禁止
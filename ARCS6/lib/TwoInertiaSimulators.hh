@@ -2,11 +2,12 @@
 //! @brief 2慣性共振系シミュレータV2(ベクトル版)
 //!
 //! 複数の2慣性共振系を模擬して，負荷側速度，ねじれ角，モータ速度を計算して出力する。
+//! 全軸の状態方程式は多軸一括行列(MatrixBatch)でまとめて計算する。
 //!
-//! @date 2020/04/10
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -17,8 +18,10 @@
 #include <cassert>
 #include <array>
 #include "Matrix.hh"
+#include "MatrixBatch.hh"
+#include "Discret.hh"
+#include "Integrator.hh"
 #include "TwoInertiaParamDef.hh"
-#include "TwoInertiaSimulator.hh"
 
 // ARCS組込み用マクロ
 #ifdef ARCS_IN
@@ -43,23 +46,23 @@ class TwoInertiaSimulators {
 		//! @param[in]	Params	2慣性系パラメータ構造体の配列
 		//! @param[in]	SmplTime	サンプリング周期 [s]
 		TwoInertiaSimulators(const std::array<struct TwoInertiaParamDef, N>& Params, const double SmplTime)
-			: PlantSyss()
+			: Ad(), Bd(), u(), x(), y(), MotorInteg(), LoadInteg()
 		{
 			PassedLog();
 			// 各軸数分の2慣性系パラメータ設定
 			for(size_t i = 0; i < N; ++i){
-				PlantSyss.at(i).SetParameters(Params.at(i), SmplTime);
+				SetStateSpaceModel(i, Params.at(i), SmplTime);
 			}
 		}
-
+		
 		//! @brief ムーブコンストラクタ
 		//! @param[in]	r	右辺値
 		TwoInertiaSimulators(TwoInertiaSimulators&& r)
-			: PlantSyss(std::move(r.PlantSyss))
+			: Ad(r.Ad), Bd(r.Bd), u(r.u), x(r.x), y(r.y), MotorInteg(std::move(r.MotorInteg)), LoadInteg(std::move(r.LoadInteg))
 		{
 			
 		}
-
+		
 		//! @brief デストラクタ
 		~TwoInertiaSimulators(){
 			PassedLog();
@@ -69,20 +72,18 @@ class TwoInertiaSimulators {
 		//! @param[in]	Current	q軸電流の配列 [A]
 		//! @param[in]	LoadTorque	負荷トルクの配列 [Nm]
 		void SetCurrentAndLoadTorque(const std::array<double, N>& Current, const std::array<double, N>& LoadTorque){
-			// 各軸の電流と負荷トルクを設定
-			for(size_t i = 0; i < N; ++i){
-				PlantSyss.at(i).SetCurrentAndLoadTorque(Current.at(i), LoadTorque.at(i));
-			}
+			// 全軸の入力ベクトルを設定
+			u.SetLanes(1, 1, Current);
+			u.SetLanes(1, 2, LoadTorque);
 		}
 		
 		//! @brief 予めモータ電流と負荷トルクを設定する関数(ベクトル版)
 		//! @param[in]	Current	q軸電流の縦ベクトル [A]
 		//! @param[in]	LoadTorque	負荷トルクの縦ベクトル [Nm]
 		void SetCurrentAndLoadTorque(const Matrix<1,N>& Current, const Matrix<1,N>& LoadTorque){
-			std::array<double, N> iq, ts;
-			Current.StoreArray(iq);
-			LoadTorque.StoreArray(ts);
-			SetCurrentAndLoadTorque(iq, ts);
+			// 全軸の入力ベクトルを設定
+			u.SetLanes(1, 1, Current);
+			u.SetLanes(1, 2, LoadTorque);
 		}
 		
 		//! @brief 予め設定された電流と負荷から負荷側速度＆ねじれ角＆モータ側速度を計算する関数(std::array版)
@@ -90,10 +91,11 @@ class TwoInertiaSimulators {
 		//! @param[out]	TorsionAngle	ねじれ角の配列 [rad]
 		//! @param[out]	MotorSpeed	モータ側速度の配列 [rad/s]
 		void GetResponses(std::array<double, N>& LoadSpeed, std::array<double, N>& TorsionAngle, std::array<double, N>& MotorSpeed){
-			// 各軸の応答を計算
-			for(size_t i = 0; i < N; ++i){
-				PlantSyss.at(i).GetResponses(LoadSpeed.at(i), TorsionAngle.at(i), MotorSpeed.at(i));
-			}
+			// 全軸の応答をまとめて計算
+			CalcResponses();
+			y.GetLanes(1, 1, MotorSpeed);
+			y.GetLanes(1, 2, LoadSpeed);
+			y.GetLanes(1, 3, TorsionAngle);
 		}
 		
 		//! @brief 予め設定された電流と負荷から負荷側速度＆ねじれ角＆モータ側速度を計算する関数(ベクトル版)
@@ -101,11 +103,11 @@ class TwoInertiaSimulators {
 		//! @param[out]	TorsionAngle	ねじれ角の縦ベクトル [rad]
 		//! @param[out]	MotorSpeed	モータ側速度の縦ベクトル [rad/s]
 		void GetResponses(Matrix<1,N>& LoadSpeed, Matrix<1,N>& TorsionAngle, Matrix<1,N>& MotorSpeed){
-			std::array<double, N> wl, ths, wm;
-			GetResponses(wl, ths, wm);
-			LoadSpeed.LoadArray(wl);
-			TorsionAngle.LoadArray(ths);
-			MotorSpeed.LoadArray(wm);
+			// 全軸の応答をまとめて計算
+			CalcResponses();
+			y.GetLanes(1, 1, MotorSpeed);
+			y.GetLanes(1, 2, LoadSpeed);
+			y.GetLanes(1, 3, TorsionAngle);
 		}
 		
 		//! @brief モータ側位置を取得する関数(std::array版)
@@ -114,7 +116,7 @@ class TwoInertiaSimulators {
 		void GetMotorPosition(std::array<double, N>& MotorPosition){
 			// 各軸の位置を取得
 			for(size_t i = 0; i < N; ++i){
-				MotorPosition.at(i) = PlantSyss.at(i).GetMotorPosition();
+				MotorPosition.at(i) = MotorInteg.at(i).GetSignal(y.Data[0][0][i]);	// モータ側速度を積分
 			}
 		}
 		
@@ -133,7 +135,7 @@ class TwoInertiaSimulators {
 		void GetLoadPosition(std::array<double, N>& LoadPosition){
 			// 各軸の位置を取得
 			for(size_t i = 0; i < N; ++i){
-				LoadPosition.at(i) = PlantSyss.at(i).GetLoadPosition();
+				LoadPosition.at(i) = LoadInteg.at(i).GetSignal(y.Data[0][1][i]);	// 負荷側速度を積分
 			}
 		}
 		
@@ -145,13 +147,56 @@ class TwoInertiaSimulators {
 			GetLoadPosition(thl);
 			LoadPosition.LoadArray(thl);
 		}
-		
+	
 	private:
 		TwoInertiaSimulators(const TwoInertiaSimulators&) = delete;					//!< コピーコンストラクタ使用禁止
 		const TwoInertiaSimulators& operator=(const TwoInertiaSimulators&) = delete;//!< 代入演算子使用禁止
 		
-		std::array<TwoInertiaSimulator, N> PlantSyss;	//!< 2慣性系シミュレータの配列
+		MatrixBatch<N,3,3> Ad;	//!< 全軸の離散系A行列
+		MatrixBatch<N,2,3> Bd;	//!< 全軸の離散系B行列
+		MatrixBatch<N,1,2> u;	//!< 全軸の入力ベクトル
+		MatrixBatch<N,1,3> x;	//!< 全軸の状態ベクトル
+		MatrixBatch<N,1,3> y;	//!< 全軸の出力ベクトル
+		std::array<Integrator<>, N> MotorInteg;	//!< モータ側積分器の配列
+		std::array<Integrator<>, N> LoadInteg;	//!< 負荷側積分器の配列
+		
+		//! @brief i軸目の状態空間モデルを設定する関数
+		//! @param[in]	i	軸番号 (0始まり)
+		//! @param[in]	Params	2慣性系パラメータ構造体
+		//! @param[in]	SmplTime	サンプリング周期 [s]
+		void SetStateSpaceModel(const size_t i, const struct TwoInertiaParamDef& Params, const double SmplTime){
+			const double Kt = Params.Kt, Jm = Params.Jm, Jl = Params.Jl, Ks = Params.Ks, Dm = Params.Dm, Dl = Params.Dl, Rg = Params.Rg;
+			
+			// 連続系A行列の設定
+			const Matrix<3,3> A = {
+				-Dm/Jm,      0, -Ks/(Rg*Jm),
+				     0, -Dl/Jl,       Ks/Jl,
+				1.0/Rg,     -1,           0
+			};
+			
+			// 連続系B行列の設定
+			const Matrix<2,3> B = {
+				Kt/Jm,       0,
+				    0, -1.0/Jl,
+				    0,       0
+			};
+			
+			// 離散化して i軸目に格納 (C行列は単位行列なので出力は状態ベクトルそのもの)
+			Matrix<3,3> Adi;
+			Matrix<2,3> Bdi;
+			Discret::GetDiscSystem(A, B, Adi, Bdi, SmplTime);
+			Ad.SetMatrix(i, Adi);
+			Bd.SetMatrix(i, Bdi);
+			MotorInteg.at(i).SetSmplTime(SmplTime);	// 積分器にサンプリング周期を設定
+			LoadInteg.at(i).SetSmplTime(SmplTime);	// 積分器にサンプリング周期を設定
+		}
 		
+		//! @brief 全軸の出力を計算して状態ベクトルを更新する関数
+		void CalcResponses(void){
+			y = x;	// y[k] = C*x[k] (C = I)
+			statespace_step(x, Ad, Bd, u);	// x[k+1] = Ad*x[k] + Bd*u[k]
+		}
+	
 };
 }
 
@@ -129,9 +129,7 @@ class TwoInertiaStateDistObsrv {
 			const Matrix<1,2> u = {Current, Velocity};
 			Matrix<1,4> xhat_dis;
 			StateDistObsrv.Estimate(u, xhat_dis);
-			xhat[1] = xhat_dis[1];
-			xhat[2] = xhat_dis[2];
-			xhat[3] = xhat_dis[3];
+			xhat = vvectorview<3>(xhat_dis, 1, 1);	// 負荷側外乱を除いた部分を直接コピー
 			LoadDisturbance = xhat_dis[4];
 		}
 		
@@ -61,6 +61,8 @@ namespace ARCS {	// ARCS名前空間
 			static constexpr SFalgorithm THREAD_TYPE = SFalgorithm::INSERT_ZEROSLEEP;	//!< リアルタイムアルゴリズムの選択
 			// 上記を INSERT_ZEROSLEEP にすると安定性が増すがリアルタイム性は落ちる。遅い処理系の場合に推奨。
 			// WITHOUT_ZEROSLEEP にするとリアルタイム性が向上するが，一時的に操作不能になる可能性が残る。高速な処理系の場合に選択可。
+			// SLEEP_AND_SPIN にすると周期の手前まで眠るのでCPUコアの使用率が下がり，リアルタイム性は WITHOUT_ZEROSLEEP に近い。
+			// DEADLINE_YIELD にすると SCHED_DEADLINE で実行時間が保証され，待機中はCPUコアを使わない。(root権限が必要，無ければ SLEEP_AND_SPIN で代替)
 			
 			//! @brief 制御周期の設定
 			static constexpr std::array<unsigned long, THREAD_MAX> SAMPLING_TIME = {
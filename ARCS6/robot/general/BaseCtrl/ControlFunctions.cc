@@ -20,14 +20,16 @@
 
 // 追加のARCSライブラリをここに記述
 #include "Matrix.hh"
+#include "Mailbox.hh"
 
 using namespace ARCS;
 
 //! @brief スレッド間通信用グローバル変数の無名名前空間
 namespace {
 	// スレッド間で共有したい変数をここに記述
-	std::array<double, ConstParams::ACTUATOR_NUM> PositionRes = {0};	//!< [rad] 位置応答
-	std::array<double, ConstParams::ACTUATOR_NUM> CurrentRef = {0};		//!< [Nm]  電流指令
+	// (周期の異なるスレッド間では，最新値の受け渡しに Mailbox を，値の列の受け渡しに SPSCQueue を使うとロック無しで書き換え途中の値を読まずに済む)
+	Mailbox<std::array<double, ConstParams::ACTUATOR_NUM>> PositionResBox;	//!< [rad] 位置応答 (制御用周期実行関数1 → 画面表示)
+	Mailbox<std::array<double, ConstParams::ACTUATOR_NUM>> CurrentRefBox;	//!< [A]  電流指令 (制御用周期実行関数1 → 画面表示)
 }
 
 //! @brief 制御用周期実行関数1
@@ -40,6 +42,8 @@ bool ControlFunctions::ControlFunction1(double t, double Tact, double Tcmp){
 	[[maybe_unused]] constexpr double Ts = ConstParams::SAMPLING_TIME[0]*1e-9;	// [s]	制御周期
 	
 	// 制御用変数宣言
+	static std::array<double, ConstParams::ACTUATOR_NUM> PositionRes = {0};	// [rad] 位置応答
+	static std::array<double, ConstParams::ACTUATOR_NUM> CurrentRef = {0};	// [A]  電流指令
 	
 	if(CmdFlag == CTRL_INIT){
 		// 初期化モード (ここは制御開始時/再開時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
@@ -57,6 +61,8 @@ bool ControlFunctions::ControlFunction1(double t, double Tact, double Tcmp){
 		// ここに制御アルゴリズムを記述する
 		
 		Interface.SetCurrent(CurrentRef);	// [A] 電流指令の出力
+		PositionResBox.Post(PositionRes);	// [rad] 位置応答を他のスレッドへ公開
+		CurrentRefBox.Post(CurrentRef);		// [A] 電流指令を他のスレッドへ公開
 		Screen.SetVarIndicator(0, 0, 0, 0, 0, 0, 0, 0, 0, 0);	// 任意変数インジケータ(変数0, ..., 変数9)
 		Graph.SetTime(Tact, t);									// [s] グラフ描画用の周期と時刻のセット
 		Graph.SetVars(0, 0, 0, 0, 0, 0, 0, 0, 0);	// グラフプロット0 (グラフ番号, 変数0, ..., 変数7)
@@ -133,6 +139,6 @@ void ControlFunctions::UpdateControlValue(void){
 	// ARCS画面パラメータに値を書き込む
 	Screen.SetNetworkLink(NetworkLink);						// ネットワークリンクフラグを書き込む
 	Screen.SetInitializing(Initializing);					// ロボット初期化フラグを書き込む
-	Screen.SetCurrentAndPosition(CurrentRef, PositionRes);	// 電流指令と位置応答を書き込む
+	Screen.SetCurrentAndPosition(CurrentRefBox.Receive(), PositionResBox.Receive());	// 電流指令と位置応答の最新値を書き込む
 }
 
@@ -1,6 +1,6 @@
 //! @file OfflineCalculations.cc
 //! @brief ARCS6 オフライン計算用メインコード
-//! @date 2020/06/10
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //!
 //! @par オフライン計算用のメインコード
@@ -9,7 +9,7 @@
 //! - ARCSライブラリはもちろんそのままいつも通り使用可能。
 //! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
 //!
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -20,19 +20,128 @@
 #include <cassert>
 #include <array>
 #include <complex>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <time.h>
+#include <unistd.h>
 
 // 追加のARCSライブラリをここに記述
 #include "Matrix.hh"
 #include "CsvManipulator.hh"
+#include "SFthread.hh"
 
 using namespace ARCS;
 
+//! @brief SFthread のリアルタイムアルゴリズムごとのジッタとCPU使用率を測定する関数
+//! 制御周期の Load 倍の時間だけ計算したことにして，計測された周期の目標値からのずれを統計処理する。
+//! @tparam	SFA	リアルタイムアルゴリズムのタイプ
+//! @param[in]	Name	表示名
+//! @param[in]	Ts		[ns] 制御周期
+//! @param[in]	CPU		使用するCPUコアの番号
+//! @param[in]	Duration	[s] 測定時間
+//! @param[in]	Load	[-] 制御周期に対する消費時間の割合
+template <SFalgorithm SFA>
+void MeasureJitter(const char* Name, const unsigned long Ts, const int CPU, const double Duration, const double Load){
+	const size_t N = Duration/(Ts*1e-9);	// 測定する周期の数
+	std::vector<double> Tact(N, 0);			// [s] 計測周期の記録 (リアルタイム空間で確保しないように先に確保しておく)
+	size_t k = 0;							// 記録番号
+	timespec CPUstart = {0}, CPUend = {0};	// スレッドのCPU時間
+	timespec WallStart = {0}, WallEnd = {0};// 実時間
+	
+	// 制御用周期実行関数の代わり
+	auto Func = [&](double t, double Tp, double Tc){
+		timespec Now;
+		clock_gettime(CLOCK_THREAD_CPUTIME_ID, &CPUend);
+		clock_gettime(CLOCK_MONOTONIC, &WallEnd);
+		if(k == 0){
+			CPUstart = CPUend;
+			WallStart = WallEnd;
+		}
+		if(k < N) Tact[k++] = Tp;
+		// 消費時間の分だけ空回しする
+		do{
+			clock_gettime(CLOCK_MONOTONIC, &Now);
+		}while((Now.tv_sec - WallEnd.tv_sec)*1e9 + (Now.tv_nsec - WallEnd.tv_nsec) < Load*Ts);
+		return true;
+	};
+	
+	SFthread<SFA> Thread(Ts, Func, CPU);
+	if constexpr(SFA == SFalgorithm::DEADLINE_YIELD) Thread.SetDeadlineRuntime(Ts*8/10);	// 消費時間 Load より余裕を持たせた実行時間
+	Thread.Start();
+	Thread.WaitStart();
+	usleep(Duration*1e6);
+	Thread.Stop();
+	Thread.WaitStop();
+	
+	// 最初の周期は計測周期が定まらないので捨てて，周期の目標値からのずれを統計処理する
+	std::vector<double> Jitter;
+	for(size_t i = 1; i < k; ++i) Jitter.push_back(std::abs(Tact[i] - Ts*1e-9)*1e6);
+	if(Jitter.empty()) return;
+	std::sort(Jitter.begin(), Jitter.end());
+	double Sum = 0;
+	for(const double x : Jitter) Sum += x*x;
+	const double Wall = (WallEnd.tv_sec - WallStart.tv_sec) + (WallEnd.tv_nsec - WallStart.tv_nsec)*1e-9;
+	const double Cpu = (CPUend.tv_sec - CPUstart.tv_sec) + (CPUend.tv_nsec - CPUstart.tv_nsec)*1e-9;
+	printf("%-18s %8.3f %8.3f %8.3f %8.3f %8.1f",
+		Name, std::sqrt(Sum/Jitter.size()), Jitter[Jitter.size()/2], Jitter[(Jitter.size() - 1)*999/1000], Jitter.back(), Cpu/Wall*100);
+	if constexpr(SFA == SFalgorithm::SLEEP_AND_SPIN){
+		printf("   (余裕時間 = %.1f [us])", Thread.GetSpinMargin()*1e6);
+	}
+	if constexpr(SFA == SFalgorithm::DEADLINE_YIELD){
+		printf("   (%s)", Thread.IsDeadlineActive() ? "SCHED_DEADLINE" : "SCHED_DEADLINE 不可のため SLEEP_AND_SPIN で代替");
+	}
+	printf("\n");
+}
+
+//! @brief SFthread のリアルタイムループ1周あたりの固定オーバーヘッドを測定する関数
+//! 制御用関数が N 回続けてクロックオーバーライドを返して待機無しでループを回し，計測周期の分布からループ1周の時間を求める。
+//! @tparam	F	制御用実行関数の型
+//! @param[in]	Name	表示名
+//! @param[in]	Func	制御用実行関数 (N 回目まで false を返すこと)
+//! @param[in]	CPU		使用するCPUコアの番号
+template <typename F>
+void MeasureOverhead(const char* Name, const F& Func, const int CPU){
+	SFthread<SFalgorithm::WITHOUT_ZEROSLEEP, F> Thread(1000000, Func, CPU);
+	Thread.Start();
+	Thread.WaitStart();
+	usleep(2e6);
+	Thread.Stop();
+	Thread.WaitStop();
+	const LatencyHistogram& Hist = Thread.GetPeriodHist();
+	printf("%-18s %8lu %8lu %8lu\n", Name, Hist.GetMin(), Hist.GetPercentile(50), Hist.GetPercentile(99));
+}
+
 //! @brief エントリポイント
 //! @return 終了ステータス
 int main(void){
 	printf("ARCS OFFLINE CALCULATION MODE\n");
 	
 	// ここにオフライン計算のコードを記述
+	// リアルタイムアルゴリズムごとのジッタとCPU使用率の比較 (root権限で実行すること)
+	constexpr unsigned long Ts = 100000;	// [ns] 制御周期
+	constexpr int CPU = 0;					// 使用するCPUコアの番号
+	constexpr double Duration = 5;			// [s] 1つのアルゴリズムあたりの測定時間
+	for(const double Load : {0.05, 0.5}){
+		printf("\n制御周期 %lu [us], 消費時間 %.0f [%%]\n", Ts/1000, Load*100);
+		printf("アルゴリズム       ジッタ[us]: RMS   中央値   99.9%%     最大   CPU使用率[%%]\n");
+		MeasureJitter<SFalgorithm::INSERT_ZEROSLEEP>("INSERT_ZEROSLEEP", Ts, CPU, Duration, Load);
+		MeasureJitter<SFalgorithm::WITHOUT_ZEROSLEEP>("WITHOUT_ZEROSLEEP", Ts, CPU, Duration, Load);
+		MeasureJitter<SFalgorithm::SLEEP_AND_SPIN>("SLEEP_AND_SPIN", Ts, CPU, Duration, Load);
+		MeasureJitter<SFalgorithm::DEADLINE_YIELD>("DEADLINE_YIELD", Ts, CPU, Duration, Load);
+	}
+	
+	// 制御用実行関数の呼び出し方によるループ1周あたりの固定オーバーヘッドの比較 (root権限で実行すること)
+	constexpr unsigned long N = 1000000;	// 待機無しで回す周期の数
+	unsigned long k = 0;					// 周期の数
+	auto FuncSec = [&](double t, double Tp, double Tc){ return N <= ++k; };	// [s] 単位の実数で受け取る制御用関数
+	auto FuncNsec = [&](std::chrono::nanoseconds t, std::chrono::nanoseconds Tp, std::chrono::nanoseconds Tc){ return N <= ++k; };	// [ns] 単位の整数で受け取る制御用関数
+	printf("\n制御用実行関数の型     ループ1周の時間[ns]: 最小   中央値      99%%\n");
+	k = 0;
+	MeasureOverhead<SFfunction>("std::function", FuncSec, CPU);
+	k = 0;
+	MeasureOverhead("template callable", FuncNsec, CPU);
 	
 	return EXIT_SUCCESS;	// 正常終了
 }
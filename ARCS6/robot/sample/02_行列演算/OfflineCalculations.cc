@@ -24,9 +24,86 @@
 // 追加のARCSライブラリをここに記述
 #include "Matrix.hh"
 #include "CsvManipulator.hh"
+#include "BatchProcessor.hh"
 
 using namespace ARCS;
 
+//! @brief 確認結果を表示する関数
+//! @param[in]		Name	確認項目の名前
+//! @param[in]		Passed	true = 期待どおり
+//! @param[in,out]	Failed	期待どおりでなかった項目の数
+void Check(const char* Name, const bool Passed, int& Failed){
+	printf("%-42s : %s\n", Name, Passed ? "OK" : "NG");
+	if(Passed == false) ++Failed;
+}
+
+//! @brief 2つの行列のすべての要素が等しいかを返す関数
+template <size_t N, size_t M>
+bool IsEqual(const Matrix<N,M>& A, const Matrix<N,M>& B){
+	return sumall(abse(A - B)) == 0;
+}
+
+//! @brief ビューへの代入が元の行列に書き込まれることを確認する関数
+//! @return	期待どおりでなかった項目の数
+int CheckViews(void){
+	int Failed = 0;
+	Matrix<4,4> A = {
+		 1,  2,  3,  4,
+		 5,  6,  7,  8,
+		 9, 10, 11, 12,
+		13, 14, 15, 16
+	};
+	
+	// 部分行列のビューへの代入は元の行列の該当部分だけを書き換える
+	Matrix<4,4> Aref = A;
+	subview<2,2>(A, 2, 3) = Matrix<2,2>::eye();
+	Aref.Data[1][2] = 1; Aref.Data[2][2] = 0;
+	Aref.Data[1][3] = 0; Aref.Data[2][3] = 1;
+	Check("subview writes through to parent", IsEqual(A, Aref), Failed);
+	
+	// 加算代入と式の代入も元の行列へ直接書き込まれる
+	subview<2,2>(A, 2, 3) += Matrix<2,2>::ones();
+	Aref.Data[1][2] += 1; Aref.Data[2][2] += 1;
+	Aref.Data[1][3] += 1; Aref.Data[2][3] += 1;
+	Check("subview += writes through to parent", IsEqual(A, Aref), Failed);
+	
+	// 横ベクトルのビューへの代入は元の行列の1行だけを書き換える
+	const Matrix<4,1> r = {-1, -2, -3, -4};
+	rowview(A, 4) = r;
+	for(size_t i = 0; i < 4; ++i) Aref.Data[i][3] = r.Data[i][0];
+	Check("rowview writes through to parent", IsEqual(A, Aref), Failed);
+	Check("rowview reads parent row", IsEqual(Matrix<4,1>(rowview(A, 4)), r), Failed);
+	
+	// 列ベクトルのビューは転置しても同じ要素を指す
+	tp(columnview(A, 1)) = Matrix<4,1>::zeros();
+	for(size_t j = 0; j < 4; ++j) Aref.Data[0][j] = 0;
+	Check("tp(columnview) writes through to parent", IsEqual(A, Aref), Failed);
+	
+	// ミニバッチのビューへの代入はデータセット行列の該当する行を書き換える
+	Matrix<2,6> U = {
+		 1,  2,
+		 3,  4,
+		 5,  6,
+		 7,  8,
+		 9, 10,
+		11, 12
+	};
+	const Matrix<2,6> U0 = U;
+	const Matrix<3,2> Y = BatchProcessor::GetMiniBatchView<2,6,3>(U, 2);
+	Matrix<2,3> Ubatch;
+	getsubmatrix(U0, 1, 4, Ubatch);
+	Check("GetMiniBatchView reads transposed batch", IsEqual(Y, tp(Ubatch)), Failed);
+	BatchProcessor::GetMiniBatchView<2,6,3>(U, 2) = 10.0*Y;
+	bool Written = true;
+	for(size_t j = 0; j < 6; ++j){
+		const double s = 3 <= j ? 10 : 1;	// 2番目のミニバッチ(4～6行目)だけが10倍になる
+		Written &= U.Data[0][j] == s*U0.Data[0][j] && U.Data[1][j] == s*U0.Data[1][j];
+	}
+	Check("GetMiniBatchView writes through to parent", Written, Failed);
+	
+	return Failed;
+}
+
 //! @brief エントリポイント
 //! @return 終了ステータス
 int main(void){
@@ -734,6 +811,11 @@ int main(void){
 	printf("rank(Ark) = %zu\n", RankOfArk);
 	static_assert(rank(Ark) == 2);
 	
-	return EXIT_SUCCESS;	// 正常終了
+	// 行列ビューのテスト
+	printf("\n◆ 行列ビューのテスト\n");
+	const int Failed = CheckViews();
+	printf("%d failed\n", Failed);
+	
+	return Failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;	// ビューのテストがすべて期待どおりなら正常終了
 }
 
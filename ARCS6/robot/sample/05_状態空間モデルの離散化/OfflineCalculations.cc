@@ -1,6 +1,6 @@
 //! @file OfflineCalculations.cc
 //! @brief ARCS6 オフライン計算用メインコード
-//! @date 2020/05/03
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //!
 //! @par オフライン計算用のメインコード
@@ -9,7 +9,7 @@
 //! - ARCSライブラリはもちろんそのままいつも通り使用可能。
 //! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
 //!
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -63,13 +63,13 @@ int main(void){
 	printf("\n◆ 連続系状態空間モデルの離散化(普通版)\n");
 	Matrix<3,3> Ad;
 	Matrix<2,3> Bd;
-	Discret::GetDiscSystem(Ac, Bc, Ad, Bd, Ts);	// 離散化
+	Discret::GetDiscSystem(Ac, Bc, Ad, Bd, Ts);	// 離散化 (拡大行列の指数行列による厳密な零次ホールド離散化)
 	PrintMatrix(Ad, "% 16.14e");   				// 離散系状態空間モデルのA行列の表示
 	PrintMatrix(Bd, "% 16.14e");   				// 離散系状態空間モデルのB行列の表示
 	
 	// 連続系状態空間モデルの離散化(普通版, パデ近似の次数と定積分の分割数を設定する版)
 	printf("\n◆ 連続系状態空間モデルの離散化(普通版, パデ近似の次数と定積分の分割数を設定する版)\n");
-	Discret::GetDiscSystem(Ac, Bc, Ad, Bd, Ts, 100, 100000);// 離散化
+	Discret::GetDiscSystem(Ac, Bc, Ad, Bd, Ts, 100, 100000);// 離散化 (B行列はシンプソン法による定積分)
 	PrintMatrix(Ad, "% 16.14e");   				// 離散系状態空間モデルのA行列の表示
 	PrintMatrix(Bd, "% 16.14e");   				// 離散系状態空間モデルのB行列の表示
 	
@@ -102,6 +102,15 @@ int main(void){
 	PrintMatrix(Adx, "% 16.14e");   			// 離散系状態空間モデルのA行列の表示
 	PrintMatrix(Bdx, "% 16.14e");   			// 離散系状態空間モデルのB行列の表示
 	
+	// 2慣性共振系の連続系状態空間モデルのコンパイル時離散化(普通版と同じ精度の場合)
+	// C++17ではconstexprの構造化束縛はできないので，ペアで受けてから取り出す
+	printf("\n◆ 2慣性共振系の連続系状態空間モデルのコンパイル時離散化(普通版と同じ精度の場合)\n");
+	constexpr auto ABdx = Discret::GetDiscSystem(Acx, Bcx, Ts);	// 離散化
+	constexpr Matrix<3,3> Adx2 = ABdx.first;
+	constexpr Matrix<2,3> Bdx2 = ABdx.second;
+	PrintMatrix(Adx2, "% 16.14e");   			// 離散系状態空間モデルのA行列の表示
+	PrintMatrix(Bdx2, "% 16.14e");   			// 離散系状態空間モデルのB行列の表示
+	
 	return EXIT_SUCCESS;	// 正常終了
 }
 
@@ -0,0 +1,149 @@
+//! @file OfflineCalculations.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+
+// 基本のインクルードファイル
+#include <stdio.h>
+#include <cstdlib>
+#include <cassert>
+#include <array>
+#include <complex>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <algorithm>
+
+// 追加のARCSライブラリをここに記述
+#include "Matrix.hh"
+#include "CsvManipulator.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+
+//! @brief 普通のループ版の行列積(SIMD版との比較用)
+template <size_t N, size_t M, size_t K, typename T>
+void ScalarProduct(const Matrix<N,M,T>& A, const Matrix<K,N,T>& B, Matrix<K,M,T>& Y){
+	Y.FillAllZero();
+	for(size_t k = 0; k < K; ++k){
+		for(size_t i = 0; i < N; ++i){
+			for(size_t j = 0; j < M; ++j) Y.Data[k][j] += A.Data[i][j]*B.Data[k][i];
+		}
+	}
+}
+
+//! @brief SIMD版と普通のループ版の行列積を比較して消費時間を表示する関数
+template <size_t N, typename T>
+void CompareProduct(const char* TypeName){
+	constexpr size_t LOOP = 100000;	// 繰り返し回数
+	RandomGenerator Rnd(-1, 1);
+	Matrix<N,N> Ad, Bd;
+	Rnd.GetRandomMatrix(Ad);
+	Rnd.GetRandomMatrix(Bd);
+	Matrix<N,N,T> A, B, Y, Yref;
+	for(size_t i = 0; i < N; ++i){
+		for(size_t j = 0; j < N; ++j){
+			A.Data[i][j] = (T)Ad.Data[i][j];
+			B.Data[i][j] = (T)Bd.Data[i][j];
+		}
+	}
+	
+	// 誤差の確認 (許容誤差 = N×機械イプシロン×Σ|a||b|, 乱数の範囲が±1なので Σ|a||b| ≦ N)
+	Y = A*B;
+	ScalarProduct(A, B, Yref);
+	T ErrMax = 0;
+	for(size_t i = 0; i < N; ++i){
+		for(size_t j = 0; j < N; ++j) ErrMax = std::max(ErrMax, std::abs(Y.Data[i][j] - Yref.Data[i][j]));
+	}
+	const T Tolerance = (T)(N*N)*std::numeric_limits<T>::epsilon();
+	printf("%2zux%-2zu %-6s : 最大誤差 = %e (許容誤差 %e) %s\n", N, N, TypeName, (double)ErrMax, (double)Tolerance, ErrMax <= Tolerance ? "OK" : "NG");
+	
+	// 消費時間の計測
+	auto start_time = std::chrono::steady_clock::now();
+	for(size_t l = 0; l < LOOP; ++l){
+		Y = A*B;
+		A.Data[0][0] = Y.Data[0][0]*(T)1e-3;	// 最適化で消されないように依存させる
+	}
+	auto end_time = std::chrono::steady_clock::now();
+	const double TimeSIMD = std::chrono::duration<double, std::nano>(end_time - start_time).count()/LOOP;
+	start_time = std::chrono::steady_clock::now();
+	for(size_t l = 0; l < LOOP; ++l){
+		ScalarProduct(A, B, Y);
+		A.Data[0][0] = Y.Data[0][0]*(T)1e-3;	// 最適化で消されないように依存させる
+	}
+	end_time = std::chrono::steady_clock::now();
+	const double TimeScalar = std::chrono::duration<double, std::nano>(end_time - start_time).count()/LOOP;
+	printf("%2zux%-2zu %-6s : A*B = %8.1f [ns] (普通のループ %8.1f [ns])\n", N, N, TypeName, TimeSIMD, TimeScalar);
+}
+
+//! @brief 大きい行列の積の消費時間と演算性能を表示する関数
+//! 大きい行列はスタックに置かずにヒープに確保する(アライメントはC++17のnewで保証される)
+template <size_t N>
+void MeasureLargeProduct(void){
+	constexpr size_t LOOP = 20000000/(N*N*N) + 1;	// 繰り返し回数
+	RandomGenerator Rnd(-1, 1);
+	auto A = std::make_unique<Matrix<N,N>>(), B = std::make_unique<Matrix<N,N>>(), Y = std::make_unique<Matrix<N,N>>();
+	Rnd.GetRandomMatrix(*A);
+	Rnd.GetRandomMatrix(*B);
+	double TimeMin = std::numeric_limits<double>::max();
+	for(size_t r = 0; r < 5; ++r){
+		// 5回計測して最短の時間を採用
+		const auto start_time = std::chrono::steady_clock::now();
+		for(size_t l = 0; l < LOOP; ++l){
+			mul_into(*Y, *A, *B);
+			A->Data[0][0] = Y->Data[0][0]*1e-9;	// 最適化で消されないように依存させる
+		}
+		const auto end_time = std::chrono::steady_clock::now();
+		TimeMin = std::min(TimeMin, std::chrono::duration<double, std::micro>(end_time - start_time).count()/LOOP);
+	}
+	printf("%3zux%-3zu double : A*B = %9.2f [us] (%5.1f [GFLOP/s])\n", N, N, TimeMin, 2.0*N*N*N/TimeMin*1e-3);
+}
+
+//! @brief エントリポイント
+//! @return 終了ステータス
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+	
+	// ここにオフライン計算のコードを記述
+	printf("SIMD有効(double) = %d, SIMD有効(float) = %d\n\n", Matrix<1,1,double>::isEnabledSIMD(), Matrix<1,1,float>::isEnabledSIMD());
+	
+	CompareProduct< 6, double>("double");
+	CompareProduct<12, double>("double");
+	CompareProduct< 6, float >("float");
+	CompareProduct<12, float >("float");
+	printf("\n");
+	MeasureLargeProduct< 64>();
+	MeasureLargeProduct<256>();
+	
+	// 転置と要素ごとの演算はビット単位で一致するはず
+	Matrix<12,12> A, B;
+	RandomGenerator Rnd(-1, 1);
+	Rnd.GetRandomMatrix(A);
+	Rnd.GetRandomMatrix(B);
+	const Matrix<12,12> At = tp(A), Sum = A + B, Dif = A - B, Had = A & B, Hdv = A % B;
+	bool BitExact = true;
+	for(size_t i = 0; i < 12; ++i){
+		for(size_t j = 0; j < 12; ++j){
+			if(At.Data[i][j]  != A.Data[j][i]) BitExact = false;
+			if(Sum.Data[i][j] != A.Data[i][j] + B.Data[i][j]) BitExact = false;
+			if(Dif.Data[i][j] != A.Data[i][j] - B.Data[i][j]) BitExact = false;
+			if(Had.Data[i][j] != A.Data[i][j]*B.Data[i][j]) BitExact = false;
+			if(Hdv.Data[i][j] != A.Data[i][j]/B.Data[i][j]) BitExact = false;
+		}
+	}
+	printf("\n転置と要素ごとの演算のビット一致 : %s\n", BitExact ? "OK" : "NG");
+	
+	return EXIT_SUCCESS;	// 正常終了
+}
+
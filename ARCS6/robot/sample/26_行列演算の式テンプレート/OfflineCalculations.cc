@@ -0,0 +1,202 @@
+//! @file OfflineCalculations.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+
+// 基本のインクルードファイル
+#include <stdio.h>
+#include <cstdlib>
+#include <cassert>
+#include <array>
+#include <complex>
+#include <chrono>
+#include <type_traits>
+
+// 追加のARCSライブラリをここに記述
+#include "Matrix.hh"
+#include "CsvManipulator.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+
+//! @brief 従来の演算子と同じ計算の行列積(零埋めした中間の行列を返す，式テンプレートとの比較用)
+template <size_t N, size_t M, size_t K>
+Matrix<K,M> EagerProduct(const Matrix<N,M>& A, const Matrix<K,N>& B){
+	Matrix<K,M> ret;
+	if constexpr(Matrix<K,M>::isEnabledSIMD()){
+		MatrixSIMD::MatMul<N,M,K>(ret.Data[0].data(), A.Data[0].data(), B.Data[0].data());
+		return ret;
+	}
+	for(size_t k = 0; k < K; ++k){
+		for(size_t i = 0; i < N; ++i){
+			for(size_t j = 0; j < M; ++j) ret.Data[k][j] += A.Data[i][j]*B.Data[k][i];
+		}
+	}
+	return ret;
+}
+
+//! @brief 安定な離散系A行列をランダムに生成する関数
+template <size_t N>
+Matrix<N,N> GetStableMatrix(RandomGenerator& Rnd){
+	Matrix<N,N> A;
+	Rnd.GetRandomMatrix(A);
+	return 0.1/(double)N*A + 0.5*Matrix<N,N>::eye();
+}
+
+//! @brief 関数の1回あたりの消費時間を計測する関数 (他の処理の割り込みの影響を除くため，ブロックごとの平均の最小値を返す)
+//! @param[in]	Func	計測対象の関数
+//! @return	消費時間 [ns]
+template <typename F>
+double MeasureTime(F&& Func){
+	constexpr size_t BLOCK = 20;		// ブロック数
+	constexpr size_t LOOP = 50000;		// 1ブロックあたりの繰り返し回数
+	double TimeMin = 1e9;
+	for(size_t b = 0; b < BLOCK; ++b){
+		const auto start_time = std::chrono::steady_clock::now();
+		for(size_t l = 0; l < LOOP; ++l) Func();
+		const auto end_time = std::chrono::steady_clock::now();
+		TimeMin = std::min(TimeMin, std::chrono::duration<double, std::nano>(end_time - start_time).count()/LOOP);
+	}
+	return TimeMin;
+}
+
+//! @brief 観測器の更新式の消費時間を式テンプレート版と従来版で比較する関数
+//! @tparam	N	状態の数
+//! @tparam	K	入力の数
+template <size_t N, size_t K>
+void CompareObserverUpdate(void){
+	RandomGenerator Rnd(-1, 1);
+	const Matrix<N,N> Ad = GetStableMatrix<N>(Rnd);	// 離散系A行列
+	Matrix<K,N> Bd;	// 離散系B行列
+	Matrix<N,K> Cd;	// 出力行列
+	Matrix<K,N> Ld;	// オブザーバゲイン
+	Matrix<1,K> u, y;
+	Rnd.GetRandomMatrix(Bd);
+	Rnd.GetRandomMatrix(Cd);
+	Rnd.GetRandomMatrix(Ld);
+	Rnd.GetRandomMatrix(u);
+	Rnd.GetRandomMatrix(y);
+	Ld = 0.01*Ld;
+	
+	// 状態方程式 x[k+1] = Ad*x[k] + Bd*u[k], y[k] = Cd*x[k]
+	Matrix<1,N> x1, x2, xnext;
+	Matrix<1,K> y1, y2;
+	const double TimeExprSS = MeasureTime([&](){
+		xnext = lazy(Ad)*x1 + lazy(Bd)*u;
+		y1 = lazy(Cd)*x1;
+		x1 = xnext;
+	});
+	const double TimeEagerSS = MeasureTime([&](){
+		xnext = EagerProduct(Ad, x2) + EagerProduct(Bd, u);
+		y2 = EagerProduct(Cd, x2);
+		x2 = xnext;
+	});
+	const double ErrSS = std::max(std::abs(absmax(x1 - x2)), std::abs(absmax(y1 - y2)));
+	
+	// 同一次元オブザーバ xh[k+1] = Ad*xh[k] + Bd*u[k] + Ld*(y[k] - Cd*xh[k])
+	Matrix<1,N> xh1, xh2, xhnext;
+	const double TimeExprOb = MeasureTime([&](){
+		xhnext = lazy(Ad)*xh1 + lazy(Bd)*u + lazy(Ld)*(y - lazy(Cd)*xh1);	// 代入先が式に現れないので一時行列を経由しない
+		xh1 = xhnext;
+	});
+	const double TimeEagerOb = MeasureTime([&](){
+		xh2 = EagerProduct(Ad, xh2) + EagerProduct(Bd, u) + EagerProduct(Ld, Matrix<1,K>(y - EagerProduct(Cd, xh2)));
+	});
+	const double ErrOb = std::abs(absmax(xh1 - xh2));
+	
+	printf("N = %2zu, K = %2zu : 状態方程式 %7.1f [ns] (従来 %7.1f [ns], %4.2f倍)  差 = %e\n", N, K, TimeExprSS, TimeEagerSS, TimeEagerSS/TimeExprSS, ErrSS);
+	printf("N = %2zu, K = %2zu : オブザーバ %7.1f [ns] (従来 %7.1f [ns], %4.2f倍)  差 = %e\n", N, K, TimeExprOb, TimeEagerOb, TimeEagerOb/TimeExprOb, ErrOb);
+}
+
+//! @brief 確認結果を表示する関数
+//! @param[in]		Name	確認項目の名前
+//! @param[in]		Passed	true = 期待どおり
+//! @param[in,out]	Failed	期待どおりでなかった項目の数
+void Check(const char* Name, const bool Passed, int& Failed){
+	printf("%-42s : %s\n", Name, Passed ? "OK" : "NG");
+	if(Passed == false) ++Failed;
+}
+
+//! @brief 2つの行列のすべての要素が等しいかを返す関数
+template <size_t N, size_t M>
+bool IsEqual(const Matrix<N,M>& A, const Matrix<N,M>& B){
+	return sumall(abse(A - B)) == 0;
+}
+
+//! @brief lazy() を付けたときだけ式のまま残ることを確認する関数
+//! @return	期待どおりでなかった項目の数
+int CheckLazy(void){
+	int Failed = 0;
+	Matrix<3,3> A = {
+		1, 2,  3,
+		4, 5,  6,
+		7, 8, 10
+	};
+	Matrix<1,3> x = {1, 2, 3}, u = {1, 0, -1};
+	
+	// lazy() を付けない積と和は，auto で受けても値を持った行列になる
+	auto P = A*x + A*u;
+	static_assert(std::is_same_v<decltype(P), Matrix<1,3>>, "A*x + A*u must be a Matrix");
+	const Matrix<1,3> P0 = P;
+	A = 2.0*A;
+	Check("auto of A*x + A*u owns its values", IsEqual(P, P0), Failed);
+	
+	// lazy() を付けた式は，代入のときに計算される
+	auto E = lazy(A)*x + lazy(A)*u;
+	static_assert(MatrixExprOp::IsExpr<decltype(E)>(), "lazy(A)*x must be an expression");
+	const Matrix<1,3> Y = E;
+	Check("lazy(A)*x + lazy(A)*u equals A*x + A*u", IsEqual(Y, 2.0*P0), Failed);
+	
+	// 代入先が式の中に現れても正しく計算される
+	const Matrix<1,3> x0 = x;
+	x = lazy(A)*x;
+	Check("x = lazy(A)*x with aliasing", IsEqual(x, A*x0), Failed);
+	
+	return Failed;
+}
+
+//! @brief エントリポイント
+//! @return 終了ステータス
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+	
+	// ここにオフライン計算のコードを記述
+	// 式テンプレートは定数式でも使える
+	constexpr Matrix<2,2> Ac = {
+		0, 1,
+		-2, -3
+	};
+	constexpr Matrix<1,2> xc = {1, 2};
+	constexpr Matrix<1,2> yc = lazy(Ac)*xc + 2.0*(lazy(Ac)*xc) - xc;
+	static_assert(yc.Data[0][1] == 3*(-2 - 6) - 2, "constexpr Error");
+	PrintMat(yc);
+	
+	// 遅延評価の確認
+	const int Failed = CheckLazy();
+	printf("%d failed\n\n", Failed);
+	
+	// 1軸 (2次の状態, 1入出力)
+	CompareObserverUpdate< 2,1>();
+	// 2慣性系 (4次の状態, 1入出力)
+	CompareObserverUpdate< 4,1>();
+	// 3軸 (6次の状態, 3入出力)
+	CompareObserverUpdate< 6,3>();
+	// 6軸 (12次の状態, 6入出力)
+	CompareObserverUpdate<12,6>();
+	// 16軸 (32次の状態, 16入出力)
+	CompareObserverUpdate<32,16>();
+	
+	return Failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;	// すべて期待どおりなら正常終了
+}
+
@@ -0,0 +1,214 @@
+//! @file OfflineCalculations.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+
+// 基本のインクルードファイル
+#include <stdio.h>
+#include <cstdlib>
+#include <cassert>
+#include <array>
+#include <complex>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <pthread.h>
+
+// 追加のARCSライブラリをここに記述
+#include "Matrix.hh"
+#include "DynMatrix.hh"
+#include "MatrixThreadPool.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+
+//! @brief 動的サイズ行列に乱数を書き込む関数
+//! @param[in]	Rnd	乱数生成器
+//! @param[out]	Y	乱数行列
+void GetRandomDynMatrix(RandomGenerator& Rnd, DynMatrix<>& Y){
+	for(size_t n = 0; n < Y.GetWidth(); ++n){
+		for(size_t m = 0; m < Y.GetHeight(); ++m) Y(n,m) = Rnd.GetDoubleRandom();	// 列ごとに連続した格納順に乱数値を書き込む
+	}
+}
+
+//! @brief 行列の要素の絶対値の最大値を返す関数
+//! @param[in]	U	入力行列
+//! @return	最大値
+double MaxAbs(const DynMatrix<>& U){
+	double y = 0;
+	for(size_t n = 0; n < U.GetWidth(); ++n){
+		for(size_t m = 0; m < U.GetHeight(); ++m) y = std::max(y, std::abs(U(n,m)));
+	}
+	return y;
+}
+
+//! @brief 処理の消費時間を返す関数
+//! @param[in]	func	計測する処理
+//! @return	消費時間 [ms]
+template <typename F>
+double MeasureTime(F func){
+	const auto start_time = std::chrono::steady_clock::now();
+	func();
+	const auto end_time = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end_time - start_time).count();
+}
+
+//! @brief スタックを大きくしたスレッドで処理を実行する関数
+//! 固定サイズ行列の関数は作業用の行列をスタックに置くので，大きい行列ではメインスレッドのスタックが足りなくなるため
+//! @param[in]	func	実行する処理
+void RunWithLargeStack(const std::function<void(void)>& func){
+	pthread_attr_t Attr;
+	pthread_attr_init(&Attr);
+	pthread_attr_setstacksize(&Attr, (size_t)1 << 30);	// 1GiB (実際に使った分だけ確保される)
+	pthread_t ThreadID;
+	pthread_create(&ThreadID, &Attr, [](void* p) -> void* { (*static_cast<const std::function<void(void)>*>(p))(); return nullptr; }, const_cast<std::function<void(void)>*>(&func));
+	pthread_join(ThreadID, nullptr);
+	pthread_attr_destroy(&Attr);
+}
+
+//! @brief スレッドプールの並列計算で範囲の取りこぼしや重複が無いかを確認する関数
+//! 分割数が毎回変わるように範囲の大きさを変えながら，複数の呼び出し元スレッドから何度も並列計算させる。
+//! (ThreadSanitizer を有効にしてビルドすると，スレッドプール内のデータ競合も確認できる)
+//! @param[in]	NumThreads	スレッドプールのスレッド数
+//! @param[in]	NumCallers	並列計算を呼び出すスレッドの数
+//! @param[in]	Repeat		1つの呼び出し元スレッドあたりの並列計算の回数
+//! @return	範囲の取りこぼしか重複があった回数
+size_t StressThreadPool(const size_t NumThreads, const size_t NumCallers, const size_t Repeat){
+	MatrixThreadPool::SetNumThreads(NumThreads);
+	std::vector<size_t> Errors(NumCallers, 0);
+	std::vector<std::thread> Callers;
+	for(size_t c = 0; c < NumCallers; ++c){
+		Callers.emplace_back([=, &Errors]{
+			std::vector<int> Visits(2*NumThreads);
+			for(size_t k = 0; k < Repeat; ++k){
+				const size_t Len = 1 + (k*7 + c) % (2*NumThreads);	// 分割数が 1 からスレッド数まで変わるようにする
+				std::fill(Visits.begin(), Visits.end(), 0);
+				MatrixThreadPool::ParallelFor(0, Len, 1, [&](size_t Begin, size_t End){
+					for(size_t i = Begin; i < End; ++i) ++Visits[i];	// 範囲が重ならなければ競合しない
+				});
+				for(size_t i = 0; i < Visits.size(); ++i){
+					if(Visits[i] != (i < Len ? 1 : 0)) ++Errors[c];
+				}
+			}
+		});
+	}
+	for(std::thread& t : Callers) t.join();
+	MatrixThreadPool::SetNumThreads(1);
+	size_t ret = 0;
+	for(const size_t e : Errors) ret += e;
+	return ret;
+}
+
+//! @brief 固定サイズ行列版(逐次計算)と動的サイズ行列版(ブロック版＋並列計算)の消費時間を比較する関数
+//! @param[in]	MeasureFixedAll	true = 固定サイズ行列版の逆行列とQR分解も計測する
+template <size_t N>
+void CompareWithMatrix(const bool MeasureFixedAll){
+	RandomGenerator Rnd(-1, 1);
+	auto A = std::make_unique<Matrix<N,N>>(), L = std::make_unique<Matrix<N,N>>(), U = std::make_unique<Matrix<N,N>>();
+	auto v = std::make_unique<Matrix<1,N,int>>();
+	Rnd.GetRandomMatrix(*A);
+	const DynMatrix<> Ad(*A);
+	
+	// 固定サイズ行列版
+	double FixedLU = 0, FixedInv = 0, FixedQR = 0;
+	RunWithLargeStack([&]{
+		FixedLU = MeasureTime([&]{ LU(*A, *L, *U, *v); });
+		if(MeasureFixedAll == false) return;
+		FixedInv = MeasureTime([&]{ *L = inv(*A); });
+		FixedQR = MeasureTime([&]{ QR(*A, *L, *U); });
+	});
+	
+	// 動的サイズ行列版 (スレッド数1と全コア)
+	const size_t Threads[] = {1, std::max(std::thread::hardware_concurrency(), 1u)};
+	double DynLU[2], DynInv[2], DynQR[2];
+	DynMatrix<> Ld, Ud, Yd, Qd, Rd;
+	std::vector<int> vd;
+	for(size_t i = 0; i < 2; ++i){
+		MatrixThreadPool::SetNumThreads(Threads[i]);
+		DynLU[i] = MeasureTime([&]{ LU(Ad, Ld, Ud, vd); });
+		DynInv[i] = MeasureTime([&]{ Yd = inv(Ad); });
+		DynQR[i] = MeasureTime([&]{ QR(Ad, Qd, Rd); });
+	}
+	MatrixThreadPool::SetNumThreads(1);
+	
+	printf("%3zux%-3zu  LU分解 : 固定 %9.1f [ms], 動的(1スレッド) %7.1f [ms], 動的(%zuスレッド) %7.1f [ms]\n", N, N, FixedLU, DynLU[0], Threads[1], DynLU[1]);
+	if(MeasureFixedAll == true){
+		printf("%3zux%-3zu  逆行列 : 固定 %9.1f [ms], 動的(1スレッド) %7.1f [ms], 動的(%zuスレッド) %7.1f [ms]\n", N, N, FixedInv, DynInv[0], Threads[1], DynInv[1]);
+		printf("%3zux%-3zu  QR分解 : 固定 %9.1f [ms], 動的(1スレッド) %7.1f [ms], 動的(%zuスレッド) %7.1f [ms]\n", N, N, FixedQR, DynQR[0], Threads[1], DynQR[1]);
+	}else{
+		printf("%3zux%-3zu  逆行列 : 固定     (省略)     , 動的(1スレッド) %7.1f [ms], 動的(%zuスレッド) %7.1f [ms]\n", N, N, DynInv[0], Threads[1], DynInv[1]);
+		printf("%3zux%-3zu  QR分解 : 固定     (省略)     , 動的(1スレッド) %7.1f [ms], 動的(%zuスレッド) %7.1f [ms]\n", N, N, DynQR[0], Threads[1], DynQR[1]);
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了ステータス
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+	
+	// ここにオフライン計算のコードを記述
+	RandomGenerator Rnd(-1, 1);
+	
+	// 固定サイズ行列との相互変換と，同じ計算結果になることの確認
+	printf("固定サイズ行列との比較\n");
+	Matrix<5,5> A;
+	Rnd.GetRandomMatrix(A);
+	const DynMatrix<> Ad(A);			// 固定サイズ → 動的サイズ
+	Matrix<5,5> L, U, Q, R;
+	Matrix<1,5,int> v;
+	LU(A, L, U, v);
+	QR(A, Q, R);
+	DynMatrix<> Ld, Ud, Qd, Rd;
+	std::vector<int> vd;
+	LU(Ad, Ld, Ud, vd);
+	QR(Ad, Qd, Rd);
+	const Matrix<5,5> Ainv = inv(Ad).ToMatrix<5,5>();	// 動的サイズ → 固定サイズ
+	printf("LU分解  : |L - Ld| = %e, |U - Ud| = %e\n", MaxAbs(DynMatrix<>(L) - Ld), MaxAbs(DynMatrix<>(U) - Ud));
+	printf("QR分解  : |Q - Qd| = %e, |R - Rd| = %e\n", MaxAbs(DynMatrix<>(Q) - Qd), MaxAbs(DynMatrix<>(R) - Rd));
+	printf("逆行列  : |inv(A) - inv(Ad)| = %e\n", MaxAbs(DynMatrix<>(inv(A)) - DynMatrix<>(Ainv)));
+	printf("行列式  : det(A) = %f, det(Ad) = %f\n\n", det(A), det(Ad));
+	
+	// スレッドプールの動作確認
+	printf("スレッドプール : 範囲の取りこぼし・重複 %zu 回\n\n", StressThreadPool(4, 3, 20000));
+	
+	// スタックに置けない大きさの行列の計算
+	constexpr size_t N = 1000;
+	printf("%zux%zu の行列の計算\n", N, N);
+	DynMatrix<> X(N,N), Y(N,N), Z, b(1,N), x, Xinv, Qx, Rx;
+	GetRandomDynMatrix(Rnd, X);
+	GetRandomDynMatrix(Rnd, Y);
+	GetRandomDynMatrix(Rnd, b);
+	const double TimeMul = MeasureTime([&]{ Z = X*Y; });
+	printf("行列積  : %8.1f [ms] (%5.1f [GFLOP/s])\n", TimeMul, 2.0*N*N*N/TimeMul*1e-6);
+	const double TimeSolve = MeasureTime([&]{ x = solve(X, b); });
+	printf("求解    : %8.1f [ms] (残差 |X*x - b| = %e)\n", TimeSolve, MaxAbs(X*x - b));
+	const double TimeInv = MeasureTime([&]{ Xinv = inv(X); });
+	printf("逆行列  : %8.1f [ms] (残差 |X*inv(X) - I| = %e)\n", TimeInv, MaxAbs(X*Xinv - DynMatrix<>::eye(N)));
+	const double TimeQR = MeasureTime([&]{ QR(X, Qx, Rx); });
+	printf("QR分解  : %8.1f [ms] (残差 |Q*R - X| = %e)\n", TimeQR, MaxAbs(Qx*Rx - X));
+	
+	// 固定サイズ行列版との消費時間の比較
+	// 固定サイズ行列版の512x512の逆行列とQR分解は数分かかるので，計測するときは MEASURE_SLOW_FIXED を true にする
+	constexpr bool MEASURE_SLOW_FIXED = false;
+	printf("\n固定サイズ行列版(逐次計算)との比較\n");
+	CompareWithMatrix<128>(true);
+	CompareWithMatrix<256>(true);
+	CompareWithMatrix<512>(MEASURE_SLOW_FIXED);
+	
+	return EXIT_SUCCESS;	// 正常終了
+}
+
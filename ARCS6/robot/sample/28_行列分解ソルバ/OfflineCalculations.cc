@@ -0,0 +1,186 @@
+//! @file OfflineCalculations.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+
+// 基本のインクルードファイル
+#include <stdio.h>
+#include <cstdlib>
+#include <cassert>
+#include <array>
+#include <complex>
+#include <chrono>
+#include <algorithm>
+
+// 追加のARCSライブラリをここに記述
+#include "Matrix.hh"
+#include "MatrixDecomposition.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+
+//! @brief 行列の要素の絶対値の最大値を返す関数
+//! @param[in]	U	入力行列
+//! @return	最大値
+template <size_t N, size_t M, typename TT>
+double MaxAbs(const Matrix<N,M,TT>& U){
+	double y = 0;
+	for(size_t n = 1; n <= N; ++n){
+		for(size_t m = 1; m <= M; ++m) y = std::max(y, std::abs(U.GetElement(n,m)));
+	}
+	return y;
+}
+
+//! @brief 処理の平均消費時間を返す関数
+//! @param[in]	func	計測する処理
+//! @param[in]	LOOP	繰り返し回数
+//! @return	1回あたりの消費時間 [us]
+template <typename F>
+double MeasureTime(F func, const size_t LOOP = 10000){
+	const auto start_time = std::chrono::steady_clock::now();
+	for(size_t i = 0; i < LOOP; ++i) func();
+	const auto end_time = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::micro>(end_time - start_time).count()/LOOP;
+}
+
+//! @brief エントリポイント
+//! @return 終了ステータス
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+	
+	// ここにオフライン計算のコードを記述
+	RandomGenerator Rnd(-1, 1);
+	
+	// 対称正定値行列をコレスキー分解して，右辺を変えながら解く
+	printf("コレスキー分解と修正コレスキー分解\n");
+	Matrix<6,6> A;
+	Rnd.GetRandomMatrix(A);
+	const Matrix<6,6> S = tp(A)*A + Matrix<6,6>::eye();	// 対称正定値行列
+	Matrix<3,6> B;
+	Rnd.GetRandomMatrix(B);
+	const CholeskyDecomposition<6> Chol(S);	// 分解は1回だけ
+	const LDLDecomposition<6> LDL(S);
+	const Matrix<3,6> Xc = Chol.solve(B);	// 3本の右辺をまとめて解く
+	const Matrix<3,6> Xl = LDL.solve(B);
+	printf("LL^T  : 正定値 = %d, 残差 |S*X - B| = %e, det = %f\n", Chol.IsPositiveDefinite(), MaxAbs(Matrix<3,6>(S*Xc - B)), Chol.det());
+	printf("LDL^T : 特異 = %d, 残差 |S*X - B| = %e, det = %f\n", LDL.IsSingular(), MaxAbs(Matrix<3,6>(S*Xl - B)), LDL.det());
+	const CholeskyDecomposition<6> Chol2(A + tp(A));	// 正定値とは限らない対称行列
+	printf("A + A^T は正定値か？ = %d\n\n", Chol2.IsPositiveDefinite());
+	
+	// LU分解と逆行列を使う方法の比較
+	printf("LU分解と逆行列の比較\n");
+	Matrix<1,6> b, x;
+	Rnd.GetRandomMatrix(b);
+	const LUDecomposition<6> LUD(A);
+	printf("LU分解 : 特異 = %d, 残差 |A*x - b| = %e, det = %f (det(A) = %f)\n", LUD.IsSingular(), MaxAbs(Matrix<1,6>(A*LUD.solve(b) - b)), LUD.det(), det(A));
+	const double TimeInv = MeasureTime([&]{ x = inv(A)*b; });
+	const double TimeLU = MeasureTime([&]{ x = LUDecomposition<6>(A).solve(b); });
+	const double TimeSolve = MeasureTime([&]{ x = LUD.solve(b); });
+	printf("inv(A)*b : %6.3f [us], 分解＋求解 : %6.3f [us], 分解済みの求解 : %6.3f [us]\n", TimeInv, TimeLU, TimeSolve);
+	
+	// 複素数の行列のLU分解
+	Matrix<6,6> Ai;
+	Rnd.GetRandomMatrix(Ai);
+	Matrix<6,6,std::complex<double>> Az;
+	Matrix<1,6,std::complex<double>> bz;
+	for(size_t n = 1; n <= 6; ++n){
+		for(size_t m = 1; m <= 6; ++m) Az.SetElement(n, m, std::complex<double>(A.GetElement(n,m), Ai.GetElement(n,m)));
+		bz.SetElement(1, n, b.GetElement(1,n));
+	}
+	const LUDecomposition<6,std::complex<double>> LUDz(Az);
+	printf("複素数 : 特異 = %d, 残差 |A*x - b| = %e\n\n", LUDz.IsSingular(), MaxAbs(Matrix<1,6,std::complex<double>>(Az*LUDz.solve(bz) - bz)));
+	
+	// 条件数の悪い縦長行列の最小二乗解
+	// 正規方程式 inv(A^T*A)*A^T*y は条件数が2乗になるので精度が落ちる
+	printf("最小二乗解と最小ノルム解\n");
+	constexpr size_t K = 20;
+	constexpr double d = 1e-6;
+	Matrix<3,K> Phi;
+	Matrix<1,3> th = {1, 2, 3}, th_lsq, th_ne;
+	for(size_t k = 1; k <= K; ++k){
+		const double t = (double)k/K;
+		Phi.SetElement(1, k, 1);
+		Phi.SetElement(2, k, t);
+		Phi.SetElement(3, k, t + d*t*t);	// 2列目とほとんど同じ列
+	}
+	const Matrix<1,K> y = Phi*th;
+	th_lsq = solve_lsq(Phi, y);
+	th_ne = inv(tp(Phi)*Phi)*tp(Phi)*y;
+	printf("QR分解     : 誤差 |th - th_lsq| = %e\n", MaxAbs(Matrix<1,3>(th_lsq - th)));
+	printf("正規方程式 : 誤差 |th - th_ne|  = %e\n", MaxAbs(Matrix<1,3>(th_ne - th)));
+	printf("左擬似逆行列(QR分解版) : 誤差 |th - lpinv(Phi)*y| = %e\n", MaxAbs(Matrix<1,3>(lpinv(Phi)*y - th)));
+	Matrix<6,3> Psi;	// 横長行列
+	Rnd.GetRandomMatrix(Psi);
+	const Matrix<1,3> z = {1, -1, 2};
+	const Matrix<1,6> xmn = solve_lsq(Psi, z);
+	printf("最小ノルム解 : 残差 |Psi*x - z| = %e, |x - rpinv(Psi)*z| = %e\n\n", MaxAbs(Matrix<1,3>(Psi*xmn - z)), MaxAbs(Matrix<1,6>(xmn - rpinv(Psi)*z)));
+	
+	// 逐次最小二乗法 (10パラメータ) の共分散行列の更新
+	// 毎サンプル inv で計算し直す O(n^3) の方法と，シャーマン・モリソンの公式で更新する O(n^2) の方法の比較
+	printf("逐次最小二乗法の共分散行列の更新\n");
+	constexpr size_t NP = 10;
+	Matrix<1,NP> th_true, th_sm, th_inv, phi;
+	Rnd.GetRandomMatrix(th_true);
+	Matrix<NP,NP> R = 1e-3*Matrix<NP,NP>::eye(), P_sm = 1e3*Matrix<NP,NP>::eye(), P_inv;	// R = P^(-1)
+	const Matrix<NP,NP> R0 = R, P0 = P_sm;
+	constexpr size_t NS = 1000;
+	std::array<Matrix<1,NP>, NS> Phis;
+	std::array<double, NS> ys;
+	for(size_t k = 0; k < NS; ++k){
+		Rnd.GetRandomMatrix(Phis[k]);
+		ys[k] = (tp(Phis[k])*th_true)[1];
+	}
+	const double TimeRLSinv = MeasureTime([&]{
+		R = R0;
+		th_inv = Matrix<1,NP>::zeros();
+		for(size_t k = 0; k < NS; ++k){
+			R = R + Phis[k]*tp(Phis[k]);	// 情報行列を更新して
+			P_inv = inv(R);					// 逆行列を計算し直す
+			th_inv = th_inv + P_inv*Phis[k]*(ys[k] - (tp(Phis[k])*th_inv)[1]);
+		}
+	}, 10)/NS;
+	const double TimeRLSsm = MeasureTime([&]{
+		P_sm = P0;
+		th_sm = Matrix<1,NP>::zeros();
+		for(size_t k = 0; k < NS; ++k){
+			shermanmorrison(P_sm, Phis[k], Phis[k]);	// P ← (P^(-1) + φ*φ^T)^(-1)
+			th_sm = th_sm + P_sm*Phis[k]*(ys[k] - (tp(Phis[k])*th_sm)[1]);
+		}
+	}, 10)/NS;
+	printf("inv で再計算     : %6.3f [us/サンプル], 推定誤差 = %e\n", TimeRLSinv, MaxAbs(Matrix<1,NP>(th_inv - th_true)));
+	printf("シャーマン・モリソン : %6.3f [us/サンプル], 推定誤差 = %e\n", TimeRLSsm, MaxAbs(Matrix<1,NP>(th_sm - th_true)));
+	printf("|P_inv - P_sm| = %e\n", MaxAbs(Matrix<NP,NP>(P_inv - P_sm)));
+	Matrix<NP,NP> L;
+	Cholesky(R, L);		// 情報行列のコレスキー因子も同様に O(n^2) で更新できる
+	Rnd.GetRandomMatrix(phi);
+	cholupdate(L, phi);
+	printf("cholupdate   : |L*L^T - (R + φ*φ^T)| = %e\n", MaxAbs(Matrix<NP,NP>(L*tp(L) - R - phi*tp(phi))));
+	choldowndate(L, phi);
+	printf("choldowndate : |L*L^T - R| = %e\n\n", MaxAbs(Matrix<NP,NP>(L*tp(L) - R)));
+	
+	// 定数式として評価する例
+	printf("コンパイル時の求解\n");
+	constexpr Matrix<3,3> Ac = {
+		4, 1, 2,
+		1, 5, 3,
+		2, 3, 6
+	};
+	constexpr Matrix<1,3> bc = {1, 2, 3};
+	constexpr Matrix<1,3> xc = CholeskyDecomposition<3>(Ac).solve(bc);
+	static_assert(LUDecomposition<3>(Ac).IsSingular() == false);
+	PrintMat(xc);
+	
+	return EXIT_SUCCESS;	// 正常終了
+}
+
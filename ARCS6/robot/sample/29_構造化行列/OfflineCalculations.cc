@@ -0,0 +1,138 @@
+//! @file OfflineCalculations.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+
+// 基本のインクルードファイル
+#include <stdio.h>
+#include <cstdlib>
+#include <cassert>
+#include <array>
+#include <complex>
+#include <chrono>
+#include <algorithm>
+
+// 追加のARCSライブラリをここに記述
+#include "Matrix.hh"
+#include "MatrixDecomposition.hh"
+#include "MatrixStructured.hh"
+#include "StateSpaceSystem.hh"
+#include "TransferFunction.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+
+//! @brief 行列の要素の絶対値の最大値を返す関数
+//! @param[in]	U	入力行列
+//! @return	最大値
+template <size_t N, size_t M>
+double MaxAbs(const Matrix<N,M>& U){
+	double y = 0;
+	for(size_t n = 1; n <= N; ++n){
+		for(size_t m = 1; m <= M; ++m) y = std::max(y, std::abs(U.GetElement(n,m)));
+	}
+	return y;
+}
+
+//! @brief 処理の平均消費時間を返す関数
+//! @param[in]	func	計測する処理
+//! @param[in]	LOOP	繰り返し回数
+//! @return	1回あたりの消費時間 [us]
+template <typename F>
+double MeasureTime(F func, const size_t LOOP = 10000){
+	const auto start_time = std::chrono::steady_clock::now();
+	for(size_t i = 0; i < LOOP; ++i) func();
+	const auto end_time = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::micro>(end_time - start_time).count()/LOOP;
+}
+
+//! @brief エントリポイント
+//! @return 終了ステータス
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+	
+	// ここにオフライン計算のコードを記述
+	RandomGenerator Rnd(-1, 1);
+	
+	// 三重対角行列(帯行列)の連立方程式
+	printf("三重対角行列の連立方程式\n");
+	constexpr size_t N = 32;
+	Matrix<N,N> A;
+	for(size_t i = 1; i <= N; ++i){
+		A.SetElement(i, i, 4);
+		if(1 < i) A.SetElement(i - 1, i, -1);
+		if(i < N) A.SetElement(i + 1, i, -1);
+	}
+	size_t KL, KU;
+	GetBandwidth(A, KL, KU);
+	printf("構造 = %d, 下側帯幅 = %zu, 上側帯幅 = %zu\n", (int)DetectStructure(A), KL, KU);
+	Matrix<1,N> b, x;
+	Rnd.GetRandomMatrix(b);
+	const BandedMatrix<N,1,1> Ab(A);
+	printf("帯行列 : 残差 |A*x - b| = %e\n", MaxAbs(Matrix<1,N>(A*solve(Ab, b) - b)));
+	double sum = 0;	// 最適化で計算が消えないように解を足し合わせておく
+	const double TimeLU = MeasureTime([&]{ x = LUDecomposition<N>(A).solve(b); sum += x[1]; });
+	const double TimeBand = MeasureTime([&]{ x = solve(Ab, b); sum += x[1]; });
+	printf("LU分解(密行列) : %6.3f [us], 帯行列 : %6.3f [us] (%f)\n\n", TimeLU, TimeBand, sum);
+	
+	// 三角行列，対称行列，対角行列
+	printf("三角行列，対称行列，対角行列\n");
+	Matrix<6,6> M;
+	Rnd.GetRandomMatrix(M);
+	const UpperTriMatrix<6> U(M);
+	const SymmetricMatrix<6> S(M + tp(M) + 12*Matrix<6,6>::eye());
+	const DiagonalMatrix<6> D(M);
+	Matrix<1,6> y;
+	Rnd.GetRandomMatrix(y);
+	printf("上三角行列 : 残差 |U*x - y| = %e, det = %f\n", MaxAbs(Matrix<1,6>(U*solve(U, y) - y)), det(U));
+	printf("対称行列   : 残差 |S*x - y| = %e, det = %f\n", MaxAbs(Matrix<1,6>(S*solve(S, y) - y)), det(S));
+	printf("対角行列   : 残差 |D*x - y| = %e, det = %f\n\n", MaxAbs(Matrix<1,6>(D*solve(D, y) - y)), det(D));
+	
+	// コンパニオン行列
+	printf("コンパニオン行列\n");
+	constexpr Matrix<1,4> Den = {1, 2, 3, 4};	// s^3 + 2s^2 + 3s + 4
+	constexpr auto Cp = CompanionMatrix<3>::FromPolynomial(Den);
+	PrintMat(Cp.ToMatrix());
+	printf("det = %f\n\n", det(Cp));
+	
+	// 8次の伝達関数(バタワース型低域通過フィルタ)の消費時間
+	// 状態空間モデルのA行列がコンパニオン行列のときは，毎サンプルの計算量が O(D^2) から O(D) になる
+	printf("8次の伝達関数の消費時間\n");
+	constexpr double w = 2.0*M_PI*100.0;
+	const Matrix<1,9> DenLPF = {
+		1, 5.1258*w, 13.1371*pow(w,2), 21.8462*pow(w,3), 25.6884*pow(w,4), 21.8462*pow(w,5), 13.1371*pow(w,6), 5.1258*pow(w,7), pow(w,8)
+	};
+	const Matrix<1,1> NumLPF = {pow(w,8)};
+	TransferFunction<0,8> LPF(NumLPF, DenLPF, 100e-6);
+	double yLPF = 0;
+	const double TimeTF = MeasureTime([&]{ yLPF = LPF.GetResponse(1.0); }, 1000000);
+	printf("伝達関数 : %6.3f [us/サンプル], ステップ応答の最終値 = %f\n", TimeTF, yLPF);
+	
+	// 同じ次数の密なA行列の状態空間モデルとの比較
+	Matrix<8,8> Ad;
+	Rnd.GetRandomMatrix(Ad);
+	Matrix<1,8> Bd;
+	Rnd.GetRandomMatrix(Bd);
+	Matrix<8,1> Cd;
+	Rnd.GetRandomMatrix(Cd);
+	StateSpaceSystem<8> SysDense;
+	SysDense.SetDiscrete(0.1*Ad, Bd, Cd);
+	printf("構造 = %d\n", (int)SysDense.GetStructure());
+	double yDense = 0;
+	const double TimeDense = MeasureTime([&]{ yDense = SysDense.GetResponse(1.0); }, 1000000);
+	printf("密行列の状態空間モデル : %6.3f [us/サンプル], 応答 = %f\n", TimeDense, yDense);
+	
+	return EXIT_SUCCESS;	// 正常終了
+}
+
@@ -0,0 +1,140 @@
+//! @file OfflineCalculations.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+
+// 基本のインクルードファイル
+#include <stdio.h>
+#include <cstdlib>
+#include <cassert>
+#include <array>
+#include <complex>
+#include <chrono>
+#include <algorithm>
+
+// 追加のARCSライブラリをここに記述
+#include "Matrix.hh"
+#include "MatrixDecomposition.hh"
+#include "DualNumber.hh"
+
+using namespace ARCS;
+
+//! @brief 2リンクアームの状態方程式 dx/dt = f(x) (クーロン摩擦をtanhで近似)
+//! 実数(double)でも二重数(DualNumber)でも同じコードで計算できるようにテンプレートにしておく
+//! @param[in]	x	状態ベクトル [関節角度1, 関節角度2, 関節速度1, 関節速度2]
+//! @return	状態の時間微分
+template <typename TT>
+Matrix<1,4,TT> ArmModel(const Matrix<1,4,TT>& x){
+	using std::sin;	// 二重数のときは DualNumber.hh の sin, cos, tanh が呼ばれる
+	using std::cos;
+	using std::tanh;
+	constexpr double m1 = 1.0, m2 = 0.8;		// リンク質量 [kg]
+	constexpr double l1 = 0.4;					// リンク1の長さ [m]
+	constexpr double lg1 = 0.2, lg2 = 0.15;		// 重心までの長さ [m]
+	constexpr double J1 = 0.02, J2 = 0.01;		// 重心周りの慣性 [kgm^2]
+	constexpr double g = 9.80665;				// 重力加速度 [m/s^2]
+	constexpr double Fc = 0.3, Dv = 0.1;		// クーロン摩擦 [Nm] と粘性摩擦 [Nm/(rad/s)]
+	constexpr double tau1 = 1.0, tau2 = 0.5;	// 関節トルク [Nm]
+	const TT q1 = x[1], q2 = x[2], w1 = x[3], w2 = x[4];
+	
+	// 慣性行列
+	const TT c2 = cos(q2);
+	Matrix<2,2,TT> M;
+	M.SetElement(1, 1, J1 + J2 + m1*lg1*lg1 + m2*(l1*l1 + lg2*lg2 + 2*l1*lg2*c2));
+	M.SetElement(2, 1, J2 + m2*(lg2*lg2 + l1*lg2*c2));
+	M.SetElement(1, 2, J2 + m2*(lg2*lg2 + l1*lg2*c2));
+	M.SetElement(2, 2, J2 + m2*lg2*lg2);
+	
+	// 遠心力・コリオリ力，重力，摩擦を差し引いたトルク
+	const TT h = m2*l1*lg2*sin(q2);
+	Matrix<1,2,TT> tau;
+	tau[1] = tau1 + h*(2*w1*w2 + w2*w2) - (m1*lg1 + m2*l1)*g*cos(q1) - m2*lg2*g*cos(q1 + q2) - Fc*tanh(w1/0.01) - Dv*w1;
+	tau[2] = tau2 - h*w1*w1 - m2*lg2*g*cos(q1 + q2) - Fc*tanh(w2/0.01) - Dv*w2;
+	
+	// 角加速度 M*dw = tau をLU分解で解く
+	const Matrix<1,2,TT> dw = LUDecomposition<2,TT>(M).solve(tau);
+	Matrix<1,4,TT> f;
+	f[1] = w1;
+	f[2] = w2;
+	f[3] = dw[1];
+	f[4] = dw[2];
+	return f;
+}
+
+//! @brief 前進差分によるヤコビ行列の近似 (状態方程式を N+1 回評価する)
+//! @param[in]	x	状態ベクトル
+//! @param[in]	h	刻み幅
+//! @param[out]	J	ヤコビ行列
+void FiniteDifference(const Matrix<1,4>& x, const double h, Matrix<4,4>& J){
+	const Matrix<1,4> f0 = ArmModel(x);
+	for(size_t k = 1; k <= 4; ++k){
+		Matrix<1,4> xh = x;
+		xh[k] += h;
+		const Matrix<1,4> fh = ArmModel(xh);
+		for(size_t m = 1; m <= 4; ++m) J.SetElement(k, m, (fh[m] - f0[m])/h);
+	}
+}
+
+//! @brief 処理の平均消費時間を返す関数
+//! @param[in]	func	計測する処理
+//! @param[in]	LOOP	繰り返し回数
+//! @return	1回あたりの消費時間 [us]
+template <typename F>
+double MeasureTime(F func, const size_t LOOP = 100000){
+	const auto start_time = std::chrono::steady_clock::now();
+	for(size_t i = 0; i < LOOP; ++i) func();
+	const auto end_time = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::micro>(end_time - start_time).count()/LOOP;
+}
+
+//! @brief エントリポイント
+//! @return 終了ステータス
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+	
+	// ここにオフライン計算のコードを記述
+	// 二重数の四則演算
+	printf("二重数の四則演算\n");
+	const DualNumber<2> a(3.0, 1), b(2.0, 2);	// a を1番目，b を2番目の独立変数とする
+	const DualNumber<2> c = a*b + a/b;			// c = a*b + a/b
+	printf("c = %f, dc/da = %f, dc/db = %f\n\n", c.Val, c.Grad[0], c.Grad[1]);
+	
+	// 2リンクアームの線形化 (EKFやMPCで使うヤコビ行列)
+	printf("2リンクアームのヤコビ行列\n");
+	const Matrix<1,4> x = {0.3, -0.5, 0.02, -0.3};
+	Matrix<1,4> f;
+	Matrix<4,4> J, Jfd;
+	AutoDiff::Jacobian([](const auto& v){ return ArmModel(v); }, x, f, J);	// 1回の評価で値とヤコビ行列を得る
+	PrintMat(f);
+	PrintMat(J);
+	
+	// 差分近似との比較 (刻み幅によって誤差が変わる)
+	for(const double h : {1e-3, 1e-6, 1e-9}){
+		FiniteDifference(x, h, Jfd);
+		double err = 0;
+		for(size_t n = 1; n <= 4; ++n){
+			for(size_t m = 1; m <= 4; ++m) err = std::max(err, std::abs(J.GetElement(n, m) - Jfd.GetElement(n, m)));
+		}
+		printf("差分近似 h = %5.0e : 自動微分との差の最大値 = %e\n", h, err);
+	}
+	
+	// 消費時間の比較
+	double sum = 0;	// 最適化で計算が消えないように結果を足し合わせておく
+	const double TimeAD = MeasureTime([&]{ AutoDiff::Jacobian([](const auto& v){ return ArmModel(v); }, x, f, J); sum += J.GetElement(1,3); });
+	const double TimeFD = MeasureTime([&]{ FiniteDifference(x, 1e-6, Jfd); sum += Jfd.GetElement(1,3); });
+	printf("自動微分 : %6.3f [us], 差分近似 : %6.3f [us] (%f)\n", TimeAD, TimeFD, sum);
+	
+	return EXIT_SUCCESS;	// 正常終了
+}
+
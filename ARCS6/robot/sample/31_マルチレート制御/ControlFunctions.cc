@@ -0,0 +1,189 @@
+//! @file ControlFunctions.cc
+//! @brief 制御用周期実行関数群クラス
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+
+// 基本のインクルードファイル
+#include <unistd.h>
+#include <cmath>
+#include <cfloat>
+#include <tuple>
+#include <algorithm>
+#include "ControlFunctions.hh"
+#include "ARCSprint.hh"
+#include "ARCSassert.hh"
+#include "ScreenParams.hh"
+#include "InterfaceFunctions.hh"
+#include "GraphPlot.hh"
+#include "DataMemory.hh"
+
+// 追加のARCSライブラリをここに記述
+#include "Matrix.hh"
+#include "MotorSimulator.hh"
+#include "DisturbanceObsrv.hh"
+#include "StepWave.hh"
+#include "MultiRateScheduler.hh"
+
+using namespace ARCS;
+
+//! @brief スレッド間通信用グローバル変数の無名名前空間
+namespace {
+	// スレッド間で共有したい変数をここに記述
+	std::array<double, ConstParams::ACTUATOR_NUM> PositionRes = {0};	//!< [rad] 位置応答
+	std::array<double, ConstParams::ACTUATOR_NUM> CurrentRef = {0};		//!< [Nm]  電流指令
+}
+
+//! @brief 制御用周期実行関数1
+//! @param[in]	t		時刻 [s]
+//! @param[in]	Tact	計測周期 [s]
+//! @param[in]	Tcmp	消費時間 [s]
+//! @return		クロックオーバーライドフラグ (true = リアルタイムループ, false = 非リアルタイムループ)
+bool ControlFunctions::ControlFunction1(double t, double Tact, double Tcmp){
+	// 制御用定数設定
+	[[maybe_unused]] const double Ts = ConstParams::SAMPLING_TIME[0]*1e-9;	// [s]	制御周期 (基本周期)
+	const double Kt = 0.49;		// [Nm/A] トルク定数
+	const double Jm = 1.10e-4;	// [kgm^2] モータ側慣性
+	const double Dm = 3.76e-3;	// [Nm s/rad] モータ側粘性
+	const double gdis = 300;	// [rad/s] 外乱オブザーバの帯域
+	const double Kpv = 300;		// [-] 速度制御Pゲイン
+	const double amax = 2000;	// [rad/s^2] 速度指令の加速度制限
+	
+	// レートグループの分周比 (基本周期 100 [us] に対する整数倍)
+	const unsigned long DIV_CUR = 1;	// 電流制御ループ 10 [kHz]
+	const unsigned long DIV_VEL = 10;	// 速度制御ループ  1 [kHz]
+	const unsigned long DIV_PLN = 100;	// 軌道計画       100 [Hz]
+	
+	// 制御用変数宣言
+	static double wmtgt = 0, wmref = 0, amref = 0;	// 速度目標値，速度指令，加速度指令
+	static double iqref = 0, iq = 0, wm = 0, thm = 0;// 電流指令，電流，速度，位置
+	static double tdis = 0, tdish = 0;				// 外乱と推定外乱
+	static MotorSimulator Plant(Kt, Jm, Dm, Ts);									// モータシミュレータ (電流制御ループの周期で計算)
+	static DisturbanceObsrv<DObType::FULL_0TH> DOB(Kt, Jm, gdis, Ts*DIV_VEL);		// 同一次元0次外乱オブザーバ (速度制御ループの周期で計算)
+	static MultiRateScheduler<3> Scheduler(ConstParams::SAMPLING_TIME[0]);		// マルチレートスケジューラ
+	
+	if(CmdFlag == CTRL_INIT){
+		// 初期化モード (ここは制御開始時/再開時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
+		Initializing = true;		// 初期化中ランプ点灯
+		Screen.InitOnlineSetVar();	// オンライン設定変数の初期値の設定
+		Interface.ServoON();		// サーボON指令の送出
+		
+		// レートグループの設定 (同じフレームでは番号の小さい順，つまり速いループから順に実行される)
+		// グループ0：電流制御ループ (ここでは電流は指令通りに流れるとしてモータシミュレータを計算する)
+		Scheduler.SetRateGroup(0, DIV_CUR, [=](double t0, double, double){
+			iq = iqref;
+			tdis = 5.0*StepWave(0.5, t0);
+			Plant.SetCurrentAndLoadTorque(iq, tdis);
+			std::tie(wm, thm) = Plant.GetVelocityAndPosition();
+			return true;
+		});
+		// グループ1：速度P＋外乱オブザーバ加速度制御ループ
+		Scheduler.SetRateGroup(1, DIV_VEL, [=](double, double, double){
+			tdish = DOB.GetDistTorque(iq, wm);
+			amref = (wmref - wm)*Kpv;
+			iqref = amref*Jm/Kt + tdish/Kt;
+			return true;
+		});
+		// グループ2：軌道計画 (速度目標値に向かって加速度制限付きで速度指令を動かす)
+		Scheduler.SetRateGroup(2, DIV_PLN, [=](double t2, double T2, double){
+			wmtgt = 100.0*StepWave(0.1, t2);
+			wmref += std::clamp(wmtgt - wmref, -amax*T2, amax*T2);
+			return true;
+		});
+		Scheduler.SpreadOffsets();	// 遅いグループを速いグループと重ならないフレームにずらす
+		Scheduler.Reset();			// 再開時は時刻が 0 に戻るのでフレーム番号も 0 に戻す
+		Initializing = false;		// 初期化中ランプ消灯
+	}
+	if(CmdFlag == CTRL_LOOP){
+		// 周期モード (ここは制御周期 SAMPLING_TIME[0] 毎に呼び出される(リアルタイム空間なので処理は制御周期内に収めること))
+		// リアルタイム制御ここから
+		Interface.GetPosition(PositionRes);	// [rad] 位置応答の取得
+		Screen.GetOnlineSetVar();			// オンライン設定変数の読み込み
+		
+		// 今のフレームで実行すべきレートグループをすべて実行する
+		Scheduler.Execute(t, Tact, Tcmp);
+		
+		Interface.SetCurrent(CurrentRef);	// [A] 電流指令の出力
+		Screen.SetVarIndicator(wmref, wm, tdis, tdish, Scheduler.GetMaxCompTime(0)*1e6, Scheduler.GetMaxCompTime(1)*1e6, Scheduler.GetMaxCompTime(2)*1e6, 0, 0, 0);	// 任意変数インジケータ(変数0, ..., 変数9)
+		Graph.SetTime(Tact, t);												// [s] グラフ描画用の周期と時刻のセット
+		Graph.SetVars(0, wmtgt, wmref, wm, 0, 0, 0, 0, 0);	// グラフプロット0 (グラフ番号, 変数0, ..., 変数7)
+		Graph.SetVars(1, tdis, tdish, 0, 0, 0, 0, 0, 0);	// グラフプロット1 (グラフ番号, 変数0, ..., 変数7)
+		Graph.SetVars(2, iqref, iq, 0, 0, 0, 0, 0, 0);		// グラフプロット2 (グラフ番号, 変数0, ..., 変数7)
+		Graph.SetVars(3, 0, 0, 0, 0, 0, 0, 0, 0);			// グラフプロット3 (グラフ番号, 変数0, ..., 変数7)
+		Memory.SetData(Tact, t, wmtgt, wmref, wm, tdis, tdish, iqref, iq, 0, 0);	// CSVデータ保存変数 (周期, A列, B列, ..., J列)
+		// リアルタイム制御ここまで
+	}
+	if(CmdFlag == CTRL_EXIT){
+		// 終了処理モード (ここは制御終了時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
+		Interface.SetZeroCurrent();	// 電流指令を零に設定
+		Interface.ServoOFF();		// サーボOFF信号の送出
+	}
+	return true;	// クロックオーバーライドフラグ(falseにすると次の周期時刻を待たずにスレッドが即刻動作する)
+}
+
+//! @brief 制御用周期実行関数2
+//! @param[in]	t		時刻 [s]
+//! @param[in]	Tact	計測周期 [s]
+//! @param[in]	Tcmp	消費時間 [s]
+//! @return		クロックオーバーライドフラグ (true = リアルタイムループ, false = 非リアルタイムループ)
+bool ControlFunctions::ControlFunction2(double t, double Tact, double Tcmp){
+	// 制御用定数宣言
+	[[maybe_unused]] const double Ts = ConstParams::SAMPLING_TIME[1]*1e-9;	// [s]	制御周期
+	
+	// 制御用変数宣言
+	
+	// 制御器等々の宣言
+	
+	if(CmdFlag == CTRL_INIT){
+		// 初期化モード (ここは制御開始時/再開時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
+	}
+	if(CmdFlag == CTRL_LOOP){
+		// 周期モード (ここは制御周期 SAMPLING_TIME[1] 毎に呼び出される(リアルタイム空間なので処理は制御周期内に収めること))
+		// リアルタイム制御ここから
+		
+		// リアルタイム制御ここまで
+	}
+	if(CmdFlag == CTRL_EXIT){
+		// 終了処理モード (ここは制御終了時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
+	}
+	return true;	// クロックオーバーライドフラグ(falseにすると次の周期時刻を待たずにスレッドが即刻動作する)
+}
+
+//! @brief 制御用周期実行関数3
+//! @param[in]	t		時刻 [s]
+//! @param[in]	Tact	計測周期 [s]
+//! @param[in]	Tcmp	消費時間 [s]
+//! @return		クロックオーバーライドフラグ (true = リアルタイムループ, false = 非リアルタイムループ)
+bool ControlFunctions::ControlFunction3(double t, double Tact, double Tcmp){
+	// 制御用定数宣言
+	[[maybe_unused]] const double Ts = ConstParams::SAMPLING_TIME[2]*1e-9;	// [s]	制御周期
+	
+	// 制御用変数宣言
+	
+	if(CmdFlag == CTRL_INIT){
+		// 初期化モード (ここは制御開始時/再開時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
+	}
+	if(CmdFlag == CTRL_LOOP){
+		// 周期モード (ここは制御周期 SAMPLING_TIME[2] 毎に呼び出される(リアルタイム空間なので処理は制御周期内に収めること))
+		// リアルタイム制御ここから
+		
+		// リアルタイム制御ここまで
+	}
+	if(CmdFlag == CTRL_EXIT){
+		// 終了処理モード (ここは制御終了時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
+	}
+	return true;	// クロックオーバーライドフラグ(falseにすると次の周期時刻を待たずにスレッドが即刻動作する)
+}
+
+//! @brief 制御用変数値を更新する関数
+void ControlFunctions::UpdateControlValue(void){
+	// ARCS画面パラメータに値を書き込む
+	Screen.SetNetworkLink(NetworkLink);						// ネットワークリンクフラグを書き込む
+	Screen.SetInitializing(Initializing);					// ロボット初期化フラグを書き込む
+	Screen.SetCurrentAndPosition(CurrentRef, PositionRes);	// 電流指令と位置応答を書き込む
+}
+
@@ -0,0 +1,82 @@
+//! @file OfflineCalculations.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+
+// 基本のインクルードファイル
+#include <stdio.h>
+#include <cstdlib>
+#include <cassert>
+#include <array>
+#include <complex>
+#include <time.h>
+#include <unistd.h>
+
+// 追加のARCSライブラリをここに記述
+#include "Matrix.hh"
+#include "CsvManipulator.hh"
+#include "SFthread.hh"
+#include "MultiRateScheduler.hh"
+
+using namespace ARCS;
+
+//! @brief 指定した時間だけ空回しする関数 (制御器の計算の代わり)
+//! @param[in]	Time	[s] 空回しする時間
+void BusyWait(const double Time){
+	timespec Start, Now;
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	do{
+		clock_gettime(CLOCK_MONOTONIC, &Now);
+	}while((Now.tv_sec - Start.tv_sec) + (Now.tv_nsec - Start.tv_nsec)*1e-9 < Time);
+}
+
+//! @brief マルチレートスケジューラを SFthread で動かして消費時間を測定する関数
+//! @param[in]	Spread	位相オフセットを分散させるかどうか
+void MeasureMultiRate(const bool Spread){
+	constexpr unsigned long Ts = 1000000;	// [ns] 基本周期
+	constexpr int CPU = 0;					// 使用するCPUコアの番号
+	
+	// 速いループ 1 [ms]，中くらいのループ 5 [ms]，遅いループ 10 [ms] の3つのレートグループ (消費時間はそれぞれ 200 [us])
+	MultiRateScheduler<3> Scheduler(Ts);
+	Scheduler.SetRateGroup(0,  1, [](double t, double Tp, double Tc){ BusyWait(200e-6); return true; });
+	Scheduler.SetRateGroup(1,  5, [](double t, double Tp, double Tc){ BusyWait(200e-6); return true; });
+	Scheduler.SetRateGroup(2, 10, [](double t, double Tp, double Tc){ BusyWait(200e-6); return true; });
+	if(Spread == true) Scheduler.SpreadOffsets();
+	
+	SFthread<SFalgorithm::INSERT_ZEROSLEEP> Thread(Ts, [&](double t, double Tp, double Tc){ return Scheduler.Execute(t, Tp, Tc); }, CPU);
+	Thread.Start();
+	Thread.WaitStart();
+	usleep(2e6);
+	Thread.Stop();
+	Thread.WaitStop();
+	
+	printf("%-10s", Spread ? "分散あり" : "分散なし");
+	for(size_t i = 0; i < 3; ++i) printf("    %2lu", Scheduler.GetOffset(i));
+	printf("  %10.1f %10.1f\n", Thread.GetCompTimeHist().GetMax()*1e-3, Thread.GetCompTimeHist().GetPercentile(99)*1e-3);
+}
+
+//! @brief エントリポイント
+//! @return 終了ステータス
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+	
+	// ここにオフライン計算のコードを記述
+	// 位相オフセットの分散によるフレームあたりの消費時間の違いの比較 (root権限で実行すること)
+	printf("\n位相オフセット  G0    G1    G2  最大消費時間[us] 99%%[us]\n");
+	MeasureMultiRate(false);
+	MeasureMultiRate(true);
+	
+	return EXIT_SUCCESS;	// 正常終了
+}
+
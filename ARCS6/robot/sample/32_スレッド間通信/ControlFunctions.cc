@@ -0,0 +1,195 @@
+//! @file ControlFunctions.cc
+//! @brief 制御用周期実行関数群クラス
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the BSD License.
+// For details, see the License.txt file.
+
+// 基本のインクルードファイル
+#include <unistd.h>
+#include <cmath>
+#include <cfloat>
+#include <tuple>
+#include <algorithm>
+#include "ControlFunctions.hh"
+#include "ARCSprint.hh"
+#include "ARCSassert.hh"
+#include "ScreenParams.hh"
+#include "InterfaceFunctions.hh"
+#include "GraphPlot.hh"
+#include "DataMemory.hh"
+
+// 追加のARCSライブラリをここに記述
+#include "Matrix.hh"
+#include "MotorSimulator.hh"
+#include "DisturbanceObsrv.hh"
+#include "StepWave.hh"
+#include "Mailbox.hh"
+#include "SPSCQueue.hh"
+
+using namespace ARCS;
+
+//! @brief スレッド間通信用グローバル変数の無名名前空間
+namespace {
+	// スレッド間で共有したい変数をここに記述
+	Mailbox<std::array<double, ConstParams::ACTUATOR_NUM>> PositionResBox;	//!< [rad] 位置応答 (スレッド1 → 画面表示，最新値のみ)
+	Mailbox<std::array<double, ConstParams::ACTUATOR_NUM>> CurrentRefBox;	//!< [A]  電流指令 (スレッド1 → 画面表示，最新値のみ)
+	
+	//! @brief 速い制御スレッドから遅いスレッドへ送る状態
+	struct MotorState {
+		double t;		//!< [s] 時刻
+		double wmref;	//!< [rad/s] 速度指令
+		double wm;		//!< [rad/s] 速度応答
+	};
+	Mailbox<double> SpeedRefBox;				//!< 速度指令 (スレッド2 → スレッド1，最新値のみ)
+	Mailbox<double> SpeedErrBox;				//!< 速度誤差のRMS値 (スレッド2 → スレッド1，最新値のみ)
+	SPSCQueue<MotorState, 64> StateQueue;		//!< 状態の列 (スレッド1 → スレッド2，取りこぼし無し)
+}
+
+//! @brief 制御用周期実行関数1
+//! @param[in]	t		時刻 [s]
+//! @param[in]	Tact	計測周期 [s]
+//! @param[in]	Tcmp	消費時間 [s]
+//! @return		クロックオーバーライドフラグ (true = リアルタイムループ, false = 非リアルタイムループ)
+bool ControlFunctions::ControlFunction1(double t, double Tact, double Tcmp){
+	// 制御用定数設定
+	[[maybe_unused]] const double Ts = ConstParams::SAMPLING_TIME[0]*1e-9;	// [s]	制御周期
+	const double Kt = 0.49;		// [Nm/A] トルク定数
+	const double Jm = 1.10e-4;	// [kgm^2] モータ側慣性
+	const double Dm = 3.76e-3;	// [Nm s/rad] モータ側粘性
+	const double gdis = 300;	// [rad/s] 外乱オブザーバの帯域
+	const double Kpv = 300;		// [-] 速度制御Pゲイン
+	
+	// 制御用変数宣言
+	static std::array<double, ConstParams::ACTUATOR_NUM> PositionRes = {0};	// [rad] 位置応答
+	static std::array<double, ConstParams::ACTUATOR_NUM> CurrentRef = {0};	// [A]  電流指令
+	static double wmref = 0, amref = 0;		// 速度指令，加速度指令
+	static double wmerr = 0;				// 速度誤差のRMS値
+	static double iq = 0, wm = 0, thm = 0;	// 電流，速度，位置
+	static double tdis = 0, tdish = 0;		// 外乱と推定外乱
+	static MotorSimulator Plant(Kt, Jm, Dm, Ts);						// モータシミュレータ
+	static DisturbanceObsrv<DObType::FULL_0TH> DOB(Kt, Jm, gdis, Ts);	// 同一次元0次外乱オブザーバ
+	
+	if(CmdFlag == CTRL_INIT){
+		// 初期化モード (ここは制御開始時/再開時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
+		Initializing = true;		// 初期化中ランプ点灯
+		Screen.InitOnlineSetVar();	// オンライン設定変数の初期値の設定
+		Interface.ServoON();		// サーボON指令の送出
+		Initializing = false;		// 初期化中ランプ消灯
+	}
+	if(CmdFlag == CTRL_LOOP){
+		// 周期モード (ここは制御周期 SAMPLING_TIME[0] 毎に呼び出される(リアルタイム空間なので処理は制御周期内に収めること))
+		// リアルタイム制御ここから
+		Interface.GetPosition(PositionRes);	// [rad] 位置応答の取得
+		Screen.GetOnlineSetVar();			// オンライン設定変数の読み込み
+		
+		// 速度P＋外乱オブザーバ加速度制御＋モータシミュレータの例
+		// 速度指令はスレッド2の軌道計画から受け取り，状態はスレッド2へ毎周期送る
+		std::tie(wm, thm) = Plant.GetVelocityAndPosition();
+		tdish = DOB.GetDistTorque(iq, wm);
+		wmref = SpeedRefBox.Receive();
+		wmerr = SpeedErrBox.Receive();
+		StateQueue.Push({t, wmref, wm});
+		tdis = 5.0*StepWave(0.5, t);
+		amref = (wmref - wm)*Kpv;
+		iq = amref*Jm/Kt + tdish/Kt;
+		Plant.SetCurrentAndLoadTorque(iq, tdis);
+		
+		Interface.SetCurrent(CurrentRef);	// [A] 電流指令の出力
+		PositionResBox.Post(PositionRes);	// [rad] 位置応答を他のスレッドへ公開
+		CurrentRefBox.Post(CurrentRef);		// [A] 電流指令を他のスレッドへ公開
+		Screen.SetVarIndicator(wmref, wm, tdis, tdish, wmerr, StateQueue.GetDropCount(), 0, 0, 0, 0);	// 任意変数インジケータ(変数0, ..., 変数9)
+		Graph.SetTime(Tact, t);												// [s] グラフ描画用の周期と時刻のセット
+		Graph.SetVars(0, wmref, wm, 0, 0, 0, 0, 0, 0);	// グラフプロット0 (グラフ番号, 変数0, ..., 変数7)
+		Graph.SetVars(1, tdis, tdish, 0, 0, 0, 0, 0, 0);// グラフプロット1 (グラフ番号, 変数0, ..., 変数7)
+		Graph.SetVars(2, wmerr, 0, 0, 0, 0, 0, 0, 0);	// グラフプロット2 (グラフ番号, 変数0, ..., 変数7)
+		Graph.SetVars(3, 0, 0, 0, 0, 0, 0, 0, 0);		// グラフプロット3 (グラフ番号, 変数0, ..., 変数7)
+		Memory.SetData(Tact, t, wmref, wm, tdis, tdish, wmerr, 0, 0, 0, 0);		// CSVデータ保存変数 (周期, A列, B列, ..., J列)
+		// リアルタイム制御ここまで
+	}
+	if(CmdFlag == CTRL_EXIT){
+		// 終了処理モード (ここは制御終了時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
+		Interface.SetZeroCurrent();	// 電流指令を零に設定
+		Interface.ServoOFF();		// サーボOFF信号の送出
+	}
+	return true;	// クロックオーバーライドフラグ(falseにすると次の周期時刻を待たずにスレッドが即刻動作する)
+}
+
+//! @brief 制御用周期実行関数2
+//! @param[in]	t		時刻 [s]
+//! @param[in]	Tact	計測周期 [s]
+//! @param[in]	Tcmp	消費時間 [s]
+//! @return		クロックオーバーライドフラグ (true = リアルタイムループ, false = 非リアルタイムループ)
+bool ControlFunctions::ControlFunction2(double t, double Tact, double Tcmp){
+	// 制御用定数宣言
+	[[maybe_unused]] const double Ts = ConstParams::SAMPLING_TIME[1]*1e-9;	// [s]	制御周期
+	const double amax = 2000;	// [rad/s^2] 速度指令の加速度制限
+	const double Tavg = 0.05;	// [s] 速度誤差のRMS値の平均時間
+	
+	// 制御用変数宣言
+	static double wmtgt = 0, wmref = 0;	// 速度目標値，速度指令
+	static double err2 = 0;				// [rad^2/s^2] 速度誤差の2乗の移動平均
+	MotorState State;					// スレッド1から受け取った状態
+	
+	if(CmdFlag == CTRL_INIT){
+		// 初期化モード (ここは制御開始時/再開時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
+	}
+	if(CmdFlag == CTRL_LOOP){
+		// 周期モード (ここは制御周期 SAMPLING_TIME[1] 毎に呼び出される(リアルタイム空間なので処理は制御周期内に収めること))
+		// リアルタイム制御ここから
+		// 加速度制限付きの速度指令を生成してスレッド1へ送る
+		wmtgt = 100.0*StepWave(0.1, t);
+		wmref += std::clamp(wmtgt - wmref, -amax*Ts, amax*Ts);
+		SpeedRefBox.Post(wmref);
+		
+		// スレッド1から届いた状態をすべて取り出して，速度誤差の2乗を平均する
+		while(StateQueue.Pop(State) == true){
+			const double e = State.wmref - State.wm;
+			err2 += (e*e - err2)*ConstParams::SAMPLING_TIME[0]*1e-9/Tavg;
+		}
+		SpeedErrBox.Post(std::sqrt(err2));
+		// リアルタイム制御ここまで
+	}
+	if(CmdFlag == CTRL_EXIT){
+		// 終了処理モード (ここは制御終了時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
+	}
+	return true;	// クロックオーバーライドフラグ(falseにすると次の周期時刻を待たずにスレッドが即刻動作する)
+}
+
+//! @brief 制御用周期実行関数3
+//! @param[in]	t		時刻 [s]
+//! @param[in]	Tact	計測周期 [s]
+//! @param[in]	Tcmp	消費時間 [s]
+//! @return		クロックオーバーライドフラグ (true = リアルタイムループ, false = 非リアルタイムループ)
+bool ControlFunctions::ControlFunction3(double t, double Tact, double Tcmp){
+	// 制御用定数宣言
+	[[maybe_unused]] const double Ts = ConstParams::SAMPLING_TIME[2]*1e-9;	// [s]	制御周期
+	
+	// 制御用変数宣言
+	
+	if(CmdFlag == CTRL_INIT){
+		// 初期化モード (ここは制御開始時/再開時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
+	}
+	if(CmdFlag == CTRL_LOOP){
+		// 周期モード (ここは制御周期 SAMPLING_TIME[2] 毎に呼び出される(リアルタイム空間なので処理は制御周期内に収めること))
+		// リアルタイム制御ここから
+		
+		// リアルタイム制御ここまで
+	}
+	if(CmdFlag == CTRL_EXIT){
+		// 終了処理モード (ここは制御終了時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
+	}
+	return true;	// クロックオーバーライドフラグ(falseにすると次の周期時刻を待たずにスレッドが即刻動作する)
+}
+
+//! @brief 制御用変数値を更新する関数
+void ControlFunctions::UpdateControlValue(void){
+	// ARCS画面パラメータに値を書き込む
+	Screen.SetNetworkLink(NetworkLink);						// ネットワークリンクフラグを書き込む
+	Screen.SetInitializing(Initializing);					// ロボット初期化フラグを書き込む
+	Screen.SetCurrentAndPosition(CurrentRefBox.Receive(), PositionResBox.Receive());	// 電流指令と位置応答の最新値を書き込む
+}
+
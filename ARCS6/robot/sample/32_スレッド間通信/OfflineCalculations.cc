@@ -0,0 +1,105 @@
+//! @file OfflineCalculations.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/16
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// This program is free software;
+// you can redistribute it and/or modify it under the terms of the FreeBSD License.
+// For details, see the License.txt file.
+
+// 基本のインクルードファイル
+#include <stdio.h>
+#include <cstdlib>
+#include <cassert>
+#include <array>
+#include <complex>
+
+// 追加のARCSライブラリをここに記述
+#include "Matrix.hh"
+#include "CsvManipulator.hh"
+#include "Mailbox.hh"
+#include "SPSCQueue.hh"
+
+using namespace ARCS;
+
+//! @brief 確認結果を表示する関数
+//! @param[in]		Name	確認項目の名前
+//! @param[in]		Passed	true = 期待どおり
+//! @param[in,out]	Failed	期待どおりでなかった項目の数
+void Check(const char* Name, const bool Passed, int& Failed){
+	printf("%-40s : %s\n", Name, Passed ? "OK" : "NG");
+	if(Passed == false) ++Failed;
+}
+
+//! @brief エントリポイント
+//! @return 終了ステータス
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+	
+	// ここにオフライン計算のコードを記述
+	// SPSCQueue と Mailbox の動作を1つのスレッドで順番に確認する
+	int Failed = 0;
+	int x = -1;
+	
+	// 満杯のときは書き込まずに捨てた回数を数える
+	SPSCQueue<int, 8> Queue;
+	bool Pushed = true;
+	for(int i = 0; i < 8; ++i) Pushed &= Queue.Push(i);
+	Check("Push up to capacity", Pushed && Queue.GetSize() == 8, Failed);
+	Check("Push to full queue is dropped", Queue.Push(100) == false && Queue.GetDropCount() == 1 && Queue.GetSize() == 8, Failed);
+	Check("Peek does not remove", Queue.Peek(x) && x == 0 && Queue.GetSize() == 8, Failed);
+	
+	// 読み出し位置が進んだら空いた分だけ書き込めて，配列の先頭に折り返しても順番どおりに読める
+	bool InOrder = true;
+	for(int i = 0; i < 3; ++i) InOrder &= Queue.Pop(x) && x == i;
+	for(int i = 8; i < 11; ++i) InOrder &= Queue.Push(i);
+	for(int i = 3; i < 11; ++i) InOrder &= Queue.Pop(x) && x == i;
+	Check("Wrap-around keeps FIFO order", InOrder && Queue.IsEmpty(), Failed);
+	x = -1;
+	Check("Pop from empty queue fails", Queue.Pop(x) == false && x == -1, Failed);
+	
+	// 書き込み位置と読み出し位置が容量の何倍も進んでも順番どおりに読める
+	InOrder = true;
+	int Next = 11;
+	for(int k = 0; k < 1000; ++k){
+		for(int i = 0; i < 5; ++i) InOrder &= Queue.Push(Next + i);
+		for(int i = 0; i < 5; ++i) InOrder &= Queue.Pop(x) && x == Next + i;
+		Next += 5;
+	}
+	Check("Repeated wrap-around keeps FIFO order", InOrder && Queue.IsEmpty() && Queue.GetDropCount() == 1, Failed);
+	
+	// 溜まっているレコードを読み捨てて最後のレコードだけを取り出す
+	for(int i = 0; i < 6; ++i) Queue.Push(200 + i);
+	Check("PopLatest returns the newest record", Queue.PopLatest(x) && x == 205 && Queue.IsEmpty(), Failed);
+	x = -1;
+	Check("PopLatest from empty queue fails", Queue.PopLatest(x) == false && x == -1, Failed);
+	Queue.Push(300);
+	Check("Push after PopLatest", Queue.Pop(x) && x == 300 && Queue.IsEmpty(), Failed);
+	
+	// 空にすると捨てた回数も消える
+	for(int i = 0; i < 10; ++i) Queue.Push(i);
+	Queue.Clear();
+	Check("Clear empties queue and drop count", Queue.IsEmpty() && Queue.GetDropCount() == 0 && Queue.Pop(x) == false, Failed);
+	
+	// 最新値メールボックスの通し番号
+	Mailbox<double> Box(1.5);
+	double y = 0;
+	unsigned long LastNumber = 0;
+	Check("Mailbox initial value has number 0", Box.Receive(y) == 0 && y == 1.5, Failed);
+	Check("Mailbox without new value", Box.ReceiveIfNew(y, LastNumber) == false, Failed);
+	Box.Post(2.5);
+	Box.Post(3.5);
+	Check("Mailbox keeps only the latest value", Box.ReceiveIfNew(y, LastNumber) && y == 3.5 && LastNumber == 2, Failed);
+	Check("Mailbox value is read only once", Box.ReceiveIfNew(y, LastNumber) == false && Box.GetNumber() == 2, Failed);
+	
+	printf("\n%d failed\n", Failed);
+	return Failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;	// すべて期待どおりなら正常終了
+}
+
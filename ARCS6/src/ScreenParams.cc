@@ -1,10 +1,10 @@
 //! @file ScreenParams.cc
 //! @brief ARCS画面パラメータ格納クラス
 //!        ARCS用画面に表示する各種パラメータを格納します。
-//! @date 2020/04/10
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -26,6 +26,11 @@ ScreenParams::ScreenParams(void)
 	  ComputationTime({0}),
 	  MaxTime({0}),
 	  MinTime({0}),
+	  LatencyP50({0}),
+	  LatencyP99({0}),
+	  LatencyP999({0}),
+	  LatencyMax({0}),
+	  Overruns({0}),
 	  NetworkLink(false),
 	  Initializing(false),
 	  CurrentRef({0}),
@@ -121,6 +126,50 @@ void ScreenParams::SetTimeVars(
 	pthread_mutex_unlock(&TimeMutex);
 }
 
+//! @brief 開始時刻の遅れのパーセンタイルと最大値，周期超過の回数の配列を返す関数
+//! @param[out]	P50		開始時刻の遅れの50パーセンタイル値の配列
+//! @param[out]	P99		開始時刻の遅れの99パーセンタイル値の配列
+//! @param[out]	P999	開始時刻の遅れの99.9パーセンタイル値の配列
+//! @param[out]	Max		開始時刻の遅れの最大値の配列
+//! @param[out]	Ovr		周期超過の回数の配列
+void ScreenParams::GetLatencyVars(
+	std::array<double, ConstParams::THREAD_MAX>& P50,
+	std::array<double, ConstParams::THREAD_MAX>& P99,
+	std::array<double, ConstParams::THREAD_MAX>& P999,
+	std::array<double, ConstParams::THREAD_MAX>& Max,
+	std::array<unsigned long, ConstParams::THREAD_MAX>& Ovr
+){
+	pthread_mutex_lock(&TimeMutex);
+	P50  = LatencyP50;
+	P99  = LatencyP99;
+	P999 = LatencyP999;
+	Max  = LatencyMax;
+	Ovr  = Overruns;
+	pthread_mutex_unlock(&TimeMutex);
+}
+
+//! @brief 開始時刻の遅れのパーセンタイルと最大値，周期超過の回数の配列を設定する関数
+//! @param[in]	P50		開始時刻の遅れの50パーセンタイル値の配列
+//! @param[in]	P99		開始時刻の遅れの99パーセンタイル値の配列
+//! @param[in]	P999	開始時刻の遅れの99.9パーセンタイル値の配列
+//! @param[in]	Max		開始時刻の遅れの最大値の配列
+//! @param[in]	Ovr		周期超過の回数の配列
+void ScreenParams::SetLatencyVars(
+	const std::array<double, ConstParams::THREAD_MAX>& P50,
+	const std::array<double, ConstParams::THREAD_MAX>& P99,
+	const std::array<double, ConstParams::THREAD_MAX>& P999,
+	const std::array<double, ConstParams::THREAD_MAX>& Max,
+	const std::array<unsigned long, ConstParams::THREAD_MAX>& Ovr
+){
+	pthread_mutex_lock(&TimeMutex);
+	LatencyP50 = P50;
+	LatencyP99 = P99;
+	LatencyP999 = P999;
+	LatencyMax = Max;
+	Overruns = Ovr;
+	pthread_mutex_unlock(&TimeMutex);
+}
+
 //! @brief ネットワークリンクフラグを取得する関数
 //! @return ネットワークリンクフラグ
 bool ScreenParams::GetNetworkLink(void){
@@ -1,10 +1,10 @@
 //! @file ScreenParams.hh
 //! @brief ARCS画面パラメータ格納クラス
 //!        ARCS用画面に表示する各種パラメータを格納します。
-//! @date 2020/04/10
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -40,6 +40,20 @@ namespace ARCS {	// ARCS名前空間
 				const std::array<double, ConstParams::THREAD_MAX>& Max,
 				const std::array<double, ConstParams::THREAD_MAX>& Min
 			);	//! @brief 実際の制御周期，消費時間，制御周期の最大値，最小値の配列を設定する関数
+			void GetLatencyVars(
+				std::array<double, ConstParams::THREAD_MAX>& P50,
+				std::array<double, ConstParams::THREAD_MAX>& P99,
+				std::array<double, ConstParams::THREAD_MAX>& P999,
+				std::array<double, ConstParams::THREAD_MAX>& Max,
+				std::array<unsigned long, ConstParams::THREAD_MAX>& Ovr
+			);	//!< 開始時刻の遅れのパーセンタイルと最大値，周期超過の回数の配列を返す関数
+			void SetLatencyVars(
+				const std::array<double, ConstParams::THREAD_MAX>& P50,
+				const std::array<double, ConstParams::THREAD_MAX>& P99,
+				const std::array<double, ConstParams::THREAD_MAX>& P999,
+				const std::array<double, ConstParams::THREAD_MAX>& Max,
+				const std::array<unsigned long, ConstParams::THREAD_MAX>& Ovr
+			);	//!< 開始時刻の遅れのパーセンタイルと最大値，周期超過の回数の配列を設定する関数
 
 			// 状態フラグ関連の関数
 			bool GetNetworkLink(void);							//!< ネットワークリンクフラグを取得する関数
@@ -134,6 +148,11 @@ namespace ARCS {	// ARCS名前空間
 			std::array<double, ConstParams::THREAD_MAX> ComputationTime;	//!< [s] 計測された消費時間
 			std::array<double, ConstParams::THREAD_MAX> MaxTime;			//!< [s] 計測された制御周期の最大値
 			std::array<double, ConstParams::THREAD_MAX> MinTime;			//!< [s] 計測された制御周期の最小値
+			std::array<double, ConstParams::THREAD_MAX> LatencyP50;		//!< [s] 開始時刻の遅れの50パーセンタイル値
+			std::array<double, ConstParams::THREAD_MAX> LatencyP99;		//!< [s] 開始時刻の遅れの99パーセンタイル値
+			std::array<double, ConstParams::THREAD_MAX> LatencyP999;		//!< [s] 開始時刻の遅れの99.9パーセンタイル値
+			std::array<double, ConstParams::THREAD_MAX> LatencyMax;		//!< [s] 開始時刻の遅れの最大値
+			std::array<unsigned long, ConstParams::THREAD_MAX> Overruns;	//!< 消費時間が制御周期を超えた回数
 			
 			// 状態フラグ関連の変数
 			bool NetworkLink;		//!< ネットワークリンクフラグ
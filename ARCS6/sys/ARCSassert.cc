@@ -39,11 +39,12 @@ ARCSassert::~ARCSassert(){
 }
 
 //! @brief ARCS用assert関数(マクロから呼ばれることを想定)
+//! 文字列リテラルのまま受け取る(マクロの三項演算子の中でstd::stringの一時オブジェクトを作ると，GCC 12の最適化で二重に破棄されることがあるため)
 //! @param[in] assertion assert条件
 //! @param[in] condition assert条件の文字列
 //! @param[in] file assert条件に引っかかったときのファイル名
 //! @param[in] line assert条件に引っかかったときの行番号
-void ARCSassert::assert_from_macro(const bool assertion, const std::string& condition, const std::string& file, const int line){
+void ARCSassert::assert_from_macro(const bool assertion, const char* condition, const char* file, const int line){
 	if(assertion == false && EmergencyStopFlag == false){	// assertion条件に一致しなくて且つ以前に緊急停止されていないとき
 		// assert情報を設定
 		pthread_mutex_lock(&SyncMutex);		// Mutexロック
@@ -65,7 +66,7 @@ void ARCSassert::assert_from_macro(const bool assertion, const std::string& cond
 		EventLog("Waiting for Emergency Process...Done");
 		
 		// イベントログに状況を書き込む
-		ARCSeventlog::WriteEventLog(condition, ">>>>> EMERGENCY STOP <<<<< : " + file, line);
+		ARCSeventlog::WriteEventLog(condition, ">>>>> EMERGENCY STOP <<<<< : " + EmergencyStopFile, line);
 		
 		if(RealtimeModeFlag == true){
 			// リアルタイムモードで動作中のとき
@@ -24,7 +24,7 @@ namespace ARCS {	// ARCS名前空間
 		public:
 			ARCSassert();	//!< コンストラクタ
 			~ARCSassert();	//!< デストラクタ
-			static void assert_from_macro(const bool assertion, const std::string& condition, const std::string& file, const int line); //!<ARCS用assert関数(マクロから呼ばれることを想定)
+			static void assert_from_macro(const bool assertion, const char* condition, const char* file, const int line); //!<ARCS用assert関数(マクロから呼ばれることを想定)
 			bool IsRealtimeMode(void);		//!< リアルタイムモードかどうか返す関数
 			void SetRealtimeMode(void);		//!< リアルタイムモードに切り替える関数
 			void SetNonRealtimeMode(void);	//!< 非リアルタイムモードに切り替える関数
@@ -1,10 +1,10 @@
 //! @file ARCSscreen.cc
 //! @brief ARCS画面描画クラス
 //!        ARCS用画面の描画を行います。
-//! @date 2020/04/10
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -788,11 +788,21 @@ void ARCSscreen::DispBaseScreen(void){
 	wattrset(MainScreen, COLOR_PAIR(WHITE_BLUE));
 	mvwaddstr(MainScreen, 23,0," VARIABLE INDICATOR AND SETTINGS     |");
 	wattrset(MainScreen, COLOR_PAIR(WHITE_BLUE));
-	for(int i = 24; i < VERTICAL_MAX - 2; ++i){
+	const int VarsBottom = LTNCY_VISIBLE == true ? LTNCY_TOP : VERTICAL_MAX - 2;	// 変数表示の欄の下端 (統計表示が無いときは画面の下まで)
+	for(int i = 24; i < VarsBottom; ++i){
 		mvwaddstr(MainScreen, i, 0,"    ");
 		mvwaddstr(MainScreen, i,18,"    ");
 	}
 	
+	// 開始時刻の遅れの統計表示
+	if(LTNCY_VISIBLE == true){
+		mvwaddstr(MainScreen, LTNCY_TOP, 0," START LATENCY [us] AND OVERRUNS     |");
+		mvwaddstr(MainScreen, LTNCY_TOP + 1, 0,"    ");
+		for(unsigned int i = 0; i < ConstParams::THREAD_MAX; ++i) mvwprintw(MainScreen, LTNCY_TOP + 2 + i, 0," %2d ", i+1);
+		wattrset(MainScreen, COLOR_PAIR(WHITE_BLACK));
+		mvwaddstr(MainScreen, LTNCY_TOP + 1, 4,"   P50   P99 P99.9   MAX OVERRUN");
+	}
+	
 	// 罫線の描画を行う
 	wattrset(MainScreen, COLOR_PAIR(BLUE_BLACK));
 	AddVLine(2,4,22);AddVLine(2,4,40);AddVLine(2,4,49);AddVLine(2,4,58);AddVLine(2,4,67);AddVLine(1,4,HORIZONTAL_MAX-15);
@@ -875,6 +885,15 @@ void ARCSscreen::DispParameters(void){
 		mvwprintw(MainScreen, 2 + i, 59, "%5.0f", MinTime.at(i)*1e6);
 	}
 	
+	// 各スレッドにおける開始時刻の遅れのパーセンタイルと最大値，周期超過の回数の表示
+	std::array<double, ConstParams::THREAD_MAX> LatencyP50, LatencyP99, LatencyP999, LatencyMax;
+	std::array<unsigned long, ConstParams::THREAD_MAX> Overruns;
+	ScrPara.GetLatencyVars(LatencyP50, LatencyP99, LatencyP999, LatencyMax, Overruns);	// 統計情報取得
+	for(unsigned int i = 0; i < ConstParams::THREAD_NUM && LTNCY_VISIBLE == true; ++i){
+		mvwprintw(MainScreen, LTNCY_TOP + 2 + i, 4, "%6.1f%6.1f%6.1f%6.1f%8lu",
+			LatencyP50.at(i)*1e6, LatencyP99.at(i)*1e6, LatencyP999.at(i)*1e6, LatencyMax.at(i)*1e6, Overruns.at(i));
+	}
+	
 	// ランプ点灯制御
 	ShowNetLinkIndic(ScrPara.GetNetworkLink());	// ネットワークリンクランプ
 	ShowInitIndic(ScrPara.GetInitializing());	// ロボット初期化ランプ
@@ -1,10 +1,10 @@
 //! @file ARCSscreen.hh
 //! @brief ARCS画面描画クラス
 //!        ARCS用画面の描画を行います。
-//! @date 2020/03/11
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yuki YOKOKURA
+// Copyright (C) 2011-2026 Yuki YOKOKURA
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
@@ -15,6 +15,7 @@
 #include <ncurses.h>
 #include <pthread.h>
 #include <array>
+#include <algorithm>
 #include <string>
 #include "ConstParams.hh"
 #include "RingBuffer.hh"
@@ -79,6 +80,10 @@ namespace ARCS {	// ARCS名前空間
 			static constexpr unsigned int DBINDC_LEFT = ConstParams::SCR_HORIZONTAL_MAX - 23;	//!< デバッグインジケータの横位置
 			static constexpr unsigned int DBINDC_NUM = 16;	//!< デバッグインジケータの数
 			
+			// 開始時刻の遅れの統計表示の定数
+			static constexpr unsigned int LTNCY_TOP = ConstParams::SCR_VERTICAL_MAX - 4 - ConstParams::THREAD_MAX;	//!< 開始時刻の遅れの統計表示の縦位置
+			static constexpr bool LTNCY_VISIBLE = 24 + std::max(ConstParams::INDICVARS_NUM, ConstParams::ONLINEVARS_NUM) <= LTNCY_TOP;	//!< 開始時刻の遅れの統計表示の有効/無効 (画面が低くて変数表示と重なるときは表示しない)
+			
 			// 非常停止ウィンドウの定数
 			static constexpr int EMWIN_LEFT = 0;								//!< 非常停止ウィンドウの左端
 			static constexpr int EMWIN_RIGHT = ConstParams::SCR_HORIZONTAL_MAX;	//!< 非常停止ウィンドウの右端
@@ -3,15 +3,16 @@
 //!
 //! リアルタイムスレッドの生成、開始、停止、破棄などの管理をします。
 //!
-//! @date 2020/04/15
+//! @date 2026/10/16
 //! @author Yokokura, Yuki
 //
-// Copyright (C) 2011-2020 Yokokura, Yuki
+// Copyright (C) 2011-2026 Yokokura, Yuki
 // This program is free software;
 // you can redistribute it and/or modify it under the terms of the FreeBSD License.
 // For details, see the License.txt file.
 
 #include <unistd.h>
+#include <string>
 #include "ARCSthread.hh"
 #include "ARCScommon.hh"
 #include "ARCSeventlog.hh"
@@ -114,6 +115,9 @@ void ARCSthread::SaveDataFiles(void){
 	EventLog("Writing PNG/CSV Data Files...");
 	Graph.SaveScreenImage();	// スクリーンショットをPNGに保存
 	ExpDatMem.WriteCsvFile();	// データメモリの中身をCSVに保存
+	for(size_t i = 0; i < ConstParams::THREAD_NUM; ++i){
+		RTthreads.at(i)->WriteHistogramCsv("LATENCY" + std::to_string(i + 1) + ".csv");	// 時間の分布をCSVに保存
+	}
 	EventLog("Writing PNG/CSV Data Files...Done");
 }
 
@@ -125,6 +129,11 @@ void ARCSthread::InfoGetThread(ARCSthread* const p){
 	std::array<double, ConstParams::THREAD_MAX> ComputationTime = {0};	// [s] 計測された消費時間
 	std::array<double, ConstParams::THREAD_MAX> MaxTime = {0};			// [s] 計測された制御周期の最大値
 	std::array<double, ConstParams::THREAD_MAX> MinTime = {0};			// [s] 計測された制御周期の最小値
+	std::array<double, ConstParams::THREAD_MAX> LatencyP50 = {0};		// [s] 開始時刻の遅れの50パーセンタイル値
+	std::array<double, ConstParams::THREAD_MAX> LatencyP99 = {0};		// [s] 開始時刻の遅れの99パーセンタイル値
+	std::array<double, ConstParams::THREAD_MAX> LatencyP999 = {0};		// [s] 開始時刻の遅れの99.9パーセンタイル値
+	std::array<double, ConstParams::THREAD_MAX> LatencyMax = {0};		// [s] 開始時刻の遅れの最大値
+	std::array<unsigned long, ConstParams::THREAD_MAX> Overruns = {0};	// 消費時間が制御周期を超えた回数
 	
 	// 動作状態が「開始」か「破棄」に設定されるまで待機
 	EventLog("Waiting for ITS_START,ITS_DSTRCT...");
@@ -143,15 +152,25 @@ void ARCSthread::InfoGetThread(ARCSthread* const p){
 		Time = p->RTthreads.at(0)->GetTime();	// 時刻の取得
 		
 		for(size_t i = 0; i < ConstParams::THREAD_NUM; ++i){
-			PeriodicTime[i]    = p->RTthreads[i]->GetSmplTime();// 制御周期の取得
-			ComputationTime[i] = p->RTthreads[i]->GetCompTime();// 消費時間の取得
-			MaxTime[i]         = p->RTthreads[i]->GetMaxTime();	// 制御周期の最大値の取得
-			MinTime[i]         = p->RTthreads[i]->GetMinTime();	// 制御周期の最小値の取得
+			const auto Timing = p->RTthreads[i]->GetTimingInfo();// 同じ周期に計測された時間情報をまとめて取得
+			PeriodicTime[i]    = Timing.SmplTime;	// 制御周期
+			ComputationTime[i] = Timing.CompTime;	// 消費時間
+			MaxTime[i]         = Timing.MaxTime;	// 制御周期の最大値
+			MinTime[i]         = Timing.MinTime;	// 制御周期の最小値
+			Overruns[i]        = Timing.Overruns;	// 周期超過の回数
+			
+			// 開始時刻の遅れのヒストグラムからパーセンタイルを計算
+			const LatencyHistogram& Hist = p->RTthreads[i]->GetStartLatencyHist();
+			LatencyP50[i]  = Hist.GetPercentile(50)*1e-9;
+			LatencyP99[i]  = Hist.GetPercentile(99)*1e-9;
+			LatencyP999[i] = Hist.GetPercentile(99.9)*1e-9;
+			LatencyMax[i]  = Hist.GetMax()*1e-9;
 		}
 		
 		// ARCS画面パラメータに格納
 		p->ScrPara.SetTime(Time);
 		p->ScrPara.SetTimeVars(PeriodicTime, ComputationTime, MaxTime, MinTime);
+		p->ScrPara.SetLatencyVars(LatencyP50, LatencyP99, LatencyP999, LatencyMax, Overruns);
 		
 		// 制御用変数値を更新
 		p->CtrlFuncs.UpdateControlValue();	// 制御用周期実行関数群クラス内部で，ARCS画面パラメータに書き込む/から読み込む